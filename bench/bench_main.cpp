@@ -0,0 +1,434 @@
+/**
+ * Render-kernel micro-benchmarks (env:bench)
+ *
+ * Times the hot framebuffer primitives and every clock mode on the host, with
+ * the TFT and time layers stubbed (sim/). Results are ns per call and, for the
+ * modes, frames per second for renderCurrentMode() plus the dirty-rectangle
+ * diff that renderFBToTFT() runs on every frame.
+ *
+ * USAGE:
+ *   pio run -e bench
+ *   .pio/build/bench/program --json baseline.json            # record a baseline
+ *   .pio/build/bench/program --baseline baseline.json        # compare, exit 1 on regression
+ *
+ * OPTIONS:
+ *   --json FILE        Write results as JSON
+ *   --baseline FILE    Compare against a JSON baseline
+ *   --tolerance PCT    Allowed slowdown before a result counts as a regression (default: 15)
+ *   --filter TEXT      Only run benchmarks whose name contains TEXT
+ *   --min-ms N         Minimum measuring time per repetition (default: 50)
+ *
+ * Numbers are host timings: compare runs on the same machine and build flags,
+ * not against ESP32 figures.
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <vector>
+#include "config.h"
+#include "debug.h"
+#include "AppConfig.h"
+#include "BitPlane.h"
+#include "ClockFace.h"
+#include "Color565.h"
+#include "Tween.h"
+#include "DirtyRects.h"
+#include "SensorDriver.h"
+#include "TetrisClock.h"
+
+// Firmware globals normally defined in main.cpp
+AppConfig cfg;
+uint8_t debugLevel = DBG_LEVEL_WARN;
+
+bool sensorAvailable = true;
+uint8_t sensorMeasures = SENSOR_TEMPERATURE | SENSOR_PRESSURE;  // A BMP280
+int temperature = 22;
+int humidity = 45;
+int pressure = 1013;
+
+// Repetitions per benchmark; the fastest one is reported (least host noise)
+#define BENCH_REPEATS 5
+
+struct BenchOptions {
+  const char* jsonPath = nullptr;
+  const char* baselinePath = nullptr;
+  const char* filter = nullptr;
+  float tolerance = 15.0f;   // Percent
+  int minMs = 50;
+};
+
+struct BenchResult {
+  String name;
+  double ns;      // ns per call (per frame for modes)
+  bool isFrame;   // Clock mode result: also report FPS
+};
+
+static BenchOptions opt;
+static std::vector<BenchResult> results;
+
+// Keeps results observable so the optimizer cannot drop benchmarked calls
+static volatile uint32_t sink = 0;
+
+alignas(4) static uint16_t fbPrev[LED_MATRIX_H][LED_MATRIX_W];
+
+// =========================
+// Timing
+// =========================
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Time fn() and record ns per call
+ * Calls are batched until a batch takes at least opt.minMs, then the batch is
+ * repeated BENCH_REPEATS times and the fastest kept.
+ */
+template <typename Fn>
+static void bench(const char* name, Fn&& fn, bool isFrame = false) {
+  if (opt.filter && !strstr(name, opt.filter)) return;
+
+  // Calibrate batch size
+  uint64_t iters = 1;
+  const uint64_t minNs = (uint64_t)opt.minMs * 1000000ULL;
+  for (;;) {
+    uint64_t t0 = nowNs();
+    for (uint64_t i = 0; i < iters; i++) fn();
+    if (nowNs() - t0 >= minNs / 4) break;
+    iters *= 2;
+  }
+  iters *= 4;
+
+  double best = 1e30;
+  for (int r = 0; r < BENCH_REPEATS; r++) {
+    uint64_t t0 = nowNs();
+    for (uint64_t i = 0; i < iters; i++) fn();
+    double ns = (double)(nowNs() - t0) / (double)iters;
+    if (ns < best) best = ns;
+  }
+
+  results.push_back(BenchResult{String(name), best, isFrame});
+  if (isFrame) {
+    Serial.printf("  %-28s %12.1f ns/frame %12.0f fps\n", name, best, 1e9 / best);
+  } else {
+    Serial.printf("  %-28s %12.1f ns/call\n", name, best);
+  }
+}
+
+// =========================
+// Benchmarks
+// =========================
+
+/**
+ * Primitives called from the clock modes
+ */
+static void benchKernels() {
+  const uint16_t color = rgb888_to_565(cfg.ledColor);
+  const Bitmap& eight = digitBitmap(8);  // Most ON pixels of any digit
+  static Pt pts[420];
+
+  Serial.printf("Kernels\n");
+  bench("fbClear", [] { fbClear(0); sink += fb[0][0]; });
+  bench("drawBitmapSolid", [&] { drawBitmapSolid(eight, 0, 0, DIGIT_W); sink += fb[16][4]; });
+  bench("drawSpawnMorphToTarget", [&] { drawSpawnMorphToTarget(eight, MORPH_STEPS / 2, 0, 0, DIGIT_W); sink += fb[16][4]; });
+  bench("drawSpawnMorphDigit", [&] { drawSpawnMorphDigit(8, MORPH_STEPS / 2, 0, 0); sink += fb[16][4]; });
+  bench("drawPairMorph", [&] { drawPairMorph(9, 8, MORPH_STEPS / 2, 0, 0); sink += fb[16][4]; });
+  bench("buildPixelsFromBitmap", [&] { sink += buildPixelsFromBitmap(eight, DIGIT_W, pts, 420); });
+  bench("drawLEDDot", [&] { drawLEDDot(10, 10, color, 200); sink += fb[10][10]; });
+  bench("drawLEDSegmentDots", [&] { drawLEDSegmentDots(2, 2, 2, 12, 6, 200, color); sink += fb[2][2]; });
+  bench("drawText3x5", [&] { drawText3x5("12:34:56", 0, 0, color); sink += fb[0][0]; });
+  bench("ease", [] { static q16_t t = 0; t = (t + 4099) & 0xFFFF; sink += ease(EASE_IN_OUT_CUBIC, t); });
+
+  // Build every digit's table to report the worst case
+  if (opt.filter && !strstr("morphTableBytes", opt.filter)) return;
+  for (uint8_t d = 0; d < 10; d++) drawSpawnMorphDigit(d, 0, 0, 0);
+  Serial.printf("  %-28s %12u bytes (all digits)\n", "morphTableBytes", (unsigned)morphTableBytes());
+}
+
+/**
+ * The per-pixel brightness scaling and curves, against the per-channel divide
+ * they replaced
+ * One color per call at a varying level, as the clock modes scale each dot or
+ * segment separately (a whole-row loop would be vectorized on the host).
+ * The divide is kept as written: the compiler turns /255 into a multiply and
+ * shift, so on the host both run at about the same speed. /api/perf?bench=1
+ * times the same two kernels on the ESP32.
+ */
+static void benchColorScale() {
+  static uint16_t colors[LED_MATRIX_W];
+  for (int x = 0; x < LED_MATRIX_W; x++) colors[x] = (uint16_t)(x * 1031u + 0x5A5A);
+  static uint32_t i = 0;
+
+  Serial.printf("Color scaling\n");
+  bench("scale565", [] {
+    i++;
+    sink += scale565(colors[i % LED_MATRIX_W], (uint8_t)(i * 37));
+  });
+  bench("scale565.divide", [] {
+    i++;
+    const uint16_t c = colors[i % LED_MATRIX_W];
+    const uint8_t level = (uint8_t)(i * 37);
+    uint8_t r = ((c >> 11) & 0x1F) * level / 255;
+    uint8_t g = ((c >> 5) & 0x3F) * level / 255;
+    uint8_t b = (c & 0x1F) * level / 255;
+    sink += (r << 11) | (g << 5) | b;
+  });
+  bench("dim565.gamma", [] {
+    i++;
+    sink += dim565(colors[i % LED_MATRIX_W], (uint8_t)(i * 37), LED_DIM_GAMMA, i, i >> 6);
+  });
+  bench("dim565.dither", [] {
+    i++;
+    sink += dim565(colors[i % LED_MATRIX_W], (uint8_t)(i * 37), LED_DIM_DITHER, i, i >> 6);
+  });
+}
+
+/**
+ * The 7-segment bit-plane path (BitPlane.h): drawing a digit into a plane and
+ * resolving a seconds tick into an RGB565 frame
+ */
+static void benchBitPlane() {
+  const uint16_t color = rgb888_to_565(cfg.ledColor);
+  static BitFrame a, b;
+  static uint16_t out[LED_MATRIX_H][LED_MATRIX_W];
+
+  Serial.printf("Bit planes (BitPlane.h)\n");
+  bench("BitFrame.blit", [&] {
+    a.clear();
+    BitPlane* p = a.plane(color);
+    const Bitmap& bm = digitBitmap(8);
+    for (int y = 0; y < DIGIT_H; y++) p->orRow(y, bm.rows[y], 5, DIGIT_W);
+    sink += p->rows[16][0];
+  });
+
+  // Seconds tick: six digits, the last one changes
+  auto face = [&](BitFrame& f, uint8_t last) {
+    f.clear();
+    BitPlane* p = f.plane(color);
+    const uint8_t digits[6] = {1, 2, 3, 4, 5, last};
+    for (int i = 0; i < 6; i++) {
+      const Bitmap& bm = digitBitmap(digits[i]);
+      for (int y = 0; y < DIGIT_H; y++) p->orRow(y, bm.rows[y], 2 + i * 10, DIGIT_W);
+    }
+  };
+  face(a, 6);
+  face(b, 7);
+  bench("resolveBitFrame.tick", [&] { sink += resolveBitFrame(b, &a, out); });
+  bench("resolveBitFrame.idle", [&] { sink += resolveBitFrame(b, &b, out); });
+}
+
+/**
+ * The fb/fbPrev diff as renderFBToTFT() runs it (DirtyRects.h): diffFrames()
+ * into a FrameDiff, then rectangles only if a row changed. No TFT, and
+ * fbPrev is left alone so every call sees the same frames.
+ */
+static uint32_t diffAsRendered() {
+  static FrameDiff diff;
+  diffFrames(fb, fbPrev, diff);
+  if (!diff.rows) return 0;
+  uint32_t rects = 0;
+  collectDirtyRects(fb, diff, [&](const DirtyRect&) { rects++; });
+  return diff.changed + rects;
+}
+
+static void benchDiff() {
+  Serial.printf("Diff (diffFrames + collectDirtyRects)\n");
+
+  // Full repaint: a complete clock face over a black screen
+  clockSetTime("123456");
+  morphStep = MORPH_STEPS;
+  cfg.clockMode = CLOCK_MODE_7SEG;
+  drawFrame();
+  memset(fbPrev, 0, sizeof(fbPrev));
+  bench("diff.full", [] { sink += diffAsRendered(); });
+
+  // Idle frame: nothing changed
+  memcpy(fbPrev, fb, sizeof(fb));
+  bench("diff.idle", [] { sink += diffAsRendered(); });
+
+  // Seconds tick: one digit changes
+  clockSetTime("123457");
+  morphStep = MORPH_STEPS;
+  drawFrame();
+  bench("diff.tick", [] { sink += diffAsRendered(); });
+}
+
+/**
+ * Whole frames per clock mode: renderCurrentMode() + diff against the last frame
+ * Simulated time advances FRAME_MS per frame and the clock ticks every second,
+ * so animated transitions are included in proportion.
+ */
+static void benchModes() {
+  struct Mode { const char* name; uint8_t mode; };
+  static const Mode modes[] = {
+    {"frame.7seg", CLOCK_MODE_7SEG},
+    {"frame.tetris", CLOCK_MODE_TETRIS},
+    {"frame.morph", CLOCK_MODE_MORPH},
+  };
+
+  Serial.printf("Clock modes (renderCurrentMode + diff)\n");
+  for (const Mode& m : modes) {
+    cfg.clockMode = m.mode;
+    simSetMillis(0);
+    randomSeed(1);
+    clockSetTime("125955");
+    memset(fbPrev, 0, sizeof(fbPrev));
+
+    int sec = 55;
+    int minute = 59;
+    unsigned long nextSecond = 1000;
+
+    bench(m.name, [&] {
+      renderCurrentMode();
+      static FrameDiff diff;
+      diffFrames(fb, fbPrev, diff);
+      sink += collectDirtyRects(fb, diff, [](const DirtyRect&) {});
+      copyDirtyRows(fbPrev, fb, diff);
+
+      simAdvanceMillis(FRAME_MS);
+      if (millis() >= nextSecond) {
+        nextSecond += 1000;
+        if (++sec == 60) { sec = 0; minute = (minute + 1) % 60; }
+        char t6[16];
+        snprintf(t6, sizeof(t6), "12%02d%02d", minute, sec);
+        clockSetTime(t6);
+        clockColon = !clockColon;
+      }
+    }, true);
+  }
+}
+
+// =========================
+// JSON baseline
+// =========================
+static bool writeJson(const char* path) {
+  FILE* f = fopen(path, "w");
+  if (!f) {
+    DBG_ERROR("Cannot write %s\n", path);
+    return false;
+  }
+
+  fprintf(f, "{\n  \"firmware\": \"%s\",\n  \"ns\": {\n", FIRMWARE_VERSION);
+  for (size_t i = 0; i < results.size(); i++) {
+    fprintf(f, "    \"%s\": %.1f%s\n", results[i].name.c_str(), results[i].ns,
+            i + 1 < results.size() ? "," : "");
+  }
+  fprintf(f, "  },\n  \"fps\": {\n");
+  bool first = true;
+  for (const BenchResult& r : results) {
+    if (!r.isFrame) continue;
+    fprintf(f, "%s    \"%s\": %.0f", first ? "" : ",\n", r.name.c_str(), 1e9 / r.ns);
+    first = false;
+  }
+  fprintf(f, "\n  }\n}\n");
+  return fclose(f) == 0;
+}
+
+/**
+ * Look up one "name": value pair in the "ns" object of a baseline file
+ * (the format writeJson() produces; not a general JSON parser)
+ */
+static bool baselineValue(const std::string& json, const String& name, double& out) {
+  size_t ns = json.find("\"ns\"");
+  if (ns == std::string::npos) return false;
+  size_t end = json.find('}', ns);
+
+  std::string key = std::string("\"") + name.c_str() + "\"";
+  size_t p = json.find(key, ns);
+  if (p == std::string::npos || p > end) return false;
+  p = json.find(':', p);
+  if (p == std::string::npos) return false;
+  out = strtod(json.c_str() + p + 1, nullptr);
+  return out > 0;
+}
+
+/**
+ * Compare results against a baseline
+ * @return Number of regressions beyond opt.tolerance
+ */
+static int compareBaseline(const char* path) {
+  FILE* f = fopen(path, "r");
+  if (!f) {
+    DBG_ERROR("Cannot read baseline %s\n", path);
+    return -1;
+  }
+  std::string json;
+  char buf[512];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) json.append(buf, n);
+  fclose(f);
+
+  Serial.printf("Baseline %s (tolerance %.0f%%)\n", path, opt.tolerance);
+  int regressions = 0;
+  for (const BenchResult& r : results) {
+    double base;
+    if (!baselineValue(json, r.name, base)) {
+      Serial.printf("  %-28s %12s\n", r.name.c_str(), "new");
+      continue;
+    }
+    double pct = (r.ns - base) * 100.0 / base;
+    bool bad = pct > opt.tolerance;
+    if (bad) regressions++;
+    Serial.printf("  %-28s %+11.1f%% %s\n", r.name.c_str(), pct, bad ? "REGRESSION" : "");
+  }
+  return regressions;
+}
+
+// =========================
+// Command line
+// =========================
+static void usage() {
+  fprintf(stderr,
+          "usage: program [--json FILE] [--baseline FILE] [--tolerance PCT]\n"
+          "               [--filter TEXT] [--min-ms N]\n");
+}
+
+static bool parseArgs(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      usage();
+      return false;
+    }
+    const String a = argv[i];
+    const char* v = argv[++i];
+
+    if (a == "--json") opt.jsonPath = v;
+    else if (a == "--baseline") opt.baselinePath = v;
+    else if (a == "--tolerance") opt.tolerance = (float)atof(v);
+    else if (a == "--filter") opt.filter = v;
+    else if (a == "--min-ms") opt.minMs = max(1, atoi(v));
+    else {
+      usage();
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (!parseArgs(argc, argv)) return 2;
+
+  initBitmaps();
+  tetrisClock = new TetrisClock(fb);
+
+  benchKernels();
+  benchColorScale();
+  benchBitPlane();
+  benchDiff();
+  benchModes();
+
+  if (opt.jsonPath && !writeJson(opt.jsonPath)) return 1;
+
+  int rc = 0;
+  if (opt.baselinePath) {
+    int regressions = compareBaseline(opt.baselinePath);
+    if (regressions < 0) rc = 1;
+    else if (regressions > 0) {
+      Serial.printf("%d regression(s)\n", regressions);
+      rc = 1;
+    }
+  }
+
+  delete tetrisClock;
+  return rc;
+}
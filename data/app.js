@@ -5,6 +5,7 @@
  *
  * Features:
  * - Live display mirror rendering with RGB LED Matrix (HUB75) emulation
+ * - Mirror frames streamed over a WebSocket as deltas (falls back to 1-second polling)
  * - Real-time system state polling (1-second interval)
  * - Instant auto-apply for all configuration changes
  * - Timezone dropdown with 88 options across 13 regions
@@ -61,7 +62,9 @@ function rgbFromHex(hex) {
 }
 
 async function fetchState() {
-  const r = await fetch("/api/state", { cache: "no-store" });
+  // "no-cache" revalidates with the ETag: an unchanged state comes back as 304
+  // and the browser hands over its cached copy
+  const r = await fetch("/api/state", { cache: "no-cache" });
   return r.json();
 }
 
@@ -127,9 +130,32 @@ function formatBytes(bytes) {
   return `${(bytes / (1024 * 1024)).toFixed(2)} MB`;
 }
 
+// /api/state answers 304 until the device invalidates it (at the latest each
+// minute), and the browser then hands back the cached body. Clock and uptime
+// keep running from the moment that body was new.
+let liveBase = null;  // { time, uptime, at } of the latest fresh body
+
+function liveSeconds(state) {
+  const now = performance.now();
+  if (!liveBase || liveBase.time !== state.time || liveBase.uptime !== state.uptime) {
+    liveBase = { time: state.time, uptime: state.uptime, at: now };
+  }
+  return Math.floor((now - liveBase.at) / 1000);
+}
+
+function advanceTime(time, seconds) {
+  const m = /^(\d{2}):(\d{2}):(\d{2})$/.exec(time);
+  if (!m || seconds <= 0) return time;  // "--:--:--" until the clock is set
+  const t = (parseInt(m[1], 10) * 3600 + parseInt(m[2], 10) * 60 + parseInt(m[3], 10) + seconds) % 86400;
+  const pad = (v) => String(v).padStart(2, "0");
+  return `${pad(Math.floor(t / 3600))}:${pad(Math.floor(t / 60) % 60)}:${pad(t % 60)}`;
+}
+
 async function setControls(state) {
+  const elapsed = liveSeconds(state);
+
   // Time & Network
-  $("time").textContent = state.time;
+  $("time").textContent = advanceTime(state.time, elapsed);
   $("date").textContent = state.date;
   $("wifi").textContent = state.wifi;
   $("ip").textContent = state.ip;
@@ -177,7 +203,7 @@ async function setControls(state) {
 
   // System Resources
   if (state.uptime !== undefined) {
-    $("uptime").textContent = formatUptime(state.uptime);
+    $("uptime").textContent = formatUptime(state.uptime + elapsed);
   }
   if (state.freeHeap !== undefined) {
     $("freeHeap").textContent = formatBytes(state.freeHeap);
@@ -190,11 +216,17 @@ async function setControls(state) {
   if (state.cpuFreq !== undefined) {
     $("cpuFreq").textContent = `${state.cpuFreq} MHz`;
   }
+  if (state.spiWindows !== undefined) {
+    $("renderCost").textContent = `${state.spiWindows} SPI windows / ${state.changedLeds} LEDs`;
+  }
 
   // Debug Level
   if (document.activeElement !== $("debugLevel") && state.debugLevel !== undefined) {
     $("debugLevel").value = String(state.debugLevel);
   }
+  if (document.activeElement !== $("renderMode") && state.renderMode !== undefined) {
+    $("renderMode").value = String(state.renderMode);
+  }
 
   // Load timezones on first run
   await populateTimezones();
@@ -205,6 +237,9 @@ async function setControls(state) {
   if (document.activeElement !== $("use24h")) $("use24h").value = String(state.use24h);
   if (document.activeElement !== $("dateFormat")) $("dateFormat").value = String(state.dateFormat || 0);
   if (document.activeElement !== $("useFahrenheit")) $("useFahrenheit").value = String(state.useFahrenheit || false);
+  if (document.activeElement !== $("ledShape")) $("ledShape").value = String(state.ledShape || 0);
+  if (document.activeElement !== $("ledDimming")) $("ledDimming").value = String(state.ledDimming !== undefined ? state.ledDimming : 1);
+  if (document.activeElement !== $("morphStyle")) $("morphStyle").value = String(state.morphStyle !== undefined ? state.morphStyle : 1);
 
   if (!dirtyInputs.has("ledd")) $("ledd").value = state.ledDiameter;
   if (!dirtyInputs.has("ledg")) $("ledg").value = state.ledGap;
@@ -254,6 +289,7 @@ function updateModeVisibility(mode) {
   const leddLabel = $("leddLabel");
   const ledgLabel = $("ledgLabel");
   const morphSpeedLabel = $("morphSpeedLabel");
+  const morphStyleLabel = $("morphStyleLabel");
 
   // Remix settings (show sensor, show date, colors)
   const remixHeader = $("remixHeader");
@@ -266,6 +302,7 @@ function updateModeVisibility(mode) {
   if (leddLabel) leddLabel.style.display = isClassicOrTetris ? "" : "none";
   if (ledgLabel) ledgLabel.style.display = isClassicOrTetris ? "" : "none";
   if (morphSpeedLabel) morphSpeedLabel.style.display = isClassicOrTetris ? "" : "none";
+  if (morphStyleLabel) morphStyleLabel.style.display = (mode === 0) ? "" : "none";
 
   if (remixHeader) remixHeader.style.display = isRemix ? "" : "none";
   if (morphShowSensorLabel) morphShowSensorLabel.style.display = isRemix ? "" : "none";
@@ -277,12 +314,90 @@ function updateModeVisibility(mode) {
 async function fetchMirror() {
   const r = await fetch("/api/mirror", { cache: "no-store" });
   const buf = new Uint8Array(await r.arrayBuffer());
-  console.log(`[Fetch] Buffer size: ${buf.length} bytes (expected ${LED_W * LED_H})`);
-  // Log first few values
-  console.log(`[Fetch] First 10 bytes: ${Array.from(buf.slice(0, 10)).join(',')}`);
   return buf;
 }
 
+// =========================
+// Live mirror stream (WebSocket)
+// =========================
+// Frames are pushed as they are rendered, delta-encoded against the last frame
+// this page acknowledged (wire format: include/MirrorStream.h). While the
+// socket is down, tick() falls back to polling /api/mirror.
+
+const MIRROR_WS_PATH = "/ws/mirror";  // Must match MIRROR_WS_PATH in config.h
+const MIRROR_RECONNECT_MS = 3000;
+
+const mirrorFrame = new Uint8Array(LED_W * LED_H * 2);  // RGB565 little-endian, same layout as /api/mirror
+let mirrorSocket = null;
+let mirrorStreaming = false;   // A keyframe has arrived on the current socket
+let mirrorState = null;        // Latest /api/state (LED geometry for renderMirror)
+let mirrorDrawPending = false;
+
+function scheduleMirrorDraw() {
+  if (mirrorDrawPending || !mirrorState) return;
+  mirrorDrawPending = true;
+  requestAnimationFrame(() => {
+    mirrorDrawPending = false;
+    renderMirror(mirrorFrame, mirrorState);
+  });
+}
+
+/**
+ * Apply a keyframe or delta to mirrorFrame
+ * @returns {number|null} Sequence number to acknowledge, or null if not applied
+ */
+function applyMirrorMessage(buf) {
+  const v = new DataView(buf);
+  const type = String.fromCharCode(v.getUint8(0));
+  const seq = v.getUint32(1, true);
+
+  if (type === "K") {
+    mirrorFrame.set(new Uint8Array(buf, 5, mirrorFrame.length));
+    mirrorStreaming = true;
+    return seq;
+  }
+  if (type === "D" && mirrorStreaming) {
+    const runs = v.getUint16(9, true);
+    let o = 11;
+    for (let i = 0; i < runs; i++, o += 5) {
+      const start = v.getUint16(o, true);
+      const len = v.getUint8(o + 2);
+      const lo = v.getUint8(o + 3);
+      const hi = v.getUint8(o + 4);
+      for (let p = start * 2, end = (start + len) * 2; p < end; p += 2) {
+        mirrorFrame[p] = lo;
+        mirrorFrame[p + 1] = hi;
+      }
+    }
+    return seq;
+  }
+  return null;
+}
+
+function connectMirrorStream() {
+  const ws = new WebSocket(`ws://${location.host}${MIRROR_WS_PATH}`);
+  ws.binaryType = "arraybuffer";
+  mirrorSocket = ws;
+
+  ws.onmessage = (ev) => {
+    if (!(ev.data instanceof ArrayBuffer) || ev.data.byteLength < 5) return;
+    const seq = applyMirrorMessage(ev.data);
+    if (seq === null) return;
+
+    const ack = new DataView(new ArrayBuffer(5));
+    ack.setUint8(0, "A".charCodeAt(0));
+    ack.setUint32(1, seq, true);
+    ws.send(ack.buffer);
+    scheduleMirrorDraw();
+  };
+
+  ws.onclose = () => {
+    mirrorStreaming = false;
+    mirrorSocket = null;
+    setTimeout(connectMirrorStream, MIRROR_RECONNECT_MS);
+  };
+}
+
 async function saveConfig() {
   const state = await fetchState();
 
@@ -290,13 +405,17 @@ async function saveConfig() {
   const ntp = $("ntp").value.trim() || state.ntp;
   const use24h = $("use24h").value === "true";
   const dateFormat = parseInt($("dateFormat").value, 10) || 0;
+  const ledShape = parseInt($("ledShape").value, 10) || 0;
+  const ledDimming = parseInt($("ledDimming").value, 10) || 0;
   const useFahrenheit = $("useFahrenheit").value === "true";
 
   const ledDiameterRaw = parseInt($("ledd").value, 10);
   const ledGapRaw = parseInt($("ledg").value, 10);
   const brightness = parseInt($("bl").value, 10);
   const morphSpeed = parseInt($("morphSpeed").value, 10) || 1;
+  const morphStyle = parseInt($("morphStyle").value, 10) || 0;
   const debugLevel = parseInt($("debugLevel").value, 10);
+  const renderMode = parseInt($("renderMode").value, 10) || 0;
 
   const clockMode = parseInt($("clockMode").value, 10) || 0;
   const autoRotate = $("autoRotate").value === "true";
@@ -316,7 +435,7 @@ async function saveConfig() {
 
   const ledDiameter = Number.isFinite(ledDiameterRaw) ? ledDiameterRaw : state.ledDiameter;
   const ledGap = Number.isFinite(ledGapRaw) ? ledGapRaw : state.ledGap;
-  const payload = { tz, ntp, use24h, dateFormat, useFahrenheit, ledDiameter, ledGap, ledColor, brightness, morphSpeed, debugLevel, clockMode, autoRotate, rotateInterval, morphShowSensor, morphShowDate, morphSensorColor, morphDateColor };
+  const payload = { tz, ntp, use24h, dateFormat, useFahrenheit, ledDiameter, ledGap, ledShape, ledDimming, ledColor, brightness, morphSpeed, morphStyle, debugLevel, renderMode, clockMode, autoRotate, rotateInterval, morphShowSensor, morphShowDate, morphSensorColor, morphDateColor };
 
   const res = await fetch("/api/config", {
     method: "POST",
@@ -433,8 +552,6 @@ function renderMirror(buf, state) {
   // IMPORTANT: This must exactly match the TFT rendering logic in main.cpp:394-475
   // The TFT uses cfg.ledDiameter and cfg.ledGap to determine dot size and spacing
 
-  console.log(`[State] ledDiameter=${state.ledDiameter} ledGap=${state.ledGap} type=${typeof state.ledDiameter}`);
-
   let ledDiameter = parseInt(state.ledDiameter, 10);
   let ledGap = parseInt(state.ledGap, 10);
   if (isNaN(ledDiameter)) ledDiameter = 5;
@@ -483,9 +600,6 @@ function renderMirror(buf, state) {
   const insetX = Math.floor((pitchX - dot) / 2);
   const insetY = Math.floor((pitchY - dot) / 2);
 
-  // Debug logging
-  console.log(`[Mirror] pitchX=${pitchX} pitchY=${pitchY} dot=${dot} gap=${gap} insetX=${insetX} insetY=${insetY}`);
-
   ctx.fillStyle = "#000";
   ctx.fillRect(0, 0, TFT_W, TFT_H);
 
@@ -510,7 +624,6 @@ function renderMirror(buf, state) {
   // Each pixel is RGB565 (uint16_t), stored as 2 bytes (little-endian on ESP32)
   // Index calculation: buf[y * LED_W * 2 + x * 2] for byte offset
 
-  let nonZeroCount = 0;
   for (let y = 0; y < LED_H; y++) {
     for (let x = 0; x < LED_W; x++) {
       // RGB565 is 2 bytes per pixel (little-endian: low byte first, high byte second)
@@ -521,8 +634,6 @@ function renderMirror(buf, state) {
 
       if (!rgb565) continue;  // Skip black pixels
 
-      nonZeroCount++;
-
       // Decode RGB565 to RGB888
       // RGB565 format: RRRRR GGGGGG BBBBB (5 bits R, 6 bits G, 5 bits B)
       const r = ((rgb565 >> 11) & 0x1F) << 3;  // 5 bits -> 8 bits
@@ -530,12 +641,27 @@ function renderMirror(buf, state) {
       const b = (rgb565 & 0x1F) << 3;          // 5 bits -> 8 bits
 
       ctx.fillStyle = `rgb(${r},${g},${b})`;
+      if (state.ledShape > 0) {
+        // Round / glowing LEDs (TFT uses pre-rendered tiles from DotTileCache)
+        const cx = x0 + x * pitchX + insetX + dot / 2;
+        const cy = y0 + y * pitchY + insetY + dot / 2;
+        if (state.ledShape == 2) {
+          ctx.globalAlpha = 0.35;
+          ctx.beginPath();
+          ctx.arc(cx, cy, Math.min(pitchX, pitchY) / 2 + 0.5, 0, Math.PI * 2);
+          ctx.fill();
+          ctx.globalAlpha = 1;
+        }
+        ctx.beginPath();
+        ctx.arc(cx, cy, state.ledShape == 2 ? dot * 0.375 : dot / 2, 0, Math.PI * 2);
+        ctx.fill();
+        continue;
+      }
       // For Morph mode: non-square pixels (pitchX=7, pitchY=10)
       // For other modes: square pixels (pitchX=pitchY)
       ctx.fillRect(x0 + x * pitchX + insetX, y0 + y * pitchY + insetY, dot, dot);
     }
   }
-  console.log(`[Render] Drew ${nonZeroCount} non-zero LEDs`);
 
   // Draw status bar only for non-Morph Remix modes (clockMode != 2)
   // Morphing Remix mode hides the status bar on both TFT and WebUI
@@ -562,7 +688,7 @@ function renderMirror(buf, state) {
 }
 
 // Auto-apply on any config field change (instant feedback)
-["tz", "ntp", "use24h", "dateFormat", "useFahrenheit", "ledd", "ledg", "col", "bl", "morphSpeed", "debugLevel", "clockMode", "autoRotate", "rotateInterval", "morphShowSensor", "morphShowDate", "morphSensorColor", "morphDateColor"].forEach((id) => {
+["tz", "ntp", "use24h", "dateFormat", "useFahrenheit", "ledd", "ledg", "ledShape", "ledDimming", "col", "bl", "morphSpeed", "morphStyle", "debugLevel", "renderMode", "clockMode", "autoRotate", "rotateInterval", "morphShowSensor", "morphShowDate", "morphSensorColor", "morphDateColor"].forEach((id) => {
   const el = $(id);
   if (!el) return;  // Skip if element doesn't exist
 
@@ -597,8 +723,13 @@ async function tick() {
   try {
     const state = await fetchState();
     setControls(state);
-    const buf = await fetchMirror();
-    renderMirror(buf, state);
+    mirrorState = state;
+    if (mirrorStreaming) {
+      scheduleMirrorDraw();  // Geometry may have changed; pixels arrive over the socket
+    } else {
+      mirrorFrame.set((await fetchMirror()).subarray(0, mirrorFrame.length));
+      renderMirror(mirrorFrame, state);
+    }
   } catch (e) {
     console.warn(e);
   } finally {
@@ -606,4 +737,5 @@ async function tick() {
   }
 }
 
+connectMirrorStream();
 tick();
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * Runtime configuration (persisted to NVS by loadConfig()/saveConfig() in main.cpp)
+ */
+struct AppConfig {
+  char tz[48]   = DEFAULT_TZ;
+  char ntp[64]  = DEFAULT_NTP;
+  bool use24h   = DEFAULT_24H;
+  uint8_t dateFormat = 0;  // 0=YYYY-MM-DD, 1=DD/MM/YYYY, 2=MM/DD/YYYY, 3=DD.MM.YYYY, 4=Mon DD YYYY
+
+  uint8_t ledDiameter = DEFAULT_LED_DIAMETER;
+  uint8_t ledGap      = DEFAULT_LED_GAP;
+  uint8_t ledShape    = DEFAULT_LED_SHAPE;  // LED_SHAPE_SQUARE / ROUND / GLOW
+  uint8_t ledDimming  = DEFAULT_LED_DIMMING;  // LED_DIM_LINEAR / GAMMA / DITHER (Color565.h)
+  uint8_t renderMode  = DEFAULT_RENDER_MODE;  // RENDER_MODE_DELTA / RENDER_MODE_BAND
+
+  // LED color in 24-bit for web + convert to 565 for TFT
+  uint32_t ledColor = 0xFF0000; // red
+  uint8_t brightness = 255;     // 0..255
+
+  bool flipDisplay = false;    // false=rotation 1 (IO ports top, USB left), true=rotation 3 (180° flip)
+
+  // Morphing animation speed (multiplier: 1=fast, 10=very slow)
+  uint8_t morphSpeed = 1;      // 1-10, controls digit morphing duration
+  uint8_t morphStyle = DEFAULT_MORPH_STYLE;  // 7-segment transition: MORPH_STYLE_SPAWN / PAIRS (MorphPairs.h)
+
+  // Clock display mode settings
+  uint8_t clockMode = DEFAULT_CLOCK_MODE;           // 0=7-seg, 1=Tetris, 2=Morph Remix
+  bool autoRotate = DEFAULT_AUTO_ROTATE;            // Auto-rotate through modes
+  uint8_t rotateInterval = DEFAULT_ROTATE_INTERVAL; // Minutes between rotations
+
+  // Sensor settings
+  bool useFahrenheit = false;   // false=Celsius, true=Fahrenheit
+
+  // Morphing (Remix) mode display options
+  bool morphShowSensor = true;  // Show sensor data at top in Morph Remix mode
+  bool morphShowDate = true;    // Show date at bottom in Morph Remix mode
+  uint32_t morphSensorColor = 0xFFFF00;  // Sensor text color (default: yellow)
+  uint32_t morphDateColor = 0xFFFF00;    // Date text color (default: yellow)
+
+  // Touch calibration offsets (for fine-tuning touch coordinate mapping)
+  int16_t touchOffsetX = 0;     // X offset adjustment (-50 to +50)
+  int16_t touchOffsetY = 0;     // Y offset adjustment (-50 to +50)
+};
+
+extern AppConfig cfg;
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * BitPlane - 1-bit-per-LED framebuffer for single-color clock modes
+ *
+ * A BitPlane holds one bit per LED (256 bytes for 64x32), packed MSB-left
+ * like Bitmap rows, so clearing it, OR-ing glyph rows into it and comparing
+ * two of them are 32-LEDs-at-a-time word operations.
+ *
+ * A BitFrame is a small palette of planes, one per RGB565 color in use (the
+ * 7-segment clock needs the LED color and, during a spawn morph, its faded
+ * alpha color). resolveBitFrame() XORs a frame against the previous one and
+ * converts to RGB565 only the LEDs that changed, writing them into fb; the
+ * rest of the render pipeline keeps working on fb unchanged.
+ *
+ * Header-only so the firmware, the simulator and the host benchmarks
+ * (bench/) share it.
+ */
+
+#define BITPLANE_WORDS  (LED_MATRIX_W / 32)  // 32-bit words per LED row
+#define BITFRAME_PLANES 4                   // Colors per BitFrame
+
+static_assert(LED_MATRIX_W % 32 == 0, "BitPlane rows must be whole 32-bit words");
+
+struct BitPlane {
+  uint32_t rows[LED_MATRIX_H][BITPLANE_WORDS];  // Bit 31 of word 0 is x = 0
+
+  void clear() { memset(rows, 0, sizeof(rows)); }
+
+  // Light one LED (clipped)
+  void set(int x, int y) {
+    if (x < 0 || y < 0 || x >= LED_MATRIX_W || y >= LED_MATRIX_H) return;
+    rows[y][x >> 5] |= 0x80000000u >> (x & 31);
+  }
+
+  /**
+   * OR the left w bits of a 16-bit MSB-left row (Bitmap::rows) in at x0 (clipped)
+   */
+  void orRow(int y, uint16_t bits, int x0, int w) {
+    if (y < 0 || y >= LED_MATRIX_H || x0 >= LED_MATRIX_W || w <= 0) return;
+    if (w > 16) w = 16;
+    uint32_t v = (uint32_t)(bits & (uint16_t)(0xFFFF << (16 - w))) << 16;  // MSB-aligned
+    if (x0 < 0) {
+      if (x0 <= -16) return;
+      v <<= -x0;
+      x0 = 0;
+    }
+    const int wi = x0 >> 5;
+    const int sh = x0 & 31;
+    rows[y][wi] |= v >> sh;
+    if (sh > 16 && wi + 1 < BITPLANE_WORDS) rows[y][wi + 1] |= v << (32 - sh);
+  }
+};
+
+struct BitFrame {
+  BitPlane planes[BITFRAME_PLANES];
+  uint16_t colors[BITFRAME_PLANES];
+  uint8_t used = 0;
+
+  // Drop all planes (each is cleared when it is handed out again)
+  void clear() { used = 0; }
+
+  /**
+   * Plane for an RGB565 color, allocated on first use
+   * @return nullptr if all BITFRAME_PLANES are taken by other colors
+   */
+  BitPlane* plane(uint16_t color) {
+    for (uint8_t k = 0; k < used; k++) {
+      if (colors[k] == color) return &planes[k];
+    }
+    if (used == BITFRAME_PLANES) return nullptr;
+    colors[used] = color;
+    planes[used].clear();
+    return &planes[used++];
+  }
+};
+
+/**
+ * Write the LEDs that differ between two bit frames into an RGB565 framebuffer
+ * out must hold prev (or be all black if prev is nullptr). Where planes
+ * overlap, the last allocated plane wins; LEDs in no plane are black.
+ * @param cur Frame to show
+ * @param prev Frame out currently holds, or nullptr for an all-black out
+ * @param out RGB565 framebuffer (fb)
+ * @return Number of LEDs written
+ */
+static inline uint32_t resolveBitFrame(const BitFrame& cur, const BitFrame* prev, uint16_t (*out)[LED_MATRIX_W]) {
+  const uint8_t prevUsed = prev ? prev->used : 0;
+  const uint8_t planes = cur.used > prevUsed ? cur.used : prevUsed;
+  uint32_t written = 0;
+
+  for (int y = 0; y < LED_MATRIX_H; y++) {
+    for (int i = 0; i < BITPLANE_WORDS; i++) {
+      // LEDs whose plane bits changed, or whose plane changed color
+      uint32_t changed = 0;
+      for (uint8_t k = 0; k < planes; k++) {
+        const uint32_t c = k < cur.used ? cur.planes[k].rows[y][i] : 0;
+        const uint32_t p = k < prevUsed ? prev->planes[k].rows[y][i] : 0;
+        const bool sameColor = k < cur.used && k < prevUsed && cur.colors[k] == prev->colors[k];
+        changed |= sameColor ? (c ^ p) : (c | p);
+      }
+
+      while (changed) {
+        const int b = __builtin_clz(changed);
+        const uint32_t bit = 0x80000000u >> b;
+        changed &= ~bit;
+
+        uint16_t color = 0;
+        for (int k = cur.used - 1; k >= 0; k--) {
+          if (cur.planes[k].rows[y][i] & bit) { color = cur.colors[k]; break; }
+        }
+        out[y][i * 32 + b] = color;
+        written++;
+      }
+    }
+  }
+  return written;
+}
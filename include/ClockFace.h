@@ -0,0 +1,149 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "MorphingDigit.h"
+
+/**
+ * ClockFace - clock mode rendering into the 64x32 LED framebuffer
+ *
+ * Everything here draws into fb only: no TFT, network or RTC access. The
+ * firmware feeds it the time via clockSetTime() and pushes fb to the TFT;
+ * the host simulator (env:native, see sim/) does the same against stubs.
+ */
+
+class TetrisClock;
+
+// Logical RGB LED Matrix (HUB75) framebuffer: RGB565 color
+// Code outside the clock modes that draws into fb must start with fbClear():
+// the 7-segment mode otherwise assumes fb still holds its last frame and only
+// rewrites the LEDs that changed (ENABLE_BITPLANE_FB).
+alignas(4) extern uint16_t fb[LED_MATRIX_H][LED_MATRIX_W];  // Aligned for diffFrames()
+
+// Clock state
+extern char prevT[7];           // Previous time "HHMMSS"
+extern char currT[7];           // Current time "HHMMSS"
+extern char currDate[14];       // Formatted date (13 chars for "Mon DD, YYYY" format + null)
+extern int morphStep;           // Morphing (Classic) animation step since last change
+extern bool clockColon;         // Colon blink state
+extern unsigned long lastMorphUpdate;  // Last morphing animation update time
+
+// Tetris clock instance (created in setup)
+extern TetrisClock* tetrisClock;
+
+// Morphing clock digits (for CLOCK_MODE_MORPH)
+extern MorphingDigit morphHourTens, morphHourUnits;
+extern MorphingDigit morphMinuteTens, morphMinuteUnits;
+extern MorphingDigit morphSecondTens, morphSecondUnits;
+
+// Sensor readings shown by Morphing (Remix) mode (owned by the sensor code)
+extern bool sensorAvailable;
+extern uint8_t sensorMeasures;  // SENSOR_* flags (SensorDriver.h)
+extern int temperature;
+extern int humidity;
+extern int pressure;
+
+/**
+ * Convert 24-bit RGB (0xRRGGBB) to 16-bit RGB565 format for TFT display
+ */
+uint16_t rgb888_to_565(uint32_t rgb);
+
+// Framebuffer helpers
+void fbClear(uint16_t color = 0);
+void fbSet(int x, int y, uint16_t color);
+
+// 3x5 font text (clipped to the framebuffer)
+int getTextWidth3x5(const char* text);
+void drawText3x5(const char* text, int x, int y, uint16_t color);
+
+// =========================
+// 7-Segment digit bitmaps
+// =========================
+static const int DIGIT_W = 9;       // Width of each digit in pixels (9px fits HH:MM:SS with gaps in 64px)
+static const int DIGIT_H = LED_MATRIX_H;  // Height matches full matrix height (32px)
+static const int COLON_W = 2;       // Width of colon separator
+static const int DIGIT_GAP = 1;     // 1px gap between digits for improved readability
+
+struct Bitmap {
+  uint16_t rows[DIGIT_H];  // each row is 16 bits, MSB left
+};
+
+struct Pt { int8_t x, y; };
+
+/**
+ * Initialize all digit and colon bitmaps
+ * Called once during setup to pre-render all characters
+ */
+void initBitmaps();
+
+/**
+ * Set the displayed time
+ * @param t6 Time as "HHMMSS" (already in 12/24h format)
+ * @return true if the time differs from the current one (starts a morph)
+ */
+bool clockSetTime(const char* t6);
+
+// =========================
+// Drawing primitives (used by the clock modes; public for bench/)
+// =========================
+
+// Bitmap for digit d (0-9), valid after initBitmaps()
+const Bitmap& digitBitmap(uint8_t d);
+
+/**
+ * Collect the ON pixels of a bitmap
+ * @return Number of ON pixels (may exceed maxOut; only maxOut are stored)
+ */
+int buildPixelsFromBitmap(const Bitmap& bm, int w, Pt* out, int maxOut);
+
+/**
+ * Draw a bitmap in cfg.ledColor scaled by intensity (0-255)
+ */
+void drawBitmapSolid(const Bitmap& bm, int x0, int y0, int w, uint8_t intensity = 255);
+
+/**
+ * Draw step (0..MORPH_STEPS) of the "spawn" morph into a bitmap
+ */
+void drawSpawnMorphToTarget(const Bitmap& toBm, int step, int x0, int y0, int w);
+
+/**
+ * drawSpawnMorphToTarget() for digit d (0-9) from its precomputed step table
+ * The table is built on the digit's first morph; falls back to computing the
+ * step if memory is short.
+ */
+void drawSpawnMorphDigit(uint8_t d, int step, int x0, int y0);
+
+// Heap used by the spawn morph step tables built so far
+size_t morphTableBytes();
+
+/**
+ * Draw step (0..MORPH_STEPS) of the pixel-pair morph from digit `from` to
+ * digit `to` (see MorphPairs.h); spawn morph if the digits are equal
+ */
+void drawPairMorph(uint8_t from, uint8_t to, int step, int x0, int y0);
+
+/**
+ * Draw one LED dot with a 4-neighbour glow (Morphing Remix segments)
+ */
+void drawLEDDot(int x, int y, uint16_t color, uint8_t brightness);
+
+/**
+ * Draw a segment as numLEDs evenly spaced LED dots
+ */
+void drawLEDSegmentDots(int x1, int y1, int x2, int y2, int numLEDs, uint8_t brightness, uint16_t color);
+
+// Clock mode renderers (each clears and redraws fb)
+void drawFrame();        // CLOCK_MODE_7SEG
+void drawFrameTetris();  // CLOCK_MODE_TETRIS
+void drawFrameMorph();   // CLOCK_MODE_MORPH
+
+/**
+ * Render the current clock mode (cfg.clockMode)
+ */
+void renderCurrentMode();
+
+/**
+ * Check if current mode needs continuous updates (for animations)
+ * @return true if mode is animating and needs frequent updates
+ */
+bool modeNeedsAnimation();
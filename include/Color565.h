@@ -0,0 +1,114 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Color565 - RGB565 brightness scaling without per-channel divides
+ *
+ * scale565() multiplies all three channels of an RGB565 color by level/255
+ * with a single 32-bit multiply: the color is spread so that green sits in
+ * the upper half-word with five spare bits above each channel (SWAR), scaled
+ * by a 0-32 factor and folded back. Level 255 returns the color unchanged and
+ * level 0 black; in between every channel is within one LSB of
+ * round(channel * level / 255), which is below what a 5- or 6-bit channel
+ * can show anyway.
+ *
+ * dim565() puts a brightness curve in front of that (cfg.ledDimming): levels
+ * are either linear intensity, or perceptual and mapped through a gamma 2.2
+ * table, optionally with 4x4 ordered dithering of the part of a channel that
+ * falls between two 5/6-bit steps, so slow fades and faint glows do not
+ * band.
+ *
+ * All per-pixel brightness, fade and alpha scaling in the clock modes goes
+ * through here. Header-only so the firmware, the simulator and the host
+ * benchmarks (bench/) inline the same code.
+ */
+
+// LED dimming curves (cfg.ledDimming)
+#define LED_DIM_LINEAR 0   // Level is linear intensity
+#define LED_DIM_GAMMA  1   // Level is perceptual brightness (gamma 2.2)
+#define LED_DIM_DITHER 2   // Gamma 2.2 plus ordered dithering across the LED grid
+
+/**
+ * Scale an RGB565 color by level/255
+ * @param color RGB565 color
+ * @param level Brightness 0-255 (255 = unchanged)
+ */
+static inline uint16_t scale565(uint16_t color, uint8_t level) {
+  const uint32_t s = (level + 4) >> 3;  // 0..32 (255 -> 32 = unchanged)
+
+  // -----GGGGGG-----RRRRR------BBBBB: each field has room for a 5-bit factor
+  uint32_t x = (color | ((uint32_t)color << 16)) & 0x07E0F81F;
+  x = ((x * s + 0x02008010) >> 5) & 0x07E0F81F;  // +16 per field rounds to nearest
+  return (uint16_t)(x | (x >> 16));
+}
+
+/**
+ * Convert a 0.0-1.0 intensity to a scale565() level
+ */
+static inline uint8_t level565(float k) {
+  if (k <= 0.0f) return 0;
+  if (k >= 1.0f) return 255;
+  return (uint8_t)(k * 255.0f + 0.5f);
+}
+
+/**
+ * Scale an RGB565 color by level/256 with a chosen rounding threshold
+ * Two multiplies (red+blue packed, green alone) keep all 256 levels, so the
+ * low end of the gamma curve is not lost to scale565()'s 33 steps.
+ * @param color RGB565 color
+ * @param level 0-255 (255 = unchanged)
+ * @param threshold Added to the 8 fraction bits of each channel before
+ *                  truncating: 128 rounds to nearest, a dither matrix
+ *                  entry dithers
+ */
+static inline uint16_t scale565Fine(uint16_t color, uint8_t level, uint8_t threshold) {
+  const uint32_t s = level + (level >> 7);  // 0..256
+
+  // R at bits 16-20, B at bits 0-4: products stay below 2^13, no carries
+  const uint32_t rb = ((((uint32_t)(color & 0xF800) << 5) | (color & 0x001F)) * s) + threshold * 0x00010001u;
+  const uint32_t g = ((uint32_t)(color & 0x07E0) * s) + ((uint32_t)threshold << 5);
+
+  return (uint16_t)(((rb >> 13) & 0xF800) | ((g >> 8) & 0x07E0) | ((rb >> 8) & 0x001F));
+}
+
+// Perceptual level -> linear level: round(255 * (i / 255)^2.2)
+static const uint8_t GAMMA22[256] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+    3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+    6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+   12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+   20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+   30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+   42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+   56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+   73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+   91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+  113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+  137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+  163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+  192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+  223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+
+// 4x4 Bayer matrix as scale565Fine() thresholds (8..248)
+static const uint8_t BAYER4[4][4] = {
+  {  8, 136,  40, 168},
+  {200,  72, 232, 104},
+  { 56, 184,  24, 152},
+  {248, 120, 216,  88},
+};
+
+/**
+ * Dim an RGB565 color through a brightness curve
+ * @param color RGB565 color
+ * @param level Brightness 0-255 (255 = unchanged for every curve)
+ * @param curve LED_DIM_LINEAR / LED_DIM_GAMMA / LED_DIM_DITHER
+ * @param x, y LED position (selects the dither threshold)
+ */
+static inline uint16_t dim565(uint16_t color, uint8_t level, uint8_t curve, int x, int y) {
+  if (curve == LED_DIM_LINEAR) return scale565(color, level);
+  const uint8_t threshold = (curve == LED_DIM_DITHER) ? BAYER4[y & 3][x & 3] : 128;
+  return scale565Fine(color, GAMMA22[level], threshold);
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * DirtyRects - coalesce changed LEDs into same-color rectangles
+ *
+ * Changed LEDs are grouped into runs of identical color per row, and runs that
+ * repeat exactly (same x, width and color) on the following rows are grown into
+ * rectangles. Each rectangle costs one TFT address window instead of one per LED,
+ * so a full repaint (mode switch, info page exit) drops from up to 2048 windows
+ * to a few dozen.
+ *
+ * The diff itself runs two LEDs (one 32-bit word) at a time and produces a
+ * FrameDiff: a bitmask of rows with changes plus a changed-column mask per
+ * row. Coalescing then only visits changed LEDs, an unchanged frame costs one
+ * pass of word compares, and the caller can refresh its previous-frame copy
+ * row by row (copyDirtyRows()).
+ *
+ * Header-only so the firmware renderer and the host benchmarks (bench/) run
+ * the same diff.
+ */
+
+static_assert(LED_MATRIX_H <= 32 && LED_MATRIX_W <= 64 && LED_MATRIX_W % 2 == 0,
+              "FrameDiff masks hold 32 rows of up to 64 LEDs");
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "diffFrames() pairs LEDs in little-endian words");
+
+/**
+ * A rectangle of changed LEDs sharing one color (LED coordinates)
+ */
+struct DirtyRect {
+  uint8_t x, y;     // Top-left LED
+  uint8_t w, h;     // Size in LEDs
+  uint16_t color;   // RGB565
+};
+
+/**
+ * Which LEDs differ between two frames
+ */
+struct FrameDiff {
+  uint32_t rows;                  // Bit y: row y has changed LEDs
+  uint64_t cols[LED_MATRIX_H];    // Bit x: LED (x, y) changed (rows not in `rows` are 0)
+  uint32_t changed;               // Changed LEDs in total
+};
+
+/**
+ * Compare cur against prev, 32 bits (two LEDs) at a time
+ * Both frames must be 4-byte aligned (fb and fbPrev are declared alignas(4)).
+ */
+static inline void diffFrames(const uint16_t (*cur)[LED_MATRIX_W], const uint16_t (*prev)[LED_MATRIX_W], FrameDiff& d) {
+  d.rows = 0;
+  d.changed = 0;
+
+  for (int y = 0; y < LED_MATRIX_H; y++) {
+    const uint16_t* c = (const uint16_t*)__builtin_assume_aligned(cur[y], 4);
+    const uint16_t* p = (const uint16_t*)__builtin_assume_aligned(prev[y], 4);
+    uint64_t mask = 0;
+
+    for (int x = 0; x < LED_MATRIX_W; x += 2) {
+      uint32_t a, b;
+      memcpy(&a, c + x, sizeof(a));  // Single aligned load; memcpy keeps it alias-safe
+      memcpy(&b, p + x, sizeof(b));
+      const uint32_t diff = a ^ b;
+      if (!diff) continue;
+      if (diff & 0xFFFF) mask |= 1ULL << x;  // LED x is the low half-word
+      if (diff >> 16) mask |= 2ULL << x;
+    }
+
+    d.cols[y] = mask;
+    if (mask) {
+      d.rows |= 1u << y;
+      d.changed += __builtin_popcountll(mask);
+    }
+  }
+}
+
+/**
+ * Emit every completed rectangle of changed LEDs
+ * Rectangles are emitted top to bottom as they stop growing, so emit() can
+ * start drawing while the diff is still running.
+ * @param cur Frame to draw
+ * @param d diffFrames() of cur against the frame currently on screen
+ * @param emit Callable taking const DirtyRect&
+ * @return Number of changed LEDs
+ */
+template <typename Emit>
+uint32_t collectDirtyRects(const uint16_t (*cur)[LED_MATRIX_W], const FrameDiff& d, Emit&& emit) {
+  DirtyRect open[LED_MATRIX_W];  // Rects still growing downwards, sorted by x
+  DirtyRect next[LED_MATRIX_W];
+  int openN = 0;
+
+  for (int y = 0; y < LED_MATRIX_H; y++) {
+    if (!openN && !(d.rows >> y)) break;  // Nothing open, nothing changed below
+
+    uint64_t mask = d.cols[y];
+    int nextN = 0;
+    int oi = 0;
+
+    while (mask) {
+      // Run of changed LEDs with identical color
+      const int start = __builtin_ctzll(mask);
+      const uint16_t color = cur[y][start];
+      int x = start + 1;
+      while (x < LED_MATRIX_W && ((mask >> x) & 1) && cur[y][x] == color) x++;
+      mask = (x < 64) ? (mask & (~0ULL << x)) : 0;
+
+      // Open rects left of this run cannot continue - emit them
+      while (oi < openN && open[oi].x < start) emit(open[oi++]);
+
+      if (oi < openN && open[oi].x == start && open[oi].w == x - start && open[oi].color == color) {
+        next[nextN] = open[oi++];  // Same run as the row above: grow downwards
+        next[nextN].h++;
+      } else {
+        next[nextN] = DirtyRect{(uint8_t)start, (uint8_t)y, (uint8_t)(x - start), 1, color};
+      }
+      nextN++;
+    }
+
+    // Anything not continued on this row is complete
+    while (oi < openN) emit(open[oi++]);
+
+    memcpy(open, next, nextN * sizeof(DirtyRect));
+    openN = nextN;
+  }
+
+  for (int i = 0; i < openN; i++) emit(open[i]);
+  return d.changed;
+}
+
+/**
+ * Diff cur against prev and emit every completed rectangle
+ * (diffFrames() followed by collectDirtyRects() on the result)
+ * @return Number of changed LEDs
+ */
+template <typename Emit>
+uint32_t collectDirtyRects(const uint16_t (*cur)[LED_MATRIX_W], const uint16_t (*prev)[LED_MATRIX_W], Emit&& emit) {
+  FrameDiff d;
+  diffFrames(cur, prev, d);
+  return collectDirtyRects(cur, d, emit);
+}
+
+/**
+ * Copy the rows of src that changed into dst (dst was the diff's prev)
+ */
+static inline void copyDirtyRows(uint16_t (*dst)[LED_MATRIX_W], const uint16_t (*src)[LED_MATRIX_W], const FrameDiff& d) {
+  for (uint32_t rows = d.rows; rows; rows &= rows - 1) {
+    const int y = __builtin_ctz(rows);
+    memcpy(dst[y], src[y], sizeof(dst[y]));
+  }
+}
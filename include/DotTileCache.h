@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+
+// LED dot shapes (cfg.ledShape)
+#define LED_SHAPE_SQUARE 0   // Flat square dot (drawn with coalesced fillRect, no tiles)
+#define LED_SHAPE_ROUND  1   // Anti-aliased round dot
+#define LED_SHAPE_GLOW   2   // Round dot with a soft halo into the gap
+
+/**
+ * DotTileCache - pre-rendered LED dot tiles for realistic LED rendering
+ *
+ * Drawing a round or glowing LED per pixel is far too slow for the TFT path,
+ * so each (color, shape, dot size, cell pitch) combination is rendered once
+ * into a cell-sized RGB565 tile and blitted with a single pushImage().
+ *
+ * Tiles live in a fixed memory pool (budget set at construction) split into
+ * equal slots for the current cell size. When the pool is full the least
+ * recently used tile is evicted. A change of cell pitch re-slices the pool,
+ * dropping every tile.
+ */
+class DotTileCache {
+public:
+    explicit DotTileCache(size_t budgetBytes);
+    ~DotTileCache();
+
+    /**
+     * Get the tile for one LED cell, rendering it on a miss
+     * @param color LED color (RGB565)
+     * @param shape LED_SHAPE_ROUND or LED_SHAPE_GLOW
+     * @param dot Dot diameter in pixels
+     * @param pitchX Cell width in pixels (tile width)
+     * @param pitchY Cell height in pixels (tile height)
+     * @return pitchX*pitchY RGB565 pixels, or nullptr if one tile exceeds the budget
+     */
+    uint16_t* get(uint16_t color, uint8_t shape, uint8_t dot, uint8_t pitchX, uint8_t pitchY);
+
+    // Drop all tiles (call when the render pitch changes)
+    void invalidate();
+
+    // Statistics
+    uint32_t hits() const { return _hits; }
+    uint32_t misses() const { return _misses; }
+    uint32_t evictions() const { return _evictions; }
+    uint16_t used() const { return _used; }
+    uint16_t capacity() const { return _slots; }
+    size_t budget() const { return _budget; }
+
+private:
+    struct Entry {
+        uint32_t key;       // color | shape | dot (pitch is fixed per pool layout)
+        uint32_t lastUsed;  // LRU tick
+    };
+
+    uint16_t* _pool;        // Tile pixels (budget bytes)
+    Entry* _entries;        // One entry per slot
+    size_t _budget;
+    uint16_t _slots;        // Slots for the current tile size
+    uint16_t _used;         // Slots holding a tile
+    uint8_t _tileW, _tileH; // Current tile size (0 = not laid out)
+    uint16_t _mru;          // Most recently used slot (fast path for runs of one color)
+    uint32_t _tick;
+
+    uint32_t _hits, _misses, _evictions;
+
+    // Re-slice the pool for a new tile size
+    void layout(uint8_t tileW, uint8_t tileH);
+
+    // Render a tile into the given slot
+    void render(uint16_t* tile, uint16_t color, uint8_t shape, uint8_t dot) const;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * I2CBus - owner of the shared I2C bus (Wire on GPIO21/22)
+ *
+ * The touch controller and the sensor share one bus. After I2CBus::begin()
+ * only the bus task touches Wire: other tasks queue jobs (a function that
+ * runs on the bus task and may use Wire freely) and either wait for them
+ * (run(), from background tasks) or poll an I2CRequest on a later tick
+ * (submit()). Touch jobs are queued ahead of sensor jobs; a job already on
+ * the bus is never interrupted.
+ *
+ * Per device, the bus keeps job and error counts and the time jobs waited in
+ * the queue and spent on the bus (/api/perf). Nothing on the render path
+ * may use I2C.
+ */
+
+// Devices on the bus (for statistics)
+enum I2CDevice : uint8_t {
+    I2C_DEV_TOUCH = 0,      // FT6206 touch controller
+    I2C_DEV_SENSOR,         // Temperature/humidity/pressure sensor
+    I2C_DEV_COUNT
+};
+
+// Queue order: every queued high-priority job runs before any low-priority one
+enum I2CPriority : uint8_t {
+    I2C_PRIO_HIGH = 0,      // Touch
+    I2C_PRIO_LOW,           // Sensors
+    I2C_PRIO_COUNT
+};
+
+/**
+ * Bus job: runs on the bus task with exclusive use of Wire
+ * @return false on a bus or device error (counted per device)
+ */
+typedef bool (*I2CJobFn)(void* arg);
+
+// Completion of a submit()ted job, written by the bus task
+struct I2CRequest {
+    volatile bool done;
+    volatile bool ok;
+};
+
+struct I2CDeviceStats {
+    uint32_t jobs;
+    uint32_t errors;
+    uint64_t totalWaitUs;   // Queued until started
+    uint32_t maxWaitUs;
+    uint64_t totalRunUs;    // On the bus
+    uint32_t maxRunUs;
+};
+
+namespace I2CBus {
+
+    // Start Wire and the bus task (call once from setup, before any job)
+    void begin(int sda, int scl);
+
+    /**
+     * Queue a job and return immediately
+     * @param req Set to done (with the job's result in ok) once the job ran; may be nullptr
+     * @return false if the priority's queue is full (req is then left untouched)
+     */
+    bool submit(I2CDevice device, I2CPriority prio, I2CJobFn fn, void* arg, I2CRequest* req = nullptr);
+
+    /**
+     * Queue a job and block until it has run (not from the bus task)
+     * @return The job's result, false if it could not be queued
+     */
+    bool run(I2CDevice device, I2CPriority prio, I2CJobFn fn, void* arg = nullptr);
+
+    const I2CDeviceStats& stats(I2CDevice device);
+    const char* name(I2CDevice device);
+
+    // Clear all statistics
+    void resetStats();
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * MirrorStream - delta-encoded framebuffer stream for WebSocket mirror clients
+ *
+ * Each client gets frames encoded against the last frame it acknowledged, so
+ * only changed LEDs cross the network. At most one frame is in flight per
+ * client: a slow browser simply skips intermediate frames instead of queueing
+ * them, and every delta applies to a frame the client is known to hold.
+ *
+ * WIRE FORMAT (binary, little-endian):
+ *   Keyframe  'K' seq:u32 pixels:u16[LED_MATRIX_W*LED_MATRIX_H]   (RGB565, row-major)
+ *   Delta     'D' seq:u32 base:u32 runs:u16 { start:u16 len:u8 color:u16 } * runs
+ *   Ack       'A' seq:u32                                          (client -> server)
+ *
+ * A run sets len consecutive LEDs (row-major index start..start+len-1) to one
+ * color. A delta that would be larger than a keyframe is sent as a keyframe.
+ * A client that has not acknowledged within MIRROR_ACK_TIMEOUT_MS is resynced
+ * with a keyframe.
+ *
+ * Transport-agnostic: main.cpp feeds it WebSocket events and sends what
+ * encode() produces.
+ */
+
+#define MIRROR_MSG_KEYFRAME 'K'
+#define MIRROR_MSG_DELTA    'D'
+#define MIRROR_MSG_ACK      'A'
+
+class MirrorStream {
+public:
+    static const size_t FRAME_PIXELS = LED_MATRIX_W * LED_MATRIX_H;
+    static const size_t KEYFRAME_BYTES = 5 + FRAME_PIXELS * sizeof(uint16_t);
+    static const size_t MAX_MESSAGE = KEYFRAME_BYTES;  // Size of encode()'s output buffer
+
+    MirrorStream();
+    ~MirrorStream();
+
+    /**
+     * Start streaming to a client (allocates its frame copies)
+     * @return false if the id is out of range or memory is short
+     */
+    bool open(uint8_t client);
+
+    // Stop streaming to a client and free its state
+    void close(uint8_t client);
+
+    /**
+     * Handle a message from a client
+     * @return false if the message is not a valid ack
+     */
+    bool receive(uint8_t client, const uint8_t* data, size_t len);
+
+    /**
+     * Encode the next message for a client
+     * @param client Client id
+     * @param frame Latest frame (FRAME_PIXELS RGB565 values)
+     * @param frameId Changes whenever frame does (e.g. TripleBuffer::published())
+     * @param nowMs Current time for the ack timeout
+     * @param out Buffer of at least MAX_MESSAGE bytes
+     * @return Bytes to send, or 0 if there is nothing to send
+     */
+    size_t encode(uint8_t client, const uint16_t* frame, uint32_t frameId, uint32_t nowMs, uint8_t* out);
+
+    // Statistics
+    uint8_t clients() const { return _open; }
+    uint32_t keyframes() const { return _keyframes; }
+    uint32_t deltas() const { return _deltas; }
+    uint32_t bytesSent() const { return _bytesSent; }
+    uint32_t bytesRaw() const { return _bytesRaw; }   // What full frames would have cost
+
+private:
+    struct Client {
+        uint16_t* acked;      // Frame the client confirmed (delta base)
+        uint16_t* inFlight;   // Frame sent, awaiting ack
+        uint32_t ackedSeq;
+        uint32_t inFlightSeq;
+        uint32_t sentAt;      // millis() when inFlight was sent
+        uint32_t frameId;     // Frame last encoded for this client
+        bool hasBase;         // acked holds a frame
+        bool waiting;         // A frame is in flight
+    };
+
+    Client _clients[MIRROR_WS_MAX_CLIENTS];
+    uint32_t _seq;
+    uint8_t _open;
+
+    uint32_t _keyframes, _deltas, _bytesSent, _bytesRaw;
+
+    size_t encodeKeyframe(const uint16_t* frame, uint32_t seq, uint8_t* out) const;
+
+    // Returns 0 if the delta would not be smaller than a keyframe
+    size_t encodeDelta(const Client& c, const uint16_t* frame, uint32_t seq, uint8_t* out) const;
+};
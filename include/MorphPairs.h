@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * MorphPairs - precomputed pixel pairings for the 7-segment digit morph
+ *
+ * For each of the 45 unordered digit pairs, every ON pixel of the lower digit
+ * is paired with an ON pixel of the higher digit so that the total squared
+ * distance travelled is minimal (an optimal assignment, solved offline by
+ * tools/gen_morph_pairs.py into src/MorphPairs.cpp). Where one glyph has
+ * fewer pixels its pixels are used more than once, so pixels split and merge
+ * but every LED of both digits is covered. The reverse morph walks the same
+ * pairs backwards.
+ *
+ * A morph frame interpolates each pair: the cost per frame is constant (up to
+ * 252 pairs per digit) and the tables live in flash.
+ */
+
+// 7-segment digit transition (cfg.morphStyle)
+#define MORPH_STYLE_SPAWN 0   // New digit's pixels fly out of the glyph center and fade in
+#define MORPH_STYLE_PAIRS 1   // Old digit's pixels travel onto the new digit's
+
+#define MORPH_PAIR_TABLES 45  // One per unordered digit pair
+
+// One pixel pairing, from the lower digit to the higher digit
+struct MorphPair {
+  uint8_t fromX, fromY;
+  uint8_t toX, toY;
+};
+
+// All tables back to back; table t is MORPH_PAIRS[MORPH_PAIR_OFFSETS[t] .. MORPH_PAIR_OFFSETS[t+1]-1]
+extern const MorphPair MORPH_PAIRS[];
+extern const uint16_t MORPH_PAIR_OFFSETS[MORPH_PAIR_TABLES + 1];
+
+/**
+ * Table index for digits lo < hi (0-9)
+ */
+static inline uint8_t morphPairTable(uint8_t lo, uint8_t hi) {
+  return lo * (19 - lo) / 2 + (hi - lo - 1);
+}
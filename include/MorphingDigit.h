@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include "Tween.h"
 
 // Seven-segment digit representation
 // Segments labeled:
@@ -104,10 +105,10 @@ public:
     void update(unsigned long deltaMs);
 
     // Check if currently morphing
-    bool isMorphing() const { return _isMorphing; }
+    bool isMorphing() const { return _tween.active(); }
 
-    // Get current morph progress (0.0 = current digit, 1.0 = target digit)
-    float getProgress() const { return _progress; }
+    // Get current morph progress (Q16: 0 = current digit, Q16_ONE = target digit)
+    q16_t getProgress() const { return _tween.active() ? _tween.value() : 0; }
 
     // Get segment brightness for rendering (0-255)
     uint8_t getSegmentBrightness(uint8_t segment) const;
@@ -125,14 +126,8 @@ public:
 private:
     uint8_t _currentDigit;     // Current displayed digit (0-9)
     uint8_t _targetDigit;      // Target digit to morph to (0-9)
-    float _progress;           // Morph progress (0.0 to 1.0)
-    bool _isMorphing;          // Animation in progress flag
-    unsigned long _morphTime;  // Total time for morph (ms)
-    unsigned long _elapsed;    // Elapsed time (ms)
+    Tween _tween;              // Morph timeline (ease-in-out cubic)
 
     // Check if a segment is active for a given digit
     bool isSegmentActive(uint8_t digit, uint8_t segment) const;
-
-    // Apply easing function for smooth animation
-    float easeInOutCubic(float t) const;
 };
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * PerfStats - low-overhead timing instrumentation
+ *
+ * Code sections are timed with the CPU cycle counter (PERF_SCOPE) and
+ * accumulated per section: count, min/max/mean and a log2 histogram in
+ * microseconds. Frames are counted separately for FPS and changed LEDs per
+ * frame, and the render task's time between frames for its idle share.
+ *
+ * Each section must only be timed from one task; readers on other tasks may
+ * see a sample that is mid-update, which is fine for diagnostics.
+ *
+ * Compiled out entirely when ENABLE_PERF_STATS is 0.
+ */
+
+// Timed sections (index into the stats table)
+enum PerfSection : uint8_t {
+    PERF_RENDER_MODE = 0,   // renderCurrentMode()
+    PERF_RENDER_TFT,        // renderFBToTFT() (includes status bar)
+    PERF_STATUS_BAR,        // drawStatusBar()
+    PERF_HANDLE_CLIENT,     // Web request handlers (AsyncTCP task)
+    PERF_SENSOR_READ,       // One sensor measurement step (I2C bus task)
+    PERF_SECTION_COUNT
+};
+
+// Histogram bucket i counts samples in [2^(i-1), 2^i) us; bucket 0 is < 1 us,
+// the last bucket collects everything from 2^(PERF_HIST_BUCKETS-2) us upwards
+#define PERF_HIST_BUCKETS 16
+
+struct PerfStat {
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t totalUs;
+    uint32_t hist[PERF_HIST_BUCKETS];
+    uint32_t skipped;   // Samples dropped because the CPU clock changed mid-scope
+};
+
+namespace Perf {
+
+    // Record one timed sample (cycles measured on the calling core at cpuMHz).
+    // Dropped if the CPU frequency is no longer cpuMHz: frequency scaling
+    // switched mid-sample, so the cycles cannot be converted to time.
+    void record(PerfSection section, uint32_t cycles, uint32_t cpuMHz);
+
+    // Record a rendered frame and how many LEDs it changed
+    void frame(uint32_t changedLeds);
+
+    // Clear all statistics
+    void reset();
+
+    const PerfStat& stat(PerfSection section);
+    const char* name(PerfSection section);
+
+    // Frames per second over the last completed one-second window
+    float fps();
+
+    // Record time the render task spent waiting for its next frame
+    void idle(uint32_t us);
+
+    // Share of wall time (0-100 %) the render task waited, over the last
+    // completed one-second window
+    float idlePercent();
+
+    uint32_t frames();
+    uint32_t changedLedsLast();
+    uint32_t changedLedsMax();
+    float changedLedsMean();
+
+    // Lower edge of a histogram bucket in microseconds
+    uint32_t bucketFloorUs(uint8_t bucket);
+}
+
+#if ENABLE_PERF_STATS
+
+/**
+ * Times the enclosing scope and records it on destruction
+ */
+class PerfScope {
+public:
+    explicit PerfScope(PerfSection section)
+        : _section(section), _mhz(ESP.getCpuFreqMHz()), _start(ESP.getCycleCount()) {}
+    ~PerfScope() { Perf::record(_section, ESP.getCycleCount() - _start, _mhz); }
+
+private:
+    PerfSection _section;
+    uint32_t _mhz;      // CPU clock when the scope was entered
+    uint32_t _start;
+};
+
+#define PERF_CONCAT_(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_(a, b)
+#define PERF_SCOPE(section) PerfScope PERF_CONCAT(_perfScope, __LINE__)(section)
+#define PERF_FRAME(changedLeds) Perf::frame(changedLeds)
+#define PERF_IDLE(us) Perf::idle(us)
+
+#else
+
+#define PERF_SCOPE(section) do {} while (0)
+#define PERF_FRAME(changedLeds) do {} while (0)
+#define PERF_IDLE(us) do {} while (0)
+
+#endif
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * PowerScaling - CPU frequency scaling tied to render and web load
+ *
+ * Power::begin() enables ESP-IDF dynamic frequency scaling between
+ * POWER_MIN_MHZ and POWER_MAX_MHZ. Work that must run at full speed holds a
+ * CPU_FREQ_MAX PM lock per client: the render task from the decision to draw
+ * a frame until it next goes to sleep, and the web server until
+ * POWER_WEB_HOLD_MS after the last request. With no lock held (static
+ * display, no web traffic) the CPU drops to POWER_MIN_MHZ.
+ *
+ * Time at each CPU frequency is sampled by Power::tick() from the network
+ * task and served at /api/perf. Without CONFIG_PM_ENABLE in the SDK, or with
+ * ENABLE_POWER_SCALING 0, the CPU stays at its boot frequency and only the
+ * residency is tracked.
+ */
+
+// Clients that can hold the CPU at POWER_MAX_MHZ
+enum PowerClient : uint8_t {
+    POWER_RENDER = 0,   // Render task while frames are being drawn
+    POWER_WEB,          // HTTP requests (held POWER_WEB_HOLD_MS after the last one)
+    POWER_CLIENT_COUNT
+};
+
+#define POWER_FREQ_SLOTS 4  // Distinct CPU frequencies tracked for residency
+
+namespace Power {
+
+    // Configure frequency scaling and create the PM locks (call once from setup)
+    void begin();
+
+    // Hold the CPU at POWER_MAX_MHZ for a client (no-op if it already holds it)
+    void boost(PowerClient client);
+
+    // Drop a client's hold (no-op if it holds none)
+    void release(PowerClient client);
+
+    // An HTTP request arrived: boost now, release POWER_WEB_HOLD_MS after the last one
+    void webActivity();
+
+    // Network task housekeeping: expire the web hold and sample the CPU frequency
+    void tick();
+
+    // Clear the residency and boost counters
+    void resetStats();
+
+    // true if dynamic frequency scaling is active
+    bool scaling();
+
+    // Frequencies seen so far (slots 0..freqSlots()-1) and the time spent at each
+    uint8_t freqSlots();
+    uint32_t freqMHz(uint8_t slot);
+    uint64_t freqMs(uint8_t slot);
+
+    // Times a client raised the clock
+    uint32_t boosts(PowerClient client);
+    const char* name(PowerClient client);
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * SensorDriver - non-blocking temperature/humidity/pressure sensor drivers
+ *
+ * A measurement is a short sequence of I2C steps separated by conversion
+ * time: start() triggers a conversion and returns how long it takes, and
+ * each step() collects what is ready and either finishes or starts the next
+ * conversion. Nothing waits on the sensor; the caller schedules the next
+ * step (see sensorPoll() in main.cpp). BME280 and BMP280 run in forced mode
+ * so each measurement is triggered explicitly.
+ *
+ * Sensors are found at runtime: Sensors::scan() probes the addresses the
+ * supported sensors can use and binds a driver to every device that answers
+ * with the right identity, so one firmware image serves every clock variant.
+ *
+ * All driver methods use Wire and must run on the I2C bus task (I2CBus.h).
+ */
+
+#define SENSOR_MAX_DEVICES 4   // Sensors bound by Sensors::scan()
+
+// What a sensor measures (SensorDriver::measures())
+#define SENSOR_TEMPERATURE 0x01
+#define SENSOR_HUMIDITY    0x02
+#define SENSOR_PRESSURE    0x04
+
+// One measurement; NAN where not measured
+struct SensorReading {
+    float temp;     // °C
+    float hum;      // %RH
+    float pres;     // hPa
+};
+
+class SensorDriver {
+public:
+    virtual ~SensorDriver() {}
+
+    virtual const char* name() const = 0;
+    virtual uint8_t measures() const = 0;  // SENSOR_* flags
+
+    // Check the device at addr is this sensor and configure it
+    // @return false if it is not (or not responding)
+    virtual bool begin(uint8_t addr) = 0;
+
+    /**
+     * Trigger a measurement
+     * @return ms until step() should be called, or -1 on a bus error
+     */
+    virtual int32_t start() = 0;
+
+    /**
+     * Continue a measurement started by start()
+     * @param out Receives the values collected so far
+     * @return ms until the next step(), 0 when out is complete, or -1 on error
+     */
+    virtual int32_t step(SensorReading& out) = 0;
+
+    // I2C address bound by begin()
+    uint8_t address() const { return _addr; }
+
+protected:
+    uint8_t _addr = 0;
+};
+
+namespace Sensors {
+
+    /**
+     * Scan the bus and bind a driver to each supported sensor found
+     * Only the supported sensors' addresses are probed. Call once (I2C bus job).
+     * @return Number of sensors bound
+     */
+    uint8_t scan();
+
+    uint8_t count();
+    SensorDriver* get(uint8_t index);
+
+    // SENSOR_* flags measured by any bound sensor
+    uint8_t measures();
+
+    /**
+     * Merge one reading per bound sensor into one
+     * Each value comes from the most accurate sensor that measured it; sensors
+     * whose valid[] entry is false are skipped.
+     */
+    SensorReading merge(const SensorReading* readings, const bool* valid);
+}
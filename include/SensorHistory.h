@@ -0,0 +1,97 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "SensorDriver.h"
+
+/**
+ * SensorHistory - fixed-memory sensor time series in three resolutions
+ *
+ * Merged sensor readings are averaged into 1-minute samples (24 hours kept),
+ * which are averaged again into 15-minute (30 days) and hourly (1 year)
+ * samples. Each resolution is a ring buffer allocated once in begin(); the
+ * oldest sample is overwritten when it is full. Only the channels the
+ * detected sensors measure are stored. Without PSRAM the rings are limited to
+ * HISTORY_RAM_BUDGET of internal RAM, which shortens the hourly ring.
+ *
+ * Values are fixed point (0.1 °C, 0.1 %RH, 0.1 hPa) and stored as one signed
+ * byte per channel: the change from the previous sample. Only the oldest
+ * value is kept in full. A change beyond ±12.7 is clamped and the rest
+ * carried into the next samples, so the series catches up instead of
+ * drifting. Missing values (no reading, or the sensor does not measure it)
+ * are marked and read back as gaps.
+ *
+ * Every HISTORY_PERSIST_MS the new samples are appended to one log file per
+ * resolution on LittleFS (HISTORY_DIR), as delta-encoded blocks. A log is
+ * rewritten as a single block once it holds twice a ring's worth, and is
+ * replayed at boot. Time is Unix time (UTC seconds); nothing is recorded
+ * until the clock has been set by NTP. If the clock steps back, the stored
+ * samples are re-stamped to end before the new time.
+ *
+ * The network task writes (add(), tick()); web handlers read with a cursor
+ * (open(), read()) a few samples at a time, so a query never copies a ring.
+ */
+
+// Resolutions, finest first
+enum HistoryTier : uint8_t {
+    HISTORY_1M = 0,
+    HISTORY_15M,
+    HISTORY_1H,
+    HISTORY_TIER_COUNT
+};
+
+// Channels (HistorySample::value index, bit in HistorySample::valid)
+#define HISTORY_TEMP 0     // 0.1 °C
+#define HISTORY_HUM  1     // 0.1 %RH
+#define HISTORY_PRES 2     // 0.1 hPa
+#define HISTORY_CHANNELS 3
+
+struct HistorySample {
+    uint32_t time;                      // Start of the sample's period (Unix time)
+    int16_t value[HISTORY_CHANNELS];
+    uint8_t valid;                      // Bit per channel; other values are gaps
+};
+
+// Read position of a range query (see open())
+struct HistoryCursor {
+    uint8_t tier;
+    uint32_t next;                      // Time of the next sample to read
+    uint32_t to;                        // Last time to read
+    int16_t value[HISTORY_CHANNELS];    // Decoded value at next (if synced)
+    uint32_t generation;                // Tier generation value was decoded in
+    bool synced;
+};
+
+namespace History {
+
+    // Allocate the rings and replay the logs (call once from setup, after
+    // LittleFS and sensor detection)
+    void begin();
+
+    // Add a merged reading to the current minute (NAN values are skipped)
+    void add(const SensorReading& reading);
+
+    // Close finished periods and persist when due (network task, every pass)
+    void tick(uint32_t unixTime);
+
+    uint32_t period(HistoryTier tier);      // Seconds per sample
+    const char* name(HistoryTier tier);     // "1m", "15m", "1h"
+    uint32_t oldest(HistoryTier tier);      // Time of the oldest sample, 0 if empty
+    uint32_t newest(HistoryTier tier);      // Time of the newest sample, 0 if empty
+    uint16_t capacity(HistoryTier tier);    // Samples the ring holds (may be below config.h)
+    size_t ramBytes();                      // Memory used by all rings
+    bool inPsram();                         // Rings allocated in PSRAM
+
+    /**
+     * Position a cursor on [from, to] of one resolution
+     * @return false if the tier holds nothing in the range
+     */
+    bool open(HistoryCursor& cursor, HistoryTier tier, uint32_t from, uint32_t to);
+
+    /**
+     * Read the next samples of a cursor, skipping samples with no value
+     * Safe from any task; samples overwritten since the last read are skipped.
+     * @return Samples written to out; fewer than max once the range is done
+     */
+    uint16_t read(HistoryCursor& cursor, HistorySample* out, uint16_t max);
+}
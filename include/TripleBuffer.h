@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * TripleBuffer - lock-free single-producer / single-consumer frame handoff
+ *
+ * The producer (render task) fills back(), then publish() swaps it with the
+ * shared middle slot. The consumer (web mirror) calls acquire(), which swaps
+ * the middle slot into front() only if a newer frame was published. Neither
+ * side ever waits and each owns its slot exclusively, so the consumer always
+ * sees a complete frame no matter how far the producer has moved on.
+ *
+ * The middle index carries a "fresh" bit that marks an unread publish.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : _back(0), _middle(1), _front(2), _published(0) {}
+
+    // Producer: slot to write the next frame into
+    T& back() { return _slots[_back]; }
+
+    // Producer: hand the back slot to the consumer and take the old middle slot
+    void publish() {
+        uint8_t prev = _middle.exchange(_back | FRESH_BIT, std::memory_order_acq_rel);
+        _back = prev & INDEX_MASK;
+        _published.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Consumer: most recently published frame (unchanged if nothing new)
+    const T& acquire() {
+        if (_middle.load(std::memory_order_relaxed) & FRESH_BIT) {
+            uint8_t prev = _middle.exchange(_front, std::memory_order_acq_rel);
+            _front = prev & INDEX_MASK;
+        }
+        return _slots[_front];
+    }
+
+    // Number of frames published so far
+    uint32_t published() const { return _published.load(std::memory_order_relaxed); }
+
+private:
+    static const uint8_t INDEX_MASK = 0x03;
+    static const uint8_t FRESH_BIT = 0x04;
+
+    T _slots[3];
+    uint8_t _back;                  // Owned by producer
+    std::atomic<uint8_t> _middle;   // Shared: slot index | FRESH_BIT
+    uint8_t _front;                 // Owned by consumer
+    std::atomic<uint32_t> _published;
+};
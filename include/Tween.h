@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Tween - fixed-point animation timeline shared by the clock modes
+ *
+ * Time and eased values are Q16 (65536 = 1.0). Easing curves are sampled
+ * tables (EASE_TABLE_STEPS segments, linearly interpolated), so an animation
+ * frame costs a few integer multiplies instead of float divisions and
+ * powf(), and host and device produce bit-identical frames.
+ *
+ * Eased values may leave 0..1 (EASE_OUT_ELASTIC overshoots to ~1.37);
+ * q16ToLevel() clamps for brightness use.
+ */
+
+typedef int32_t q16_t;
+#define Q16_ONE 65536
+
+// Easing curves (ease())
+#define EASE_LINEAR        0
+#define EASE_OUT_QUAD      1   // Fast start, "snap into place"
+#define EASE_IN_OUT_QUAD   2
+#define EASE_IN_OUT_CUBIC  3
+#define EASE_OUT_ELASTIC   4   // Overshoots and rings out
+#define EASE_OUT_BOUNCE    5
+#define EASE_CURVES        6
+
+#define EASE_TABLE_STEPS 128   // Table segments per curve
+
+/**
+ * Q16 ratio num/den (0 <= num <= den, den > 0)
+ */
+static inline q16_t q16Ratio(uint32_t num, uint32_t den) {
+  if (num >= den) return Q16_ONE;
+  return (q16_t)(((uint64_t)num << 16) / den);
+}
+
+/**
+ * Interpolate from a to b at Q16 time t
+ * |b - a| * |t| must fit in 31 bits (e.g. |b - a| < 16384 for t up to 2.0)
+ */
+static inline int32_t lerpQ16(int32_t a, int32_t b, q16_t t) {
+  return a + (int32_t)(((b - a) * t) >> 16);
+}
+
+/**
+ * Q16 value to a 0-255 brightness level (clamped)
+ */
+static inline uint8_t q16ToLevel(q16_t v) {
+  if (v <= 0) return 0;
+  if (v >= Q16_ONE) return 255;
+  return (uint8_t)((v * 255 + 0x8000) >> 16);
+}
+
+/**
+ * Apply an easing curve
+ * @param curve EASE_* curve
+ * @param t Q16 time, clamped to 0..Q16_ONE
+ * @return Q16 eased value (0 at t=0, Q16_ONE at t=1)
+ */
+q16_t ease(uint8_t curve, q16_t t);
+
+/**
+ * One animation: a duration, a curve and the time elapsed so far
+ */
+class Tween {
+public:
+  Tween() : _elapsed(0), _duration(0), _curve(EASE_LINEAR), _active(false) {}
+
+  // Restart from time 0
+  void start(uint32_t durationMs, uint8_t curve) {
+    _elapsed = 0;
+    _duration = durationMs;
+    _curve = curve;
+    _active = durationMs > 0;
+  }
+
+  // Jump to the end (time() and value() report 1.0)
+  void finish() {
+    _elapsed = _duration;
+    _active = false;
+  }
+
+  /**
+   * Advance the timeline
+   * @return true while the animation is still running
+   */
+  bool update(uint32_t deltaMs) {
+    if (!_active) return false;
+    _elapsed += deltaMs;
+    if (_elapsed >= _duration) finish();
+    return _active;
+  }
+
+  bool active() const { return _active; }
+
+  // Linear progress, 0..Q16_ONE
+  q16_t time() const { return _active ? q16Ratio(_elapsed, _duration) : Q16_ONE; }
+
+  // Eased progress
+  q16_t value() const { return ease(_curve, time()); }
+
+private:
+  uint32_t _elapsed;    // ms
+  uint32_t _duration;   // ms
+  uint8_t _curve;
+  bool _active;
+};
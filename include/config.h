@@ -26,6 +26,12 @@
 // Larger screen (480x320) allows for bigger LED diameter
 #define DEFAULT_LED_DIAMETER 7     // pixels (max, fills the pitch completely)
 #define DEFAULT_LED_GAP      0     // pixels (no gap for maximum fill)
+#define DEFAULT_LED_SHAPE    0     // 0=square, 1=round, 2=round with glow (see DotTileCache.h)
+#define DEFAULT_LED_DIMMING  1     // Fade/glow curve: 0=linear, 1=gamma, 2=gamma + dithering (see Color565.h)
+
+// Memory budget for pre-rendered round/glow LED tiles (RGB565, LRU evicted)
+// 8 KB holds ~64 distinct colors at the 8x9 Morph Remix pitch
+#define DOT_TILE_CACHE_BYTES 8192
 
 // Reserve space below the matrix for status/info
 #define STATUS_BAR_H 70            // pixels (bottom status bar - increased for larger screen)
@@ -36,6 +42,11 @@
 // Rendering mode: 0 = sprite (flickery during morph), 1 = direct TFT (smooth)
 #define DISABLE_SPRITE_RENDERING 1  // Use direct TFT rendering to eliminate morph flashing
 
+// Direct TFT render path (selectable at runtime, stored in config)
+#define RENDER_MODE_DELTA  0   // Changed LEDs coalesced into dirty rectangles (fewest SPI bytes)
+#define RENDER_MODE_BAND   1   // Changed LED rows rasterized into ping-pong line bands (DMA when available)
+#define DEFAULT_RENDER_MODE RENDER_MODE_DELTA
+
 // Default LED color (RGB565). Start with red.
 #define DEFAULT_LED_COLOR_565 0xF800
 
@@ -81,12 +92,13 @@
 #define TETRIS_ANIMATION_SPEED 1800         // Default: 1800ms (1.8s) between frames for cinematic slow-motion
 
 // ===== SENSOR CONFIGURATION =====
-// Choose your sensor type by uncommenting ONE of the following:
-// #define USE_BME280        // BME280: Temperature, Humidity, Pressure sensor (I2C: 0x76 or 0x77)
-#define USE_BMP280        // BMP280: Temperature and Pressure sensor (no humidity) (I2C: 0x76 or 0x77)
-// #define USE_BMP180        // BMP180: Temperature and Pressure sensor (no humidity) (I2C: 0x77 only)
-// #define USE_SHT3X         // SHT3X: Temperature and Humidity sensor (no pressure) (I2C: 0x44 or 0x45)
-// #define USE_HTU21D        // HTU21D: Temperature and Humidity sensor (no pressure) (I2C: 0x40) - DEFAULT
+// Sensors are detected at boot (SensorDriver.h); every supported sensor found is used:
+//   SHT3X  (0x44/0x45)  Temperature, Humidity
+//   HTU21D (0x40)       Temperature, Humidity
+//   BME280 (0x76/0x77)  Temperature, Humidity, Pressure
+//   BMP280 (0x76/0x77)  Temperature, Pressure
+//   BMP180 (0x77)       Temperature, Pressure
+// With several sensors, each value comes from the most accurate one listed first.
 
 // I2C pins for sensor
 // Note: GPIO 21/22 are used by touch controller (FT62x6) on Touchdown
@@ -97,6 +109,29 @@
 // Sensor update interval
 #define SENSOR_UPDATE_INTERVAL 60000  // Update sensor every 60 seconds
 
+// Plausible reading ranges; values outside are treated as sensor errors.
+// Pressure covers the BMP/BME280 range (about 9 km of altitude down to below sea level).
+#define SENSOR_TEMP_MIN_C     -50
+#define SENSOR_TEMP_MAX_C     100
+#define SENSOR_HUM_MIN_PCT    0
+#define SENSOR_HUM_MAX_PCT    100
+#define SENSOR_PRES_MIN_HPA   300
+#define SENSOR_PRES_MAX_HPA   1100
+
+// ===== SENSOR HISTORY =====
+// Ring buffers of sensor samples at three resolutions (SensorHistory.h), one
+// byte per sample and measured channel: 13 KB per channel at these sizes
+// (39 KB for temperature, humidity and pressure). With PSRAM the rings get
+// their full size; otherwise they share HISTORY_RAM_BUDGET of internal RAM
+// and the hourly ring keeps what is left after the finer two (about 100 days
+// with three channels, 8 months with two).
+#define HISTORY_1M_SAMPLES  (24 * 60)       // 1-minute samples: 24 hours
+#define HISTORY_15M_SAMPLES (30 * 24 * 4)   // 15-minute samples: 30 days
+#define HISTORY_1H_SAMPLES  (365 * 24)      // Hourly samples: 1 year
+#define HISTORY_RAM_BUDGET  (20 * 1024)    // Bytes of internal RAM for the rings without PSRAM
+#define HISTORY_PERSIST_MS  (15 * 60 * 1000UL)  // Append new samples to LittleFS every 15 minutes
+#define HISTORY_DIR         "/history"      // Log files (one per resolution)
+
 // ===== CAPACITIVE TOUCH CONTROLLER =====
 // FT6236/FT6206 Touch Controller (shares I2C bus with sensors)
 #define TOUCH_SDA_PIN     21    // I2C Data (same as sensor)
@@ -108,6 +143,9 @@
 #define ENABLE_TOUCH         1     // Enable touch support (1 = enabled, 0 = disabled)
 #define TOUCH_DEBOUNCE_MS    300   // Debounce time in milliseconds to prevent multiple triggers
 #define TOUCH_LONG_PRESS_MS  3000  // Long press time (3 seconds) to show info pages
+#define TOUCH_SAMPLE_MS      20    // Finger position sampling interval while touched (IRQ line low)
+#define TOUCH_SWIPE_MIN_PX   60    // Travel (screen pixels) that turns a tap into a swipe
+#define TOUCH_QUEUE_LEN      8     // Gestures buffered for the render task
 #define TOUCH_INFO_PAGES     2     // Number of info pages (0=User Settings, 1=System Diagnostics)
 
 // Temperature unit
@@ -127,6 +165,41 @@
 // Leaving pin definitTouchdown for future GPIO interrupt use
 // #define STATUS_BTN_PIN   12    // Available GPIO on breakout
 
+// ===== Instrumentation =====
+// Cycle-counter timing of render/web/sensor sections, served at /api/perf and
+// shown on the diagnostics info page. Set to 0 to compile the timers out.
+#define ENABLE_PERF_STATS 1
+
+// ===== Power management =====
+// Dynamic CPU frequency scaling (ESP-IDF PM locks): full speed while frames
+// are drawn or HTTP requests are served, POWER_MIN_MHZ while the display is
+// static. Keep POWER_MIN_MHZ at 80 or above: below that the APB clock (SPI,
+// I2C, UART) slows down too. Set ENABLE_POWER_SCALING to 0 to stay at full speed.
+#define ENABLE_POWER_SCALING 1
+#define POWER_MAX_MHZ        240
+#define POWER_MIN_MHZ        80
+#define POWER_WEB_HOLD_MS    500   // Full speed kept this long after the last HTTP request
+
+// ===== Tasks =====
+// Rendering runs in its own task on the application core; networking (OTA,
+// mirror stream) and sensor reads run on the protocol core next to the WiFi
+// stack. HTTP is served by AsyncWebServer in the AsyncTCP task. The touch
+// task sleeps on the touch IRQ line and queues gestures for the render task.
+// The I2C task owns Wire and runs queued touch and sensor jobs (I2CBus.h).
+#define RENDER_TASK_CORE       1
+#define RENDER_TASK_PRIORITY   2
+#define RENDER_TASK_STACK      8192
+#define NET_TASK_CORE          0
+#define NET_TASK_PRIORITY      1
+#define NET_TASK_STACK         8192
+#define TOUCH_TASK_CORE        0
+#define TOUCH_TASK_PRIORITY    2
+#define TOUCH_TASK_STACK       4096
+#define I2C_TASK_CORE          0
+#define I2C_TASK_PRIORITY      3
+#define I2C_TASK_STACK         4096
+#define I2C_QUEUE_LEN          8     // Jobs queued per priority
+
 // ===== OTA =====
 #define OTA_HOSTNAME "Touchdown-RetroClock"
 #define OTA_PASSWORD "change-me"   // Change this before flashing for real use.
@@ -134,6 +207,20 @@
 // ===== WEB =====
 #define HTTP_PORT 80
 
+// Live mirror stream: delta-encoded frames over a WebSocket on the web server
+// (see MirrorStream.h). Each client holds two frame copies (2 x 4 KB) while connected.
+#define MIRROR_WS_PATH "/ws/mirror"  // Must match MIRROR_WS_PATH in data/app.js
+#define MIRROR_WS_MAX_CLIENTS 4
+#define MIRROR_ACK_TIMEOUT_MS 2000  // Resync a client with a keyframe if it stops acknowledging
+
+// Content-hashed web UI assets (/assets/, see tools/build_web.py): a new build
+// gets new URLs, so browsers never need to revalidate these.
+#define WEB_ASSET_CACHE_CONTROL "public, max-age=31536000, immutable"
+
 // ===== RENDER =====
 #define FRAME_MS 50   // ~20 FPS - reduced from 33ms to minimize flashing (large 480x320 display is slower to update)
 #define MORPH_STEPS 20  // number of frames for morphing transitions
+#define DEFAULT_MORPH_STYLE 0  // 7-segment digit change: 0=spawn from center, 1=pixel pairs (see MorphPairs.h)
+// 7-segment mode draws into 1-bit planes and converts only the LEDs that
+// changed to RGB565 (see BitPlane.h). Set to 0 to redraw fb every frame.
+#define ENABLE_BITPLANE_FB 1
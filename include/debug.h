@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+
+// =========================
+// Debug System
+// =========================
+/**
+ * Leveled debug logging system with runtime control
+ *
+ * DEBUG LEVELS:
+ *   0 = Off      - No debug output
+ *   1 = Error    - Critical errors only
+ *   2 = Warn     - Warnings + Errors
+ *   3 = Info     - General info + Warnings + Errors (default)
+ *   4 = Verbose  - All debug output including frequent events
+ *
+ * USAGE:
+ *   DBG_ERROR(...)   - Critical errors (level 1+)
+ *   DBG_WARN(...)    - Warnings (level 2+)
+ *   DBG_INFO(...)    - General information (level 3+)
+ *   DBG_VERBOSE(...) - Verbose/frequent output (level 4)
+ *
+ * RUNTIME CONTROL:
+ *   Set debugLevel variable (0-4) to change verbosity at runtime
+ *   Can be controlled via web API or serial commands
+ *
+ * EXAMPLES:
+ *   DBG_ERROR("Failed to mount filesystem\n");
+ *   DBG_INFO("WiFi connected: %s\n", WiFi.SSID().c_str());
+ *   DBG_VERBOSE("Render frame: %d ms\n", elapsed);
+ */
+#ifndef DEBUG_LEVEL
+#define DEBUG_LEVEL 3  // Default: Info level
+#endif
+
+#define DBG_LEVEL_OFF     0
+#define DBG_LEVEL_ERROR   1
+#define DBG_LEVEL_WARN    2
+#define DBG_LEVEL_INFO    3
+#define DBG_LEVEL_VERBOSE 4
+
+// Runtime debug level control (can be changed via web API, defined in main.cpp)
+extern uint8_t debugLevel;
+
+// Conditional debug macros based on debug level
+#define DBG_ERROR(...)   do { if (debugLevel >= DBG_LEVEL_ERROR) { Serial.print("[ERR ] "); Serial.printf(__VA_ARGS__); } } while(0)
+#define DBG_WARN(...)    do { if (debugLevel >= DBG_LEVEL_WARN) { Serial.print("[WARN] "); Serial.printf(__VA_ARGS__); } } while(0)
+#define DBG_INFO(...)    do { if (debugLevel >= DBG_LEVEL_INFO) { Serial.print("[INFO] "); Serial.printf(__VA_ARGS__); } } while(0)
+#define DBG_VERBOSE(...) do { if (debugLevel >= DBG_LEVEL_VERBOSE) { Serial.print("[VERB] "); Serial.printf(__VA_ARGS__); } } while(0)
+
+// Legacy compatibility macros
+#define DBG(...)      DBG_INFO(__VA_ARGS__)
+#define DBGLN(s)      DBG_INFO("%s\n", s)
+#define DBG_STEP(s)   DBG_INFO("%s\n", s)
+#define DBG_OK(s)     DBG_INFO("✓ %s\n", s)
+#define DBG_ERR(s)    DBG_ERROR("%s\n", s)
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Minimal host Adafruit_GFX (env:native simulator only)
+ *
+ * Just the primitives FramebufferGFX and TetrisMatrixDraw draw with, all
+ * reduced to drawPixel(). Text rendering is not needed by the clock faces.
+ */
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : _width(w), _height(h) {}
+  virtual ~Adafruit_GFX() {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void startWrite() {}
+  virtual void endWrite() {}
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { fillRect(x, y, w, h, color); }
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { drawFastVLine(x, y, h, color); }
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { drawFastHLine(x, y, w, color); }
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) { drawLine(x0, y0, x1, y1, color); }
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, color);
+  }
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+  }
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t j = 0; j < h; j++)
+      for (int16_t i = 0; i < w; i++) drawPixel(x + i, y + j, color);
+  }
+  virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy;
+    for (;;) {
+      drawPixel(x0, y0, color);
+      if (x0 == x1 && y0 == y1) break;
+      int16_t e2 = 2 * err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+  }
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+  }
+
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  }
+
+  void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+  void setTextColor(uint16_t c) { _textColor = c; }
+  void setTextColor(uint16_t c, uint16_t) { _textColor = c; }
+  void setTextSize(uint8_t s) { _textSize = s; }
+  void setTextWrap(bool w) { _wrap = w; }
+  void setRotation(uint8_t) {}
+
+  size_t write(uint8_t) override { return 1; }
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+protected:
+  int16_t _width, _height;
+  int16_t _cursorX = 0, _cursorY = 0;
+  uint16_t _textColor = 0xFFFF;
+  uint8_t _textSize = 1;
+  bool _wrap = true;
+};
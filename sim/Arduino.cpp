@@ -0,0 +1,51 @@
+#include <Arduino.h>
+#include <chrono>
+
+HostSerial Serial;
+HostEsp ESP;
+
+// =========================
+// Virtual clock
+// =========================
+static unsigned long simMillis = 0;
+
+unsigned long millis() { return simMillis; }
+unsigned long micros() { return simMillis * 1000UL; }
+void delay(unsigned long ms) { simMillis += ms; }
+
+void simSetMillis(unsigned long ms) { simMillis = ms; }
+void simAdvanceMillis(unsigned long ms) { simMillis += ms; }
+
+// =========================
+// Random numbers
+// =========================
+static uint32_t rngState = 1;
+
+// xorshift32: same sequence on every host for a given seed
+static uint32_t nextRandom() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+long random(long howBig) {
+  if (howBig <= 0) return 0;
+  return (long)(nextRandom() % (uint32_t)howBig);
+}
+
+long random(long howSmall, long howBig) {
+  if (howSmall >= howBig) return howSmall;
+  return howSmall + random(howBig - howSmall);
+}
+
+void randomSeed(unsigned long seed) {
+  rngState = seed ? (uint32_t)seed : 1;
+}
+
+// Real elapsed time, so PERF_SCOPE still measures something useful on the host
+uint32_t HostEsp::getCycleCount() {
+  using namespace std::chrono;
+  uint64_t ns = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+  return (uint32_t)(ns * getCpuFreqMHz() / 1000);
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+/**
+ * Host stand-in for the Arduino core (env:native simulator only)
+ *
+ * Covers just what ClockFace, MorphingDigit and the TetrisAnimation library
+ * use: String, a virtual millis() clock, random(), Serial and the usual
+ * math helpers. Time only advances when the simulator says so, which keeps
+ * rendered frames reproducible.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <ctype.h>
+#include <algorithm>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define F(s) (s)
+
+using std::min;
+using std::max;
+using std::abs;
+
+template <typename T, typename L, typename H>
+inline T constrain(T x, L lo, H hi) { return x < (T)lo ? (T)lo : (x > (T)hi ? (T)hi : x); }
+
+// =========================
+// Virtual clock
+// =========================
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+void simSetMillis(unsigned long ms);
+void simAdvanceMillis(unsigned long ms);
+
+// =========================
+// Random numbers (deterministic: seeded by the simulator)
+// =========================
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+// =========================
+// String
+// =========================
+class String {
+public:
+  String() {}
+  String(const char* s) : _s(s ? s : "") {}
+  String(const std::string& s) : _s(s) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int v) : _s(std::to_string(v)) {}
+  explicit String(unsigned int v) : _s(std::to_string(v)) {}
+  explicit String(long v) : _s(std::to_string(v)) {}
+  explicit String(unsigned long v) : _s(std::to_string(v)) {}
+
+  unsigned int length() const { return (unsigned int)_s.length(); }
+  const char* c_str() const { return _s.c_str(); }
+  char charAt(unsigned int i) const { return i < _s.length() ? _s[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+
+  String substring(unsigned int from) const { return substring(from, length()); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= _s.length()) return String();
+    return String(_s.substr(from, to - from));
+  }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t p = _s.find(c, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  int indexOf(const String& s, unsigned int from = 0) const {
+    size_t p = _s.find(s._s, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+
+  long toInt() const { return atol(_s.c_str()); }
+  void toUpperCase() { for (auto& c : _s) c = (char)toupper((unsigned char)c); }
+  void toLowerCase() { for (auto& c : _s) c = (char)tolower((unsigned char)c); }
+  void trim() {
+    size_t b = _s.find_first_not_of(" \t\r\n");
+    size_t e = _s.find_last_not_of(" \t\r\n");
+    _s = (b == std::string::npos) ? "" : _s.substr(b, e - b + 1);
+  }
+
+  String& operator+=(const String& o) { _s += o._s; return *this; }
+  String& operator+=(const char* o) { _s += o; return *this; }
+  String& operator+=(char c) { _s += c; return *this; }
+
+  friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+  friend String operator+(const String& a, const char* b) { return String(a._s + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b._s); }
+  friend String operator+(const String& a, char c) { return String(a._s + c); }
+
+  bool operator==(const String& o) const { return _s == o._s; }
+  bool operator==(const char* o) const { return _s == o; }
+  bool operator!=(const String& o) const { return _s != o._s; }
+  bool operator!=(const char* o) const { return _s != o; }
+
+private:
+  std::string _s;
+};
+
+// =========================
+// Serial (to stderr so frame output on stdout stays clean)
+// =========================
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  size_t print(const char* s) { size_t n = 0; while (*s) n += write((uint8_t)*s++); return n; }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t println(const char* s = "") { size_t n = print(s); return n + write('\n'); }
+  size_t println(const String& s) { return println(s.c_str()); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return print(buf);
+  }
+};
+
+class HostSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override { fputc(c, stderr); return 1; }
+};
+
+extern HostSerial Serial;
+
+// =========================
+// ESP (PERF_SCOPE and friends)
+// =========================
+class HostEsp {
+public:
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz() { return 240; }
+};
+
+extern HostEsp ESP;
@@ -0,0 +1,305 @@
+/**
+ * Headless clock face simulator (env:native)
+ *
+ * Runs the real ClockFace/MorphingDigit/TetrisClock code against host stubs
+ * and writes each rendered frame as a binary PPM, drawn with the same LED
+ * geometry as the TFT (pitch, dot size, gap, round/glow tiles).
+ *
+ * USAGE:
+ *   pio run -e native
+ *   .pio/build/native/program --mode morph --time 125959 --frames 40 --out frames
+ *
+ * OPTIONS:
+ *   --mode 7seg|tetris|morph   Clock mode (default: morph)
+ *   --time HHMMSS              Start time, advanced one second per 1000 ms simulated
+ *   --frames N                 Frames to render (default: 1)
+ *   --step-ms N                Simulated time between frames (default: FRAME_MS)
+ *   --out DIR                  Output directory (default: current directory)
+ *   --pitch N                  TFT pixels per LED (default: as on the TFT, 0 = raw 64x32)
+ *   --diameter N, --gap N      LED dot settings (as in the web UI)
+ *   --shape square|round|glow  LED dot shape
+ *   --dimming linear|gamma|dither  Fade/glow brightness curve
+ *   --transition spawn|pairs   7-segment digit transition
+ *   --color RRGGBB             LED color
+ *   --12h                      12-hour time
+ *   --seed N                   Random seed (Tetris/Morph particle paths)
+ */
+
+#include <Arduino.h>
+#include <sys/stat.h>
+#include "config.h"
+#include "debug.h"
+#include "AppConfig.h"
+#include "ClockFace.h"
+#include "DotTileCache.h"
+#include "Color565.h"
+#include "MorphPairs.h"
+#include "SensorDriver.h"
+#include "TetrisClock.h"
+
+// Firmware globals normally defined in main.cpp
+AppConfig cfg;
+uint8_t debugLevel = DBG_LEVEL_WARN;
+
+bool sensorAvailable = true;
+uint8_t sensorMeasures = SENSOR_TEMPERATURE | SENSOR_PRESSURE;  // A BMP280
+int temperature = 22;
+int humidity = 45;
+int pressure = 1013;
+
+static DotTileCache dotTiles(DOT_TILE_CACHE_BYTES);
+
+struct SimOptions {
+  const char* outDir = ".";
+  const char* time = "120000";
+  int frames = 1;
+  int stepMs = FRAME_MS;
+  int pitch = -1;   // -1 = TFT geometry for the mode, 0 = raw 1:1 framebuffer
+  uint32_t seed = 1;
+};
+
+// =========================
+// Time
+// =========================
+
+/**
+ * Advance an "HHMMSS" 24h time string by one second
+ */
+static void tickSecond(int& h, int& m, int& s) {
+  if (++s < 60) return;
+  s = 0;
+  if (++m < 60) return;
+  m = 0;
+  if (++h < 24) return;
+  h = 0;
+}
+
+/**
+ * Format the displayed time like updateClockLogic() does on the device
+ */
+static void formatTime(int h, int m, int s, char* t6) {
+  int hh = h;
+  if (!cfg.use24h) {
+    hh = h % 12;
+    if (hh == 0) hh = 12;
+  }
+  snprintf(t6, 7, "%02d%02d%02d", hh, m, s);
+}
+
+// =========================
+// Frame output
+// =========================
+
+/**
+ * Create a directory and any missing parents (like mkdir -p)
+ */
+static void makeDirs(const char* dir) {
+  char path[512];
+  snprintf(path, sizeof(path), "%s", dir);
+  for (char* p = path + 1; *p; p++) {
+    if (*p != '/') continue;
+    *p = '\0';
+    mkdir(path, 0755);
+    *p = '/';
+  }
+  mkdir(path, 0755);
+}
+
+/**
+ * Write fb as a binary PPM (P6), each LED drawn as a pitchX x pitchY cell
+ * @return true on success
+ */
+static bool writeFrame(const char* path, int pitchX, int pitchY) {
+  FILE* f = fopen(path, "wb");
+  if (!f) {
+    DBG_ERROR("Cannot write %s\n", path);
+    return false;
+  }
+
+  const bool raw = pitchX <= 0 || pitchY <= 0;
+  if (raw) pitchX = pitchY = 1;
+
+  // Same dot sizing as computeLedGeometry() in main.cpp
+  int pitch = min(pitchX, pitchY);
+  int gap = constrain((int)cfg.ledGap, 0, pitch - 1);
+  int dot = constrain(min(pitch - gap, (int)cfg.ledDiameter), 1, pitch);
+  if (raw) dot = 1;
+  const int insetX = (pitchX - dot) / 2;
+  const int insetY = (pitchY - dot) / 2;
+
+  const int w = LED_MATRIX_W * pitchX;
+  const int h = LED_MATRIX_H * pitchY;
+  fprintf(f, "P6\n%d %d\n255\n", w, h);
+
+  uint8_t* row = (uint8_t*)malloc(w * 3);
+  if (!row) {
+    fclose(f);
+    return false;
+  }
+
+  for (int ly = 0; ly < LED_MATRIX_H; ly++) {
+    for (int cy = 0; cy < pitchY; cy++) {
+      for (int lx = 0; lx < LED_MATRIX_W; lx++) {
+        const uint16_t c = fb[ly][lx];
+        const uint16_t* tile = nullptr;
+        if (!raw && c != 0 && cfg.ledShape != LED_SHAPE_SQUARE) {
+          tile = dotTiles.get(c, cfg.ledShape, dot, pitchX, pitchY);
+        }
+
+        for (int cx = 0; cx < pitchX; cx++) {
+          uint16_t p;
+          if (tile) {
+            p = tile[cy * pitchX + cx];
+          } else {
+            const bool inDot = cx >= insetX && cx < insetX + dot && cy >= insetY && cy < insetY + dot;
+            p = inDot ? c : 0;
+          }
+          // RGB565 -> RGB888 with bit replication
+          uint8_t* o = row + (lx * pitchX + cx) * 3;
+          o[0] = ((p >> 11) & 0x1F) * 255 / 31;
+          o[1] = ((p >> 5) & 0x3F) * 255 / 63;
+          o[2] = (p & 0x1F) * 255 / 31;
+        }
+      }
+      fwrite(row, 1, w * 3, f);
+    }
+  }
+
+  free(row);
+  return fclose(f) == 0;
+}
+
+// =========================
+// Command line
+// =========================
+static void usage() {
+  fprintf(stderr,
+          "usage: program [--mode 7seg|tetris|morph] [--time HHMMSS] [--frames N]\n"
+          "               [--step-ms N] [--out DIR] [--pitch N] [--diameter N] [--gap N]\n"
+          "               [--shape square|round|glow] [--dimming linear|gamma|dither]\n"
+          "               [--transition spawn|pairs] [--color RRGGBB] [--12h] [--seed N]\n");
+}
+
+static bool parseArgs(int argc, char** argv, SimOptions& opt) {
+  for (int i = 1; i < argc; i++) {
+    const String a = argv[i];
+    const bool hasValue = i + 1 < argc;
+    const char* v = hasValue ? argv[i + 1] : "";
+
+    if (a == "--12h") {
+      cfg.use24h = false;
+      continue;
+    }
+    if (!hasValue) {
+      usage();
+      return false;
+    }
+    i++;
+
+    if (a == "--mode") {
+      if (!strcmp(v, "7seg")) cfg.clockMode = CLOCK_MODE_7SEG;
+      else if (!strcmp(v, "tetris")) cfg.clockMode = CLOCK_MODE_TETRIS;
+      else if (!strcmp(v, "morph")) cfg.clockMode = CLOCK_MODE_MORPH;
+      else { usage(); return false; }
+    } else if (a == "--time") {
+      if (strlen(v) != 6) { usage(); return false; }
+      opt.time = v;
+    } else if (a == "--frames") {
+      opt.frames = max(1, atoi(v));
+    } else if (a == "--step-ms") {
+      opt.stepMs = max(1, atoi(v));
+    } else if (a == "--out") {
+      opt.outDir = v;
+    } else if (a == "--pitch") {
+      opt.pitch = max(0, atoi(v));
+    } else if (a == "--diameter") {
+      cfg.ledDiameter = (uint8_t)constrain(atoi(v), 1, 10);
+    } else if (a == "--gap") {
+      cfg.ledGap = (uint8_t)constrain(atoi(v), 0, 8);
+    } else if (a == "--shape") {
+      if (!strcmp(v, "square")) cfg.ledShape = LED_SHAPE_SQUARE;
+      else if (!strcmp(v, "round")) cfg.ledShape = LED_SHAPE_ROUND;
+      else if (!strcmp(v, "glow")) cfg.ledShape = LED_SHAPE_GLOW;
+      else { usage(); return false; }
+    } else if (a == "--dimming") {
+      if (!strcmp(v, "linear")) cfg.ledDimming = LED_DIM_LINEAR;
+      else if (!strcmp(v, "gamma")) cfg.ledDimming = LED_DIM_GAMMA;
+      else if (!strcmp(v, "dither")) cfg.ledDimming = LED_DIM_DITHER;
+      else { usage(); return false; }
+    } else if (a == "--transition") {
+      if (!strcmp(v, "spawn")) cfg.morphStyle = MORPH_STYLE_SPAWN;
+      else if (!strcmp(v, "pairs")) cfg.morphStyle = MORPH_STYLE_PAIRS;
+      else { usage(); return false; }
+    } else if (a == "--color") {
+      cfg.ledColor = (uint32_t)strtoul(v, nullptr, 16) & 0xFFFFFF;
+    } else if (a == "--seed") {
+      opt.seed = (uint32_t)strtoul(v, nullptr, 10);
+    } else {
+      usage();
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  SimOptions opt;
+  if (!parseArgs(argc, argv, opt)) return 2;
+
+  makeDirs(opt.outDir);
+  randomSeed(opt.seed);
+
+  // TFT geometry for the mode (480x320 panel, see computeLedGeometry())
+  int pitchX = opt.pitch, pitchY = opt.pitch;
+  if (opt.pitch < 0) {
+    if (cfg.clockMode == CLOCK_MODE_MORPH) {
+      pitchX = MORPH_PITCH_X;
+      pitchY = MORPH_PITCH_Y;
+    } else {
+      pitchX = pitchY = min(480 / LED_MATRIX_W, (320 - STATUS_BAR_H) / LED_MATRIX_H);
+    }
+  }
+
+  initBitmaps();
+  tetrisClock = new TetrisClock(fb);
+
+  int h = (opt.time[0] - '0') * 10 + (opt.time[1] - '0');
+  int m = (opt.time[2] - '0') * 10 + (opt.time[3] - '0');
+  int s = (opt.time[4] - '0') * 10 + (opt.time[5] - '0');
+  h = constrain(h, 0, 23);
+  m = constrain(m, 0, 59);
+  s = constrain(s, 0, 59);
+
+  // Start at the firmware's boot state, then show the requested time
+  char t6[7];
+  formatTime(h, m, s, t6);
+  clockSetTime(t6);
+
+  unsigned long nextSecond = 1000;
+  unsigned long nextColon = 1000;
+
+  for (int frame = 0; frame < opt.frames; frame++) {
+    renderCurrentMode();
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%05d.ppm", opt.outDir, frame);
+    if (!writeFrame(path, pitchX, pitchY)) return 1;
+
+    simAdvanceMillis(opt.stepMs);
+    while (millis() >= nextColon) {
+      clockColon = !clockColon;
+      nextColon += 1000;
+    }
+    while (millis() >= nextSecond) {
+      tickSecond(h, m, s);
+      formatTime(h, m, s, t6);
+      clockSetTime(t6);
+      nextSecond += 1000;
+    }
+  }
+
+  Serial.printf("Wrote %d frame(s) (%dx%d) to %s\n", opt.frames,
+                LED_MATRIX_W * max(pitchX, 1), LED_MATRIX_H * max(pitchY, 1), opt.outDir);
+  delete tetrisClock;
+  return 0;
+}
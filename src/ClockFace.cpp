@@ -0,0 +1,1127 @@
+#include "ClockFace.h"
+#include "AppConfig.h"
+#include "BitPlane.h"
+#include "Color565.h"
+#include "MorphPairs.h"
+#include "SensorDriver.h"
+#include "Tween.h"
+#include "TetrisClock.h"
+#include "debug.h"
+
+// =========================
+// Clock State
+// =========================
+alignas(4) uint16_t fb[LED_MATRIX_H][LED_MATRIX_W];
+
+char prevT[7] = "------";
+char currT[7] = "------";
+char currDate[14] = "----/--/--";
+int morphStep = MORPH_STEPS;
+bool clockColon = true;
+unsigned long lastMorphUpdate = 0;
+
+TetrisClock* tetrisClock = nullptr;
+
+MorphingDigit morphHourTens, morphHourUnits;
+MorphingDigit morphMinuteTens, morphMinuteUnits;
+MorphingDigit morphSecondTens, morphSecondUnits;
+
+// =========================
+// Framebuffer Utility Functions
+// =========================
+
+/**
+ * Convert 24-bit RGB (0xRRGGBB) to 16-bit RGB565 format for TFT display
+ * @param rgb 24-bit RGB color value
+ * @return 16-bit RGB565 color value
+ */
+uint16_t rgb888_to_565(uint32_t rgb) {
+  uint8_t r = (rgb >> 16) & 0xFF;
+  uint8_t g = (rgb >> 8) & 0xFF;
+  uint8_t b = (rgb >> 0) & 0xFF;
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+#if ENABLE_BITPLANE_FB
+// 7-segment frames drawn as bit planes (see drawFrameBits())
+static BitFrame bitFrames[2];
+static uint8_t bitFrameCur = 0;          // bitFrames[bitFrameCur] is what fb holds...
+static bool bitFrameValid = false;       // ...unless fb was cleared or drawn since
+static BitFrame* bitTarget = nullptr;    // Set while drawing: primitives draw here instead of fb
+static bool bitTargetFailed = false;     // Frame needs per-LED colors (dithering) or too many colors
+#endif
+
+/**
+ * Clear the entire framebuffer to a specific color
+ * @param color RGB565 color value, default 0 (black/off)
+ */
+void fbClear(uint16_t color) {
+#if ENABLE_BITPLANE_FB
+  bitFrameValid = false;
+#endif
+  for (int y = 0; y < LED_MATRIX_H; y++) {
+    for (int x = 0; x < LED_MATRIX_W; x++) {
+      fb[y][x] = color;
+    }
+  }
+}
+
+/**
+ * Set a single pixel in the framebuffer with bounds checking
+ * @param x X coordinate (0 to LED_MATRIX_W-1)
+ * @param y Y coordinate (0 to LED_MATRIX_H-1)
+ * @param color RGB565 color value
+ */
+void fbSet(int x, int y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= LED_MATRIX_W || y >= LED_MATRIX_H) return;
+  fb[y][x] = color;
+}
+
+// =========================
+// Small 3x5 Bitmap Font for LED Matrix
+// =========================
+// Simple 3-pixel wide, 5-pixel tall font for displaying text on matrix
+// Each character is represented as 5 bytes (one per row)
+// Bit layout: bits 0-2 are the 3 columns (LSB = left column)
+
+const uint8_t font3x5[][5] = {
+  {0b111, 0b101, 0b101, 0b101, 0b111}, // 0
+  {0b010, 0b110, 0b010, 0b010, 0b111}, // 1
+  {0b111, 0b001, 0b111, 0b100, 0b111}, // 2
+  {0b111, 0b001, 0b111, 0b001, 0b111}, // 3
+  {0b101, 0b101, 0b111, 0b001, 0b001}, // 4
+  {0b111, 0b100, 0b111, 0b001, 0b111}, // 5
+  {0b111, 0b100, 0b111, 0b101, 0b111}, // 6
+  {0b111, 0b001, 0b001, 0b001, 0b001}, // 7
+  {0b111, 0b101, 0b111, 0b101, 0b111}, // 8
+  {0b111, 0b101, 0b111, 0b001, 0b111}, // 9
+  {0b000, 0b000, 0b000, 0b000, 0b000}, // : (space)
+  {0b000, 0b000, 0b000, 0b000, 0b000}, // ; (space)
+  {0b000, 0b000, 0b000, 0b000, 0b000}, // < (space)
+  {0b000, 0b000, 0b000, 0b000, 0b000}, // = (space)
+  {0b000, 0b000, 0b000, 0b000, 0b000}, // > (space)
+  {0b000, 0b000, 0b000, 0b000, 0b000}, // ? (space)
+  {0b000, 0b000, 0b000, 0b000, 0b000}, // @ (space)
+  {0b111, 0b101, 0b111, 0b101, 0b101}, // A
+  {0b110, 0b101, 0b110, 0b101, 0b110}, // B
+  {0b111, 0b100, 0b100, 0b100, 0b111}, // C
+  {0b110, 0b101, 0b101, 0b101, 0b110}, // D
+  {0b111, 0b100, 0b111, 0b100, 0b111}, // E
+  {0b111, 0b100, 0b111, 0b100, 0b100}, // F
+  {0b111, 0b100, 0b101, 0b101, 0b111}, // G
+  {0b101, 0b101, 0b111, 0b101, 0b101}, // H
+  {0b111, 0b010, 0b010, 0b010, 0b111}, // I
+  {0b111, 0b001, 0b001, 0b101, 0b111}, // J
+  {0b101, 0b101, 0b110, 0b101, 0b101}, // K
+  {0b100, 0b100, 0b100, 0b100, 0b111}, // L
+  {0b101, 0b111, 0b111, 0b101, 0b101}, // M
+  {0b101, 0b111, 0b111, 0b111, 0b101}, // N
+  {0b111, 0b101, 0b101, 0b101, 0b111}, // O
+  {0b111, 0b101, 0b111, 0b100, 0b100}, // P
+  {0b111, 0b101, 0b101, 0b111, 0b001}, // Q
+  {0b111, 0b101, 0b110, 0b101, 0b101}, // R
+  {0b111, 0b100, 0b111, 0b001, 0b111}, // S (same as 5)
+  {0b111, 0b010, 0b010, 0b010, 0b010}, // T
+  {0b101, 0b101, 0b101, 0b101, 0b111}, // U
+  {0b101, 0b101, 0b101, 0b101, 0b010}, // V
+  {0b101, 0b101, 0b111, 0b111, 0b101}, // W
+  {0b101, 0b101, 0b010, 0b101, 0b101}, // X
+  {0b101, 0b101, 0b010, 0b010, 0b010}, // Y
+  {0b111, 0b001, 0b010, 0b100, 0b111}, // Z
+};
+
+// Character offset: '0' = index 0, 'A' = index 17
+static int getFont3x5Index(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'Z') return c - 'A' + 17;
+  if (c >= 'a' && c <= 'z') return c - 'a' + 17; // lowercase -> uppercase
+  return 10; // space for unknown chars
+}
+
+// Draw a single character using the 3x5 font
+// Fixed: Draw correctly without horizontal flip
+static void drawChar3x5(char c, int x, int y, uint16_t color) {
+  int idx = getFont3x5Index(c);
+  const uint8_t* glyph = font3x5[idx];
+
+  for (int row = 0; row < 5; row++) {
+    for (int col = 0; col < 3; col++) {
+      // Font bits: bit 0 is rightmost, bit 2 is leftmost
+      // We need to draw col 0 at x, col 2 at x+2 (not flipped)
+      // So check bit (2-col) instead of col
+      if (glyph[row] & (1 << (2 - col))) {
+        int px = x + col;
+        int py = y + row;
+        if (px >= 0 && px < LED_MATRIX_W && py >= 0 && py < LED_MATRIX_H) {
+          fb[py][px] = color;
+        }
+      }
+    }
+  }
+}
+
+// Calculate the width of a string using the 3x5 font
+int getTextWidth3x5(const char* text) {
+  int width = 0;
+  while (*text) {
+    if (*text == ' ') {
+      width += 3;
+    } else if (*text == '.') {
+      width += 2;
+    } else if (*text == '/') {
+      width += 3;
+    } else if (*text == '-') {
+      width += 4;
+    } else if (*text == '%') {
+      width += 4;
+    } else {
+      width += 4;  // 3 pixels + 1 pixel spacing
+    }
+    text++;
+  }
+  return width;
+}
+
+// Draw a string using the 3x5 font
+void drawText3x5(const char* text, int x, int y, uint16_t color) {
+  int cursorX = x;
+  while (*text) {
+    if (*text == ' ') {
+      cursorX += 3; // space width (reduced from 4)
+    } else if (*text == '.') {
+      // Draw a dot (period) - single pixel at bottom
+      if (cursorX >= 0 && cursorX < LED_MATRIX_W && y + 4 >= 0 && y + 4 < LED_MATRIX_H) {
+        fb[y + 4][cursorX] = color;
+      }
+      cursorX += 2;
+    } else if (*text == '/') {
+      // Draw a forward slash - diagonal line from bottom-left to top-right
+      // Row 0: x+2, Row 1: x+2, Row 2: x+1, Row 3: x+1, Row 4: x+0
+      for (int row = 0; row < 5; row++) {
+        int px = cursorX + (2 - row / 2);  // Creates pattern: 2,2,1,1,0
+        int py = y + row;
+        if (px >= 0 && px < LED_MATRIX_W && py >= 0 && py < LED_MATRIX_H) {
+          fb[py][px] = color;
+        }
+      }
+      cursorX += 3;
+    } else if (*text == '-') {
+      // Draw a dash/minus - horizontal line in middle
+      for (int px = cursorX; px < cursorX + 3; px++) {
+        if (px >= 0 && px < LED_MATRIX_W && y + 2 >= 0 && y + 2 < LED_MATRIX_H) {
+          fb[y + 2][px] = color;
+        }
+      }
+      cursorX += 4;
+    } else if (*text == '%') {
+      // Draw percent sign - dot, slash, dot pattern
+      // Top dot at (0,0)
+      if (y >= 0 && y < LED_MATRIX_H && cursorX >= 0 && cursorX < LED_MATRIX_W) {
+        fb[y][cursorX] = color;
+      }
+      // Diagonal slash
+      if (y + 1 >= 0 && y + 1 < LED_MATRIX_H && cursorX + 1 >= 0 && cursorX + 1 < LED_MATRIX_W) {
+        fb[y + 1][cursorX + 1] = color;
+      }
+      if (y + 2 >= 0 && y + 2 < LED_MATRIX_H && cursorX + 1 >= 0 && cursorX + 1 < LED_MATRIX_W) {
+        fb[y + 2][cursorX + 1] = color;
+      }
+      if (y + 3 >= 0 && y + 3 < LED_MATRIX_H && cursorX + 2 >= 0 && cursorX + 2 < LED_MATRIX_W) {
+        fb[y + 3][cursorX + 2] = color;
+      }
+      // Bottom dot at (2,4)
+      if (y + 4 >= 0 && y + 4 < LED_MATRIX_H && cursorX + 2 >= 0 && cursorX + 2 < LED_MATRIX_W) {
+        fb[y + 4][cursorX + 2] = color;
+      }
+      cursorX += 4;  // Reduced from 6 for tighter spacing
+    } else {
+      drawChar3x5(*text, cursorX, y, color);
+      cursorX += 4; // 3 pixels + 1 pixel spacing
+    }
+    text++;
+  }
+}
+
+// =========================
+// 7-Segment Digit Bitmaps & Layout Constants
+// =========================
+// (layout constants and struct Bitmap are in ClockFace.h)
+
+static Bitmap DIGITS[10];  // Array of digit bitmaps (0-9)
+static Bitmap COLON;       // Colon separator bitmap
+static bool morphPairsValid = false;  // MORPH_PAIRS matches DIGITS (checked in initBitmaps())
+
+/**
+ * Generate a 7-segment style digit bitmap
+ * Segments are labeled a-g in standard 7-segment notation:
+ *     aaa
+ *    f   b
+ *     ggg
+ *    e   c
+ *     ddd
+ * @param d Digit value (0-9)
+ * @return Bitmap structure containing the rendered digit
+ */
+static Bitmap makeDigit7Seg(uint8_t d) {
+  bool seg[7] = {0};
+  switch (d) {
+    case 0: seg[0]=seg[1]=seg[2]=seg[3]=seg[4]=seg[5]=1; break;
+    case 1: seg[1]=seg[2]=1; break;
+    case 2: seg[0]=seg[1]=seg[6]=seg[4]=seg[3]=1; break;
+    case 3: seg[0]=seg[1]=seg[6]=seg[2]=seg[3]=1; break;
+    case 4: seg[5]=seg[6]=seg[1]=seg[2]=1; break;
+    case 5: seg[0]=seg[5]=seg[6]=seg[2]=seg[3]=1; break;
+    case 6: seg[0]=seg[5]=seg[6]=seg[4]=seg[2]=seg[3]=1; break;
+    case 7: seg[0]=seg[1]=seg[2]=1; break;
+    case 8: seg[0]=seg[1]=seg[2]=seg[3]=seg[4]=seg[5]=seg[6]=1; break;
+    case 9: seg[0]=seg[1]=seg[2]=seg[3]=seg[5]=seg[6]=1; break;
+    default: break;
+  }
+
+  Bitmap bm{};
+  for (int y=0; y<DIGIT_H; y++) bm.rows[y]=0;
+
+  auto setPx = [&](int x, int y){
+    if (x<0||y<0||x>=DIGIT_W||y>=DIGIT_H) return;
+    bm.rows[y] |= (1u << (15-x));
+  };
+
+  const int padX = 0;
+  const int padY = 1;
+  const int th = 4;
+  const int w = DIGIT_W;
+  const int h = DIGIT_H;
+  const int midY = h/2;
+
+  if (seg[0]) for(int y=padY; y<padY+th; y++) for(int x=padX; x<w-padX; x++) setPx(x,y);            // a
+  if (seg[3]) for(int y=h-padY-th; y<h-padY; y++) for(int x=padX; x<w-padX; x++) setPx(x,y);          // d
+  if (seg[6]) for(int y=midY - th/2; y<midY - th/2 + th; y++) for(int x=padX; x<w-padX; x++) setPx(x,y); // g
+
+  if (seg[5]) for(int x=padX; x<padX+th; x++) for(int y=padY; y<midY; y++) setPx(x,y);               // f
+  if (seg[1]) for(int x=w-padX-th; x<w-padX; x++) for(int y=padY; y<midY; y++) setPx(x,y);           // b
+  if (seg[4]) for(int x=padX; x<padX+th; x++) for(int y=midY; y<h-padY; y++) setPx(x,y);             // e
+  if (seg[2]) for(int x=w-padX-th; x<w-padX; x++) for(int y=midY; y<h-padY; y++) setPx(x,y);         // c
+
+  return bm;
+}
+
+/**
+ * Check that the generated pair tables cover exactly the pixels of DIGITS
+ * (they are built offline from a copy of makeDigit7Seg())
+ */
+static bool checkMorphPairs() {
+  for (uint8_t lo = 0; lo < 10; lo++) {
+    for (uint8_t hi = lo + 1; hi < 10; hi++) {
+      const uint8_t t = morphPairTable(lo, hi);
+      Bitmap from{}, to{};
+      for (uint16_t i = MORPH_PAIR_OFFSETS[t]; i < MORPH_PAIR_OFFSETS[t + 1]; i++) {
+        const MorphPair& mp = MORPH_PAIRS[i];
+        if (mp.fromX >= DIGIT_W || mp.toX >= DIGIT_W || mp.fromY >= DIGIT_H || mp.toY >= DIGIT_H) return false;
+        from.rows[mp.fromY] |= (1u << (15 - mp.fromX));
+        to.rows[mp.toY] |= (1u << (15 - mp.toX));
+      }
+      if (memcmp(&from, &DIGITS[lo], sizeof(Bitmap)) || memcmp(&to, &DIGITS[hi], sizeof(Bitmap))) return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Initialize all digit and colon bitmaps
+ * Called once during setup to pre-render all characters
+ */
+void initBitmaps() {
+  DBG_STEP("Building digit bitmaps...");
+  for (int i=0;i<10;i++) DIGITS[i] = makeDigit7Seg(i);
+
+  for (int y=0;y<DIGIT_H;y++) COLON.rows[y]=0;
+  auto setPx = [&](int x, int y){
+    if (x<0||y<0||x>=COLON_W||y>=DIGIT_H) return;
+    COLON.rows[y] |= (1u << (15-x));
+  };
+  for(int yy=10; yy<13; yy++) for(int xx=0; xx<COLON_W; xx++) setPx(xx,yy);
+  for(int yy=19; yy<22; yy++) for(int xx=0; xx<COLON_W; xx++) setPx(xx,yy);
+
+  morphPairsValid = checkMorphPairs();
+  if (!morphPairsValid) DBG_WARN("Morph pair tables do not match the digit bitmaps, using spawn morph\n");
+
+  DBG_OK("Digit bitmaps ready.");
+}
+
+const Bitmap& digitBitmap(uint8_t d) {
+  return DIGITS[d % 10];
+}
+
+// =========================
+// Morphing Helper Functions
+// =========================
+
+int buildPixelsFromBitmap(const Bitmap& bm, int w, Pt* out, int maxOut) {
+  int n = 0;
+  for (int y = 0; y < DIGIT_H; y++) {
+    uint16_t row = bm.rows[y];
+    for (int x = 0; x < w; x++) {
+      bool on = (row >> (15 - x)) & 0x1;
+      if (!on) continue;
+      if (n < maxOut) out[n] = Pt{(int8_t)x, (int8_t)y};
+      n++;
+    }
+  }
+  return n;
+}
+
+// =========================
+// Clock logic & drawing
+// =========================
+
+bool clockSetTime(const char* t6) {
+  if (strncmp(t6, currT, 6) == 0) return false;
+  memcpy(prevT, currT, 7);
+  memcpy(currT, t6, 6);
+  currT[6] = '\0';
+  morphStep = 0;
+  return true;
+}
+
+/**
+ * drawRows() with ordered dithering (LED_DIM_DITHER)
+ */
+static void drawRowsDithered(const uint16_t* rows, int top, int n, int x0, int y0, int w, uint16_t baseColor, uint8_t intensity) {
+  for (int y=top; y<top+n; y++) {
+    for (int x=0; x<w; x++) {
+      bool on = (rows[y-top] >> (15-x)) & 0x1;
+      if (!on) continue;
+      int yScaled = (y * LED_MATRIX_H) / DIGIT_H;
+      fbSet(x0 + x, y0 + yScaled, dim565(baseColor, intensity, LED_DIM_DITHER, x0 + x, y0 + yScaled));
+    }
+  }
+}
+
+/**
+ * Draw bitmap rows top..top+n-1 in cfg.ledColor scaled by intensity
+ * @param rows Row bits for bitmap rows top onwards (MSB left)
+ */
+static void drawRows(const uint16_t* rows, int top, int n, int x0, int y0, int w, uint8_t intensity) {
+  // Convert user's LED color to RGB565
+  uint16_t baseColor = rgb888_to_565(cfg.ledColor);
+  const bool dither = cfg.ledDimming == LED_DIM_DITHER && intensity != 255;
+
+  // Apply intensity scaling to color
+  uint16_t color = dim565(baseColor, intensity, cfg.ledDimming, 0, 0);
+
+#if ENABLE_BITPLANE_FB
+  if (bitTarget) {
+    BitPlane* plane = dither ? nullptr : bitTarget->plane(color);
+    if (!plane) {
+      bitTargetFailed = true;
+      return;
+    }
+    for (int y=top; y<top+n; y++) plane->orRow(y0 + (y * LED_MATRIX_H) / DIGIT_H, rows[y-top], x0, w);
+    return;
+  }
+#endif
+
+  // Dithered pixels each need their own threshold
+  if (dither) {
+    drawRowsDithered(rows, top, n, x0, y0, w, baseColor, intensity);
+    return;
+  }
+
+  for (int y=top; y<top+n; y++) {
+    for (int x=0; x<w; x++) {
+      bool on = (rows[y-top] >> (15-x)) & 0x1;
+      if (!on) continue;
+      int yScaled = (y * LED_MATRIX_H) / DIGIT_H;
+      fbSet(x0 + x, y0 + yScaled, color);
+    }
+  }
+}
+
+/**
+ * Draw a bitmap to the framebuffer with specified intensity
+ * @param bm Bitmap to render
+ * @param x0 X position in framebuffer
+ * @param y0 Y position in framebuffer
+ * @param w Width of bitmap
+ * @param intensity Brightness level (0-255), default 255
+ */
+void drawBitmapSolid(const Bitmap& bm, int x0, int y0, int w, uint8_t intensity) {
+  drawRows(bm.rows, 0, DIGIT_H, x0, y0, w, intensity);
+}
+
+/**
+ * Pixel positions of one "spawn" morph step, as a bitmap
+ * Pixels start at the glyph center and move into their final positions;
+ * several may share an LED early on.
+ * @param toBm Target bitmap to morph into
+ * @param step Animation step (0 to MORPH_STEPS)
+ * @param w Width of bitmap
+ * @param out Receives the LEDs lit at this step
+ */
+static void spawnStepBitmap(const Bitmap& toBm, int step, int w, Bitmap& out) {
+  // Gather all ON pixels in target glyph
+  static Pt toPts[420];
+  int toN = buildPixelsFromBitmap(toBm, w, toPts, 420);
+  if (toN > 420) toN = 420;
+
+  // 0..1 (Q16)
+  const q16_t t = q16Ratio(step > 0 ? step : 0, MORPH_STEPS);
+
+  // Ease-out (nice “snap into place”)
+  const q16_t te = ease(EASE_OUT_QUAD, t);
+
+  // Spawn origin inside the glyph (center-ish), in 1/256 LED units
+  const int32_t sx = (w - 1) * 128;
+  const int32_t sy = (DIGIT_H - 1) * 128;
+
+  memset(&out, 0, sizeof(out));
+  for (int i=0; i<toN; i++) {
+    // Rounded to the nearest LED
+    int x = (lerpQ16(sx, toPts[i].x << 8, te) + 128) >> 8;
+    int y = (lerpQ16(sy, toPts[i].y << 8, te) + 128) >> 8;
+    out.rows[y] |= (1u << (15-x));
+  }
+}
+
+// Fade-in as the pixels move
+static uint8_t spawnStepAlpha(int step) {
+  return q16ToLevel(q16Ratio(step > 0 ? step : 0, MORPH_STEPS));
+}
+
+/**
+ * Animated "spawn" morph effect for digit transitions
+ * Pixels appear from the glyph center and move into their final positions
+ * @param toBm Target bitmap to morph into
+ * @param step Current animation step (0 to MORPH_STEPS)
+ * @param x0 X position in framebuffer
+ * @param y0 Y position in framebuffer
+ * @param w Width of bitmap
+ */
+void drawSpawnMorphToTarget(const Bitmap& toBm, int step, int x0, int y0, int w) {
+  static Bitmap stepBm;
+  spawnStepBitmap(toBm, step, w, stepBm);
+  drawRows(stepBm.rows, 0, DIGIT_H, x0, y0, w, spawnStepAlpha(step));
+}
+
+// =========================
+// Spawn morph step tables
+// =========================
+// Per digit, steps 0..MORPH_STEPS-1 of the spawn morph, built on the digit's
+// first morph. Each step is stored as the span of rows it lights:
+//   header (top << 8 | rowCount), then rowCount row words
+// so the early, center-clustered steps take only a few words.
+
+static uint16_t* morphTables[10];
+static size_t morphTablesBytes = 0;
+
+/**
+ * Build the step table for digit d
+ * @return Table, or nullptr if memory is short
+ */
+static uint16_t* buildMorphTable(uint8_t d) {
+  Bitmap bm;
+
+  // Pass 1: size, pass 2: fill
+  size_t words = 0;
+  uint16_t* table = nullptr;
+  for (int pass = 0; pass < 2; pass++) {
+    uint16_t* p = table;
+    for (int step = 0; step < MORPH_STEPS; step++) {
+      spawnStepBitmap(DIGITS[d], step, DIGIT_W, bm);
+      int top = 0, bottom = DIGIT_H;
+      while (top < bottom && !bm.rows[top]) top++;
+      while (bottom > top && !bm.rows[bottom-1]) bottom--;
+
+      if (pass == 0) {
+        words += 1 + (bottom - top);
+        continue;
+      }
+      *p++ = (uint16_t)((top << 8) | (bottom - top));
+      for (int y = top; y < bottom; y++) *p++ = bm.rows[y];
+    }
+
+    if (pass == 0) {
+      table = (uint16_t*)malloc(words * sizeof(uint16_t));
+      if (!table) return nullptr;
+    }
+  }
+
+  morphTablesBytes += words * sizeof(uint16_t);
+  DBG_VERBOSE("Morph table for digit %u: %u bytes (%u total)\n",
+              d, (unsigned)(words * sizeof(uint16_t)), (unsigned)morphTablesBytes);
+  return table;
+}
+
+void drawSpawnMorphDigit(uint8_t d, int step, int x0, int y0) {
+  d %= 10;
+  if (step < 0) step = 0;
+  if (step >= MORPH_STEPS) {
+    drawBitmapSolid(DIGITS[d], x0, y0, DIGIT_W, 255);
+    return;
+  }
+
+  if (!morphTables[d]) morphTables[d] = buildMorphTable(d);
+  const uint16_t* p = morphTables[d];
+  if (!p) {
+    drawSpawnMorphToTarget(DIGITS[d], step, x0, y0, DIGIT_W);
+    return;
+  }
+
+  // Skip to this step's row span
+  for (int s = 0; s < step; s++) p += 1 + (*p & 0xFF);
+  drawRows(p + 1, *p >> 8, *p & 0xFF, x0, y0, DIGIT_W, spawnStepAlpha(step));
+}
+
+size_t morphTableBytes() {
+  return morphTablesBytes;
+}
+
+/**
+ * Pixel-pair morph from digit `from` to digit `to` (MORPH_STYLE_PAIRS)
+ * Every LED of the old digit travels to an LED of the new one along the
+ * precomputed optimal pairing, at full brightness.
+ */
+void drawPairMorph(uint8_t from, uint8_t to, int step, int x0, int y0) {
+  from %= 10;
+  to %= 10;
+  if (from == to || !morphPairsValid) {
+    drawSpawnMorphDigit(to, step, x0, y0);
+    return;
+  }
+  if (step < 0) step = 0;
+  if (step >= MORPH_STEPS) {
+    drawBitmapSolid(DIGITS[to], x0, y0, DIGIT_W, 255);
+    return;
+  }
+
+  const q16_t te = ease(EASE_IN_OUT_CUBIC, q16Ratio(step, MORPH_STEPS));
+  const uint16_t color = rgb888_to_565(cfg.ledColor);
+
+  BitPlane* plane = nullptr;
+#if ENABLE_BITPLANE_FB
+  if (bitTarget && !(plane = bitTarget->plane(color))) {
+    bitTargetFailed = true;
+    return;
+  }
+#endif
+
+  // Tables run from the lower digit to the higher one
+  const bool reverse = from > to;
+  const uint8_t t = reverse ? morphPairTable(to, from) : morphPairTable(from, to);
+  const MorphPair* mp = MORPH_PAIRS + MORPH_PAIR_OFFSETS[t];
+  const MorphPair* end = MORPH_PAIRS + MORPH_PAIR_OFFSETS[t + 1];
+
+  for (; mp < end; mp++) {
+    const int32_t ax = (reverse ? mp->toX : mp->fromX) << 8;
+    const int32_t ay = (reverse ? mp->toY : mp->fromY) << 8;
+    const int32_t bx = (reverse ? mp->fromX : mp->toX) << 8;
+    const int32_t by = (reverse ? mp->fromY : mp->toY) << 8;
+
+    // Rounded to the nearest LED
+    int x = (lerpQ16(ax, bx, te) + 128) >> 8;
+    int y = (lerpQ16(ay, by, te) + 128) >> 8;
+    if (plane) plane->set(x0 + x, y0 + (y * LED_MATRIX_H) / DIGIT_H);
+    else fbSet(x0 + x, y0 + (y * LED_MATRIX_H) / DIGIT_H, color);
+  }
+}
+
+/**
+ * Draw the 7-segment clock (into fb, or bitTarget while set)
+ * Renders HH:MM:SS format with morphing animations on digit changes
+ * Layout: 6 digits + 2 colons + 5 gaps, centered horizontally at top
+ */
+static void drawClockLayout() {
+  const int digitW = DIGIT_W;
+  const int colonW = COLON_W;
+  const int gap = DIGIT_GAP;
+
+  // HH:MM:SS with gaps between digit pairs for readability
+  // Total width = (6 * digitW) + (2 * colonW) + (5 * gap)
+  // Gaps: after each digit except the last one in each pair
+  const int totalW = (6 * digitW) + (2 * colonW) + (5 * gap);
+  int x0 = (LED_MATRIX_W - totalW) / 2;
+  if (x0 < 0) x0 = 0;
+  const int y0 = 0;  // Clock at top of display
+
+  auto digitIdx = [&](char c)->int { return (c>='0' && c<='9') ? (c-'0') : 0; };
+
+  // Indices for each digit
+  int c[6] = {
+    digitIdx(currT[0]), digitIdx(currT[1]),
+    digitIdx(currT[2]), digitIdx(currT[3]),
+    digitIdx(currT[4]), digitIdx(currT[5])
+  };
+  int p[6] = {
+    digitIdx(prevT[0]), digitIdx(prevT[1]),
+    digitIdx(prevT[2]), digitIdx(prevT[3]),
+    digitIdx(prevT[4]), digitIdx(prevT[5])
+  };
+
+  int step = morphStep;
+  if (step > MORPH_STEPS) step = MORPH_STEPS;
+
+  auto drawDigit = [&](int pos, int xx) {
+    if (currT[pos] != prevT[pos] && step < MORPH_STEPS) {
+      // Digit changed → redraw whole digit with the configured morph
+      if (cfg.morphStyle == MORPH_STYLE_PAIRS) {
+        drawPairMorph(p[pos], c[pos], step, xx, y0);
+      } else {
+        drawSpawnMorphDigit(c[pos], step, xx, y0);
+      }
+    } else {
+      // Digit unchanged or morph finished → solid draw
+      drawBitmapSolid(DIGITS[c[pos]], xx, y0, digitW, 255);
+    }
+  };
+
+  // HH with gap between digits
+  drawDigit(0, x0);
+  drawDigit(1, x0 + digitW + gap);
+
+  // : (flashing colon)
+  if (clockColon) {
+    drawBitmapSolid(COLON, x0 + 2*digitW + gap, y0, colonW, 255);
+  }
+
+  // MM with gap between digits
+  drawDigit(2, x0 + 2*digitW + gap + colonW + gap);
+  drawDigit(3, x0 + 3*digitW + 2*gap + colonW + gap);
+
+  // : (flashing colon)
+  if (clockColon) {
+    drawBitmapSolid(COLON, x0 + 4*digitW + 2*gap + colonW + gap, y0, colonW, 255);
+  }
+
+  // SS with gap between digits
+  drawDigit(4, x0 + 4*digitW + 2*gap + 2*colonW + 2*gap);
+  drawDigit(5, x0 + 5*digitW + 3*gap + 2*colonW + 2*gap);
+}
+
+#if ENABLE_BITPLANE_FB
+/**
+ * Draw the 7-segment clock as bit planes and update only the LEDs of fb that
+ * changed since the last bit-plane frame
+ * @return false if the frame cannot be drawn as bit planes (fb untouched)
+ */
+static bool drawFrameBits() {
+  BitFrame& next = bitFrames[bitFrameCur ^ 1];
+  next.clear();
+  bitTarget = &next;
+  bitTargetFailed = false;
+  drawClockLayout();
+  bitTarget = nullptr;
+  if (bitTargetFailed) return false;
+
+  if (bitFrameValid) {
+    resolveBitFrame(next, &bitFrames[bitFrameCur], fb);
+  } else {
+    fbClear(0);  // fb was drawn by something else
+    resolveBitFrame(next, nullptr, fb);
+  }
+  bitFrameCur ^= 1;
+  bitFrameValid = true;
+  return true;
+}
+#endif
+
+/**
+ * Main frame rendering function - draws the complete clock display (CLOCK_MODE_7SEG)
+ */
+void drawFrame() {
+  bool drawn = false;
+#if ENABLE_BITPLANE_FB
+  drawn = drawFrameBits();
+#endif
+  if (!drawn) {
+    fbClear(0);
+    drawClockLayout();
+  }
+
+  // Calculate effective morph steps based on morphSpeed multiplier (1-10)
+  // morphSpeed=1: 20 frames, morphSpeed=10: 200 frames
+  int effectiveMorphSteps = MORPH_STEPS * cfg.morphSpeed;
+  if (morphStep < effectiveMorphSteps) morphStep++;
+}
+
+/**
+ * Tetris Clock Mode - Renders time using falling Tetris block animations
+ * Uses TetrisMatrixDraw library to create animated digit transitions
+ * Respects 12/24 hour format and shows AM/PM indicator for 12-hour mode
+ */
+void drawFrameTetris() {
+  if (!tetrisClock) return;  // Safety check
+
+  fbClear(0);  // Clear framebuffer
+
+  // Get the 24-hour format hour for AM/PM determination
+  int hour24 = (currT[0] - '0') * 10 + (currT[1] - '0');
+  bool isPM = (hour24 >= 12);
+
+  // Format time string based on 12/24 hour preference
+  String timeStr;
+  if (cfg.use24h) {
+    // 24-hour format: "HH:MM" (00:00 to 23:59)
+    timeStr = String(currT[0]) + String(currT[1]) + ":" +
+              String(currT[2]) + String(currT[3]);
+  } else {
+    // 12-hour format: " H:MM" or "HH:MM" (space-padded for single digit hours)
+    int hour = hour24;
+    if (hour == 0) hour = 12;  // Midnight is 12 AM
+    else if (hour > 12) hour -= 12;  // Convert to 12-hour
+
+    if (hour < 10) {
+      timeStr = " " + String(hour) + ":" + String(currT[2]) + String(currT[3]);
+    } else {
+      timeStr = String(hour) + ":" + String(currT[2]) + String(currT[3]);
+    }
+  }
+
+  // Update Tetris clock (handles animation internally)
+  // Returns true when animation is complete, false while animating
+  tetrisClock->update(timeStr, cfg.use24h, clockColon, isPM);
+}
+
+/**
+ * Draw a segment pixel with bounds checking for the LED matrix
+ */
+static void drawLEDSegmentPixel(int x, int y, uint16_t color) {
+  if (x >= 0 && x < LED_MATRIX_W && y >= 0 && y < LED_MATRIX_H) {
+    fb[y][x] = color;
+  }
+}
+
+/**
+ * Helper function to draw LED segments with proper bounds checking
+ * Segments are drawn as 1-pixel thick lines (thickness handled by caller)
+ */
+static void drawLEDSegment(int x1, int y1, int x2, int y2, int thickness, uint8_t brightness, uint16_t baseColor) {
+  if (brightness == 0) return;  // Don't draw invisible segments
+
+  // Apply brightness to color (segment pixels are not dithered)
+  uint16_t color = dim565(baseColor, brightness, cfg.ledDimming, x1, y1);
+
+  // Draw line from (x1,y1) to (x2,y2) with bounds checking
+  int dx = abs(x2 - x1);
+  int dy = abs(y2 - y1);
+  int steps = max(dx, dy);
+  
+  for (int i = 0; i <= steps; i++) {
+    int x = steps > 0 ? x1 + (x2 - x1) * i / steps : x1;
+    int y = steps > 0 ? y1 + (y2 - y1) * i / steps : y1;
+    drawLEDSegmentPixel(x, y, color);
+  }
+
+  // Draw thickness (1 pixel on each side of the center line)
+  if (dx > dy) {
+    // Horizontal segment - add thickness above/below
+    for (int i = 0; i <= steps; i++) {
+      int x = steps > 0 ? x1 + (x2 - x1) * i / steps : x1;
+      int y = steps > 0 ? y1 + (y2 - y1) * i / steps : y1;
+      drawLEDSegmentPixel(x, y + 1, color);  // One pixel below
+    }
+  } else if (dy > dx) {
+    // Vertical segment - add thickness to the right
+    for (int i = 0; i <= steps; i++) {
+      int x = steps > 0 ? x1 + (x2 - x1) * i / steps : x1;
+      int y = steps > 0 ? y1 + (y2 - y1) * i / steps : y1;
+      drawLEDSegmentPixel(x + 1, y, color);  // One pixel to the right
+    }
+  }
+}
+
+/**
+ * Draw a single LED dot at the specified position
+ * LED has a glowing effect with center brighter than edges
+ * @param x X position in framebuffer
+ * @param y Y position in framebuffer
+ * @param color Base LED color (RGB565)
+ * @param brightness Brightness level (0-255)
+ */
+void drawLEDDot(int x, int y, uint16_t color, uint8_t brightness) {
+  if (x < 0 || y < 0 || x >= LED_MATRIX_W || y >= LED_MATRIX_H) return;
+
+  // Apply brightness to color
+  uint16_t scaledColor = dim565(color, brightness, cfg.ledDimming, x, y);
+
+  // Draw LED dot as a small filled circle pattern
+  // Center pixel (brightest)
+  fb[y][x] = scaledColor;
+
+  // Small glow effect (neighboring pixels at reduced brightness)
+  // Dithering needs each glow pixel's own threshold
+  const uint8_t glow = brightness / 3;
+  const bool dither = cfg.ledDimming == LED_DIM_DITHER;
+  const uint16_t glowColor = dim565(color, glow, cfg.ledDimming, x, y);
+  auto glowAt = [&](int gx, int gy) {
+    return dither ? dim565(color, glow, LED_DIM_DITHER, gx, gy) : glowColor;
+  };
+
+  // Draw surrounding glow pixels if within bounds
+  if (x > 0) fb[y][x - 1] = glowAt(x - 1, y);
+  if (x < LED_MATRIX_W - 1) fb[y][x + 1] = glowAt(x + 1, y);
+  if (y > 0) fb[y - 1][x] = glowAt(x, y - 1);
+  if (y < LED_MATRIX_H - 1) fb[y + 1][x] = glowAt(x, y + 1);
+}
+
+/**
+ * Draw a segment as a row of LED dots (classic LED display look)
+ * @param x1 Start X position
+ * @param y1 Start Y position
+ * @param x2 End X position
+ * @param y2 End Y position
+ * @param numLEDs Number of LEDs in this segment
+ * @param brightness Brightness level (0-255)
+ * @param color Base LED color (RGB565)
+ */
+void drawLEDSegmentDots(int x1, int y1, int x2, int y2, int numLEDs, uint8_t brightness, uint16_t color) {
+  if (brightness == 0) return;
+
+  // Calculate LED positions along the segment
+  const int span = numLEDs > 1 ? numLEDs - 1 : 1;
+  for (int i = 0; i < numLEDs; i++) {
+    int x = x1 + (x2 - x1) * i / span;
+    int y = y1 + (y2 - y1) * i / span;
+    drawLEDDot(x, y, color, brightness);
+  }
+}
+
+/**
+ * Render a single morphing digit at the specified position
+ * Draws each segment as a row of LED dots with the digit's color
+ * @param digit The MorphingDigit instance to render
+ * @param offsetX X offset in matrix coordinates
+ * @param offsetY Y offset in matrix coordinates
+ */
+static void renderMorphingDigit(MorphingDigit* digit, int offsetX, int offsetY, uint16_t color) {
+  // Use the provided color (user's configured LED color) instead of per-digit colors
+
+  // Render all 7 segments
+  for (int seg = 0; seg < 7; seg++) {
+    uint8_t brightness = digit->getSegmentBrightness(seg);
+    if (brightness == 0) continue;  // Skip off segments
+
+    const SegmentCoords& coords = SEGMENT_COORDS[seg];
+
+    // Apply offset and render segment as LED dots
+    int x1 = offsetX + coords.x1;
+    int y1 = offsetY + coords.y1;
+    int x2 = offsetX + coords.x2;
+    int y2 = offsetY + coords.y2;
+
+    // thickness field is now used to store number of LEDs per segment
+    int numLEDs = coords.thickness;
+    if (numLEDs < 2) numLEDs = 2;  // Minimum 2 LEDs per segment
+
+    drawLEDSegmentDots(x1, y1, x2, y2, numLEDs, brightness, color);
+  }
+}
+
+/**
+ * Draw morphing clock display (CLOCK_MODE_MORPH)
+ * Layout: HH:MM:SS centered on 64x32 matrix with 8x32 digit slots
+ * Seconds update instantly without morphing for clear readability
+ */
+void drawFrameMorph() {
+  fbClear(0);  // Clear framebuffer
+
+  // Parse current time
+  uint8_t hourTens = currT[0] - '0';
+  uint8_t hourUnits = currT[1] - '0';
+  uint8_t minuteTens = currT[2] - '0';
+  uint8_t minuteUnits = currT[3] - '0';
+  uint8_t secondTens = currT[4] - '0';
+  uint8_t secondUnits = currT[5] - '0';
+
+  // Idle frames are skipped, so lastMorphUpdate is stale when a morph starts
+  const bool wasMorphing = morphHourTens.isMorphing() || morphHourUnits.isMorphing() ||
+                           morphMinuteTens.isMorphing() || morphMinuteUnits.isMorphing();
+
+  // Only update morphing targets when the digit actually changes (for HH and MM)
+  // Seconds update instantly without morphing for clear readability
+  if (currT[0] != prevT[0]) morphHourTens.setTarget(hourTens);
+  if (currT[1] != prevT[1]) morphHourUnits.setTarget(hourUnits);
+  if (currT[2] != prevT[2]) morphMinuteTens.setTarget(minuteTens);
+  if (currT[3] != prevT[3]) morphMinuteUnits.setTarget(minuteUnits);
+  
+  // Seconds: update instantly without morphing
+  morphSecondTens.setCurrent(secondTens);
+  morphSecondUnits.setCurrent(secondUnits);
+
+  // Update morphing animations every frame for smooth transitions (HH and MM only)
+  unsigned long now = millis();
+  unsigned long delta = wasMorphing ? now - lastMorphUpdate : 0;
+  if (delta > 100) delta = 100;  // Cap delta to prevent jumps
+
+  morphHourTens.update(delta);
+  morphHourUnits.update(delta);
+  morphMinuteTens.update(delta);
+  morphMinuteUnits.update(delta);
+
+  lastMorphUpdate = now;
+
+  // Digit positioning for 64x32 matrix
+  // Layout: HH : MM : SS with proper spacing and visible colons
+  // Compact digits (18 rows) fit between sensor (y=0-4) and date (y=27-31)
+  // 6 digits at 7px wide = 42px, 2 colons at 2px = 4px, 2 digitGaps at 1px = 2px, 4 colonGaps at 1px = 4px
+  // Total width = 42 + 4 + 2 + 4 = 52px (shifted left slightly with 5px left margin)
+
+  const int digitWidth = 7;    // Digit width (matches segment coords)
+  const int digitGap = 1;      // Gap between digits within same group (HH, MM, SS)
+  const int colonGap = 1;      // Gap before/after colons (1 LED pixel)
+  const int colonWidth = 2;    // Colon width (2px for 2x2 LED dots)
+  const int startX = 5;        // Start with 5px margin on left (shifted left by 1 LED)
+  const int startY = 6;        // Start at y=6 (digits span y=7-24, leaving y=25-26 as 2-row gap before date at y=27)
+
+  uint16_t ledColor = rgb888_to_565(cfg.ledColor);
+
+  // Create dimmed color for colons (75% brightness, solid: a dithered 2x2 dot would flicker between shapes)
+  const uint8_t colonCurve = (cfg.ledDimming == LED_DIM_DITHER) ? LED_DIM_GAMMA : cfg.ledDimming;
+  uint16_t colonColor = dim565(ledColor, 191, colonCurve, 0, 0);
+
+  // Calculate positions for each digit with proper spacing
+  int x = startX;
+
+  // HH (hours)
+  renderMorphingDigit(&morphHourTens, x, startY, ledColor);
+  x += digitWidth + digitGap;
+  renderMorphingDigit(&morphHourUnits, x, startY, ledColor);
+  x += digitWidth + colonGap;
+
+  // First colon (between hours and minutes) - 2x2 LED dots with dimmed color
+  if (clockColon) {
+    int colonY1 = startY + 5;   // Upper dot position (aligned with upper segment)
+    int colonY2 = startY + 13;  // Lower dot position (aligned with lower segment)
+    // Draw 2x2 colon dots
+    for (int dy = 0; dy < 2; dy++) {
+      for (int dx = 0; dx < 2; dx++) {
+        int px = x + dx;
+        int py1 = colonY1 + dy;
+        int py2 = colonY2 + dy;
+        if (px >= 0 && px < LED_MATRIX_W) {
+          if (py1 >= 0 && py1 < LED_MATRIX_H) fb[py1][px] = colonColor;
+          if (py2 >= 0 && py2 < LED_MATRIX_H) fb[py2][px] = colonColor;
+        }
+      }
+    }
+  }
+  x += colonWidth + colonGap;
+
+  // MM (minutes)
+  renderMorphingDigit(&morphMinuteTens, x, startY, ledColor);
+  x += digitWidth + digitGap;
+  renderMorphingDigit(&morphMinuteUnits, x, startY, ledColor);
+  x += digitWidth + colonGap;
+
+  // Second colon (between minutes and seconds) - 2x2 LED dots with dimmed color
+  if (clockColon) {
+    int colonY1 = startY + 5;   // Upper dot position (aligned with upper segment)
+    int colonY2 = startY + 13;  // Lower dot position (aligned with lower segment)
+    // Draw 2x2 colon dots
+    for (int dy = 0; dy < 2; dy++) {
+      for (int dx = 0; dx < 2; dx++) {
+        int px = x + dx;
+        int py1 = colonY1 + dy;
+        int py2 = colonY2 + dy;
+        if (px >= 0 && px < LED_MATRIX_W) {
+          if (py1 >= 0 && py1 < LED_MATRIX_H) fb[py1][px] = colonColor;
+          if (py2 >= 0 && py2 < LED_MATRIX_H) fb[py2][px] = colonColor;
+        }
+      }
+    }
+  }
+  x += colonWidth + colonGap;
+
+  // SS (seconds)
+  renderMorphingDigit(&morphSecondTens, x, startY, ledColor);
+  x += digitWidth + digitGap;
+  renderMorphingDigit(&morphSecondUnits, x, startY, ledColor);
+
+  // Add date display at BOTTOM of matrix (if enabled)
+  // Using y=27 ensures date (5 rows tall) spans y=27-31 within 32-row framebuffer (y=0-31)
+  // This leaves y=26 as gap between clock digits and date (1 row gap)
+  // Format currDate string (e.g., "12/01/2026" or "2026-01-12")
+  if (cfg.morphShowDate && currDate[0] != '-') {  // Check if enabled and date is valid
+    // Center date horizontally
+    int dateWidth = getTextWidth3x5(currDate);
+    int dateX = (LED_MATRIX_W - dateWidth) / 2;
+    // Use custom date color (RGB888 -> RGB565)
+    uint16_t dateColor = rgb888_to_565(cfg.morphDateColor);
+    drawText3x5(currDate, dateX, 27, dateColor);
+  }
+
+  // Add sensor data at TOP of matrix (if enabled)
+  // Display format based on available sensor data
+  if (cfg.morphShowSensor && sensorAvailable) {
+    char sensorLine[64];  // Buffer for sensor text
+
+    // Convert temperature to display unit
+    int displayTemp = temperature;
+    const char* tempUnit = cfg.useFahrenheit ? "F" : "C";
+    if (cfg.useFahrenheit) {
+      displayTemp = (temperature * 9 / 5) + 32;
+    }
+
+    // Format sensor string based on what the detected sensors measure
+    // Compact format to fit in 64 LED matrix width
+    const bool hasHum = sensorMeasures & SENSOR_HUMIDITY;
+    const bool hasPres = sensorMeasures & SENSOR_PRESSURE;
+    if (hasHum && hasPres) {
+      snprintf(sensorLine, sizeof(sensorLine), "%d%s %d%% %dHPA",
+               displayTemp, tempUnit, humidity, pressure);
+    } else if (hasPres) {
+      snprintf(sensorLine, sizeof(sensorLine), "%d%s %dHPA",
+               displayTemp, tempUnit, pressure);
+    } else if (hasHum) {
+      snprintf(sensorLine, sizeof(sensorLine), "%d%s %d%%",
+               displayTemp, tempUnit, humidity);
+    } else {
+      // Temperature only
+      snprintf(sensorLine, sizeof(sensorLine), "%d%s", displayTemp, tempUnit);
+    }
+
+    // Draw at top of matrix (y=0), centered horizontally like the date
+    int sensorWidth = getTextWidth3x5(sensorLine);
+    int sensorX = (LED_MATRIX_W - sensorWidth) / 2;
+    // Use custom sensor color (RGB888 -> RGB565)
+    uint16_t sensorColor = rgb888_to_565(cfg.morphSensorColor);
+    drawText3x5(sensorLine, sensorX, 0, sensorColor);
+  }
+}
+
+// =========================
+// Clock Mode Dispatch
+// =========================
+
+/**
+ * Render the current clock mode
+ */
+void renderCurrentMode() {
+  switch (cfg.clockMode) {
+    case CLOCK_MODE_7SEG:
+      drawFrame();
+      break;
+
+    case CLOCK_MODE_TETRIS:
+      drawFrameTetris();
+      break;
+
+    case CLOCK_MODE_MORPH:
+      drawFrameMorph();
+      break;
+
+    default:
+      drawFrame();  // Fallback to 7-seg
+      break;
+  }
+}
+
+/**
+ * Check if current mode needs continuous updates (for animations)
+ * @return true if mode is animating and needs frequent updates
+ */
+bool modeNeedsAnimation() {
+  if (cfg.clockMode == CLOCK_MODE_TETRIS && tetrisClock) {
+    return tetrisClock->isAnimating();
+  }
+  return false;
+}
@@ -0,0 +1,140 @@
+#include "DotTileCache.h"
+#include "Color565.h"
+
+// Halo brightness just outside the core of a glowing LED (fraction of full)
+#define GLOW_HALO_LEVEL 0.45f
+
+// Supersampling grid per pixel for anti-aliased edges (N x N samples)
+#define TILE_SUPERSAMPLE 4
+
+DotTileCache::DotTileCache(size_t budgetBytes)
+    : _pool(nullptr)
+    , _entries(nullptr)
+    , _budget(budgetBytes)
+    , _slots(0)
+    , _used(0)
+    , _tileW(0)
+    , _tileH(0)
+    , _mru(0)
+    , _tick(0)
+    , _hits(0)
+    , _misses(0)
+    , _evictions(0)
+{
+}
+
+DotTileCache::~DotTileCache() {
+    free(_pool);
+    free(_entries);
+}
+
+void DotTileCache::invalidate() {
+    _used = 0;
+    _mru = 0;
+    _tileW = 0;   // Force a re-layout on next get()
+    _tileH = 0;
+}
+
+void DotTileCache::layout(uint8_t tileW, uint8_t tileH) {
+    // Pool is allocated once, on first use, and re-sliced for each tile size
+    if (!_pool) {
+        _pool = (uint16_t*)malloc(_budget);
+        if (!_pool) return;
+    }
+
+    size_t tileBytes = (size_t)tileW * tileH * sizeof(uint16_t);
+    uint16_t slots = (uint16_t)(_budget / tileBytes);
+
+    if (slots > _slots || !_entries) {
+        free(_entries);
+        _entries = (Entry*)malloc(slots * sizeof(Entry));
+        if (!_entries) slots = 0;
+    }
+
+    _slots = slots;
+    _used = 0;
+    _mru = 0;
+    _tileW = tileW;
+    _tileH = tileH;
+}
+
+uint16_t* DotTileCache::get(uint16_t color, uint8_t shape, uint8_t dot, uint8_t pitchX, uint8_t pitchY) {
+    if (pitchX != _tileW || pitchY != _tileH) {
+        layout(pitchX, pitchY);
+    }
+    if (_slots == 0) return nullptr;  // One tile does not fit the budget
+
+    const uint32_t key = ((uint32_t)color << 16) | ((uint32_t)shape << 8) | dot;
+    const size_t tilePixels = (size_t)_tileW * _tileH;
+    _tick++;
+
+    // Fast path: runs of LEDs in the same color hit the same tile
+    if (_mru < _used && _entries[_mru].key == key) {
+        _entries[_mru].lastUsed = _tick;
+        _hits++;
+        return _pool + _mru * tilePixels;
+    }
+
+    uint16_t lru = 0;
+    for (uint16_t i = 0; i < _used; i++) {
+        if (_entries[i].key == key) {
+            _entries[i].lastUsed = _tick;
+            _mru = i;
+            _hits++;
+            return _pool + i * tilePixels;
+        }
+        if (_entries[i].lastUsed < _entries[lru].lastUsed) lru = i;
+    }
+
+    // Miss: take a free slot, or evict the least recently used tile
+    uint16_t slot;
+    if (_used < _slots) {
+        slot = _used++;
+    } else {
+        slot = lru;
+        _evictions++;
+    }
+    _misses++;
+
+    uint16_t* tile = _pool + slot * tilePixels;
+    render(tile, color, shape, dot);
+    _entries[slot].key = key;
+    _entries[slot].lastUsed = _tick;
+    _mru = slot;
+    return tile;
+}
+
+void DotTileCache::render(uint16_t* tile, uint16_t color, uint8_t shape, uint8_t dot) const {
+    // Dot is centered in its cell, matching the square renderer's inset
+    const float cx = (float)((_tileW - dot) / 2) + dot * 0.5f;
+    const float cy = (float)((_tileH - dot) / 2) + dot * 0.5f;
+    const float coreR = dot * 0.5f;
+    const float glowCoreR = coreR * 0.75f;
+    const float haloR = ((_tileW < _tileH ? _tileW : _tileH) * 0.5f) + 0.5f;
+
+    for (int y = 0; y < _tileH; y++) {
+        for (int x = 0; x < _tileW; x++) {
+            // Average intensity over a sub-pixel grid for smooth edges
+            float sum = 0.0f;
+            for (int sy = 0; sy < TILE_SUPERSAMPLE; sy++) {
+                for (int sx = 0; sx < TILE_SUPERSAMPLE; sx++) {
+                    float px = x + (sx + 0.5f) / TILE_SUPERSAMPLE - cx;
+                    float py = y + (sy + 0.5f) / TILE_SUPERSAMPLE - cy;
+                    float d = sqrtf(px * px + py * py);
+
+                    if (shape == LED_SHAPE_GLOW) {
+                        if (d <= glowCoreR) {
+                            sum += 1.0f;
+                        } else if (d < haloR) {
+                            sum += GLOW_HALO_LEVEL * (1.0f - (d - glowCoreR) / (haloR - glowCoreR));
+                        }
+                    } else if (d <= coreR) {
+                        sum += 1.0f;
+                    }
+                }
+            }
+            float k = sum / (TILE_SUPERSAMPLE * TILE_SUPERSAMPLE);
+            tile[y * _tileW + x] = scale565(color, level565(k));
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#include "I2CBus.h"
+
+#include <Wire.h>
+
+static const char* const DEVICE_NAMES[I2C_DEV_COUNT] = {
+    "touch",
+    "sensor",
+};
+
+struct I2CJob {
+    I2CDevice device;
+    I2CJobFn fn;
+    void* arg;
+    I2CRequest* req;          // submit(): completion flag, or nullptr
+    SemaphoreHandle_t done;   // run(): given when the job has run
+    bool* result;             // run(): the job's result
+    uint32_t queuedUs;
+};
+
+static QueueHandle_t queues[I2C_PRIO_COUNT];
+static TaskHandle_t busTask = nullptr;
+static I2CDeviceStats deviceStats[I2C_DEV_COUNT];
+
+/**
+ * Bus task: one notification per queued job; takes the most urgent job each time
+ */
+static void i2cBusTask(void*) {
+    for (;;) {
+        ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+
+        I2CJob job;
+        bool found = false;
+        for (uint8_t p = 0; p < I2C_PRIO_COUNT && !found; p++) {
+            found = xQueueReceive(queues[p], &job, 0) == pdTRUE;
+        }
+        if (!found) continue;
+
+        const uint32_t startUs = micros();
+        const bool ok = job.fn(job.arg);
+        const uint32_t endUs = micros();
+
+        I2CDeviceStats& s = deviceStats[job.device];
+        const uint32_t waitUs = startUs - job.queuedUs;
+        const uint32_t runUs = endUs - startUs;
+        s.jobs++;
+        if (!ok) s.errors++;
+        s.totalWaitUs += waitUs;
+        if (waitUs > s.maxWaitUs) s.maxWaitUs = waitUs;
+        s.totalRunUs += runUs;
+        if (runUs > s.maxRunUs) s.maxRunUs = runUs;
+
+        if (job.req) {
+            job.req->ok = ok;
+            job.req->done = true;
+        }
+        if (job.done) {
+            *job.result = ok;
+            xSemaphoreGive(job.done);
+        }
+    }
+}
+
+static bool enqueue(const I2CJob& job, I2CPriority prio) {
+    if (!busTask || prio >= I2C_PRIO_COUNT || job.device >= I2C_DEV_COUNT) return false;
+    if (xQueueSend(queues[prio], &job, 0) != pdTRUE) return false;
+    xTaskNotifyGive(busTask);
+    return true;
+}
+
+namespace I2CBus {
+
+void begin(int sda, int scl) {
+    if (busTask) return;
+    Wire.begin(sda, scl);
+    for (uint8_t p = 0; p < I2C_PRIO_COUNT; p++) {
+        queues[p] = xQueueCreate(I2C_QUEUE_LEN, sizeof(I2CJob));
+    }
+    xTaskCreatePinnedToCore(i2cBusTask, "i2c", I2C_TASK_STACK, nullptr,
+                            I2C_TASK_PRIORITY, &busTask, I2C_TASK_CORE);
+}
+
+bool submit(I2CDevice device, I2CPriority prio, I2CJobFn fn, void* arg, I2CRequest* req) {
+    if (req) {
+        req->done = false;
+        req->ok = false;
+    }
+    I2CJob job = {device, fn, arg, req, nullptr, nullptr, (uint32_t)micros()};
+    return enqueue(job, prio);
+}
+
+bool run(I2CDevice device, I2CPriority prio, I2CJobFn fn, void* arg) {
+    // The semaphore lives on this stack: wait for the job however long it
+    // takes, the bus task gives it exactly once
+    StaticSemaphore_t doneBuf;
+    SemaphoreHandle_t done = xSemaphoreCreateBinaryStatic(&doneBuf);
+    bool result = false;
+
+    I2CJob job = {device, fn, arg, nullptr, done, &result, (uint32_t)micros()};
+    if (enqueue(job, prio)) xSemaphoreTake(done, portMAX_DELAY);
+    vSemaphoreDelete(done);
+    return result;
+}
+
+const I2CDeviceStats& stats(I2CDevice device) {
+    return deviceStats[device < I2C_DEV_COUNT ? device : 0];
+}
+
+const char* name(I2CDevice device) {
+    return device < I2C_DEV_COUNT ? DEVICE_NAMES[device] : "?";
+}
+
+void resetStats() {
+    memset(deviceStats, 0, sizeof(deviceStats));
+}
+
+}  // namespace I2CBus
@@ -0,0 +1,155 @@
+#include "MirrorStream.h"
+
+// Delta header: type, seq, base seq, run count
+#define DELTA_HEADER_BYTES 11
+#define DELTA_RUN_BYTES    5
+
+static inline void put16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+
+static inline uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+MirrorStream::MirrorStream()
+    : _seq(0)
+    , _open(0)
+    , _keyframes(0)
+    , _deltas(0)
+    , _bytesSent(0)
+    , _bytesRaw(0)
+{
+    memset(_clients, 0, sizeof(_clients));
+}
+
+MirrorStream::~MirrorStream() {
+    for (uint8_t i = 0; i < MIRROR_WS_MAX_CLIENTS; i++) close(i);
+}
+
+bool MirrorStream::open(uint8_t client) {
+    if (client >= MIRROR_WS_MAX_CLIENTS) return false;
+    close(client);
+
+    Client& c = _clients[client];
+    c.acked = (uint16_t*)malloc(FRAME_PIXELS * sizeof(uint16_t));
+    c.inFlight = (uint16_t*)malloc(FRAME_PIXELS * sizeof(uint16_t));
+    if (!c.acked || !c.inFlight) {
+        close(client);
+        return false;
+    }
+    _open++;
+    return true;
+}
+
+void MirrorStream::close(uint8_t client) {
+    if (client >= MIRROR_WS_MAX_CLIENTS) return;
+    Client& c = _clients[client];
+    if (c.acked && c.inFlight) _open--;
+    free(c.acked);
+    free(c.inFlight);
+    memset(&c, 0, sizeof(c));
+}
+
+bool MirrorStream::receive(uint8_t client, const uint8_t* data, size_t len) {
+    if (client >= MIRROR_WS_MAX_CLIENTS || len != 5 || data[0] != MIRROR_MSG_ACK) return false;
+
+    Client& c = _clients[client];
+    if (!c.acked) return false;
+
+    // Stale acks (after a timeout resync) are ignored
+    const uint32_t seq = get32(data + 1);
+    if (!c.waiting || seq != c.inFlightSeq) return true;
+
+    // The in-flight frame becomes the new delta base
+    uint16_t* t = c.acked;
+    c.acked = c.inFlight;
+    c.inFlight = t;
+    c.ackedSeq = seq;
+    c.hasBase = true;
+    c.waiting = false;
+    return true;
+}
+
+size_t MirrorStream::encode(uint8_t client, const uint16_t* frame, uint32_t frameId, uint32_t nowMs, uint8_t* out) {
+    if (client >= MIRROR_WS_MAX_CLIENTS) return 0;
+    Client& c = _clients[client];
+    if (!c.acked) return 0;
+
+    if (c.waiting) {
+        if (nowMs - c.sentAt < MIRROR_ACK_TIMEOUT_MS) return 0;
+        // Lost or very late ack: the client's state is unknown, resync
+        c.waiting = false;
+        c.hasBase = false;
+    } else if (c.hasBase && frameId == c.frameId) {
+        return 0;  // Client already holds this frame
+    }
+    c.frameId = frameId;
+
+    const uint32_t seq = ++_seq;
+    size_t n = 0;
+    if (c.hasBase) {
+        n = encodeDelta(c, frame, seq, out);
+        if (n == DELTA_HEADER_BYTES) return 0;  // No change against the base
+    }
+    if (n) {
+        _deltas++;
+    } else {
+        n = encodeKeyframe(frame, seq, out);
+        _keyframes++;
+    }
+
+    memcpy(c.inFlight, frame, FRAME_PIXELS * sizeof(uint16_t));
+    c.inFlightSeq = seq;
+    c.sentAt = nowMs;
+    c.waiting = true;
+
+    _bytesSent += n;
+    _bytesRaw += KEYFRAME_BYTES;
+    return n;
+}
+
+size_t MirrorStream::encodeKeyframe(const uint16_t* frame, uint32_t seq, uint8_t* out) const {
+    out[0] = MIRROR_MSG_KEYFRAME;
+    put32(out + 1, seq);
+    uint8_t* p = out + 5;
+    for (size_t i = 0; i < FRAME_PIXELS; i++, p += 2) put16(p, frame[i]);
+    return KEYFRAME_BYTES;
+}
+
+size_t MirrorStream::encodeDelta(const Client& c, const uint16_t* frame, uint32_t seq, uint8_t* out) const {
+    const uint16_t* base = c.acked;
+    uint8_t* p = out + DELTA_HEADER_BYTES;
+    uint16_t runs = 0;
+
+    size_t i = 0;
+    while (i < FRAME_PIXELS) {
+        if (frame[i] == base[i]) { i++; continue; }
+
+        // Run of changed LEDs with one color (may wrap onto the next row)
+        const uint16_t color = frame[i];
+        const size_t start = i;
+        while (i < FRAME_PIXELS && i - start < 255 && frame[i] == color && base[i] != color) i++;
+
+        if ((size_t)(p - out) + DELTA_RUN_BYTES >= KEYFRAME_BYTES) return 0;  // Keyframe is smaller
+        put16(p, (uint16_t)start);
+        p[2] = (uint8_t)(i - start);
+        put16(p + 3, color);
+        p += DELTA_RUN_BYTES;
+        runs++;
+    }
+
+    out[0] = MIRROR_MSG_DELTA;
+    put32(out + 1, seq);
+    put32(out + 5, c.ackedSeq);
+    put16(out + 9, runs);
+    return p - out;
+}
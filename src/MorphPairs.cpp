@@ -0,0 +1,1289 @@
+// Generated by tools/gen_morph_pairs.py - do not edit
+#include "MorphPairs.h"
+
+const MorphPair MORPH_PAIRS[9780] = {
+  // 0 <-> 1: 248 pairs, total squared travel 2248
+  {0,1,5,1}, {1,1,5,1}, {2,1,5,1}, {3,1,6,1}, {4,1,6,1}, {5,1,7,1}, {6,1,7,1}, {7,1,8,1},
+  {8,1,8,1}, {0,2,5,2}, {1,2,5,2}, {2,2,6,2}, {3,2,6,2}, {4,2,7,3}, {5,2,7,2}, {6,2,7,2},
+  {7,2,8,2}, {8,2,8,2}, {0,3,5,3}, {1,3,5,3}, {2,3,6,3}, {3,3,6,3}, {4,3,7,4}, {5,3,7,3},
+  {6,3,8,4}, {7,3,8,3}, {8,3,8,3}, {0,4,5,4}, {1,4,5,4}, {2,4,6,4}, {3,4,6,4}, {4,4,6,5},
+  {5,4,7,4}, {6,4,7,5}, {7,4,8,4}, {8,4,8,4}, {0,5,5,5}, {1,5,5,5}, {2,5,6,5}, {3,5,6,6},
+  {5,5,7,5}, {6,5,7,6}, {7,5,8,5}, {8,5,8,5}, {0,6,5,6}, {1,6,5,6}, {2,6,6,6}, {3,6,6,7},
+  {5,6,7,6}, {6,6,7,7}, {7,6,8,6}, {8,6,8,6}, {0,7,5,7}, {1,7,5,7}, {2,7,6,7}, {3,7,6,8},
+  {5,7,7,7}, {6,7,7,8}, {7,7,8,7}, {8,7,8,7}, {0,8,5,8}, {1,8,5,8}, {2,8,6,8}, {3,8,6,9},
+  {5,8,7,8}, {6,8,7,8}, {7,8,8,8}, {8,8,8,8}, {0,9,5,9}, {1,9,5,9}, {2,9,6,9}, {3,9,6,10},
+  {5,9,7,9}, {6,9,7,9}, {7,9,8,9}, {8,9,8,9}, {0,10,5,10}, {1,10,5,10}, {2,10,6,10}, {3,10,6,11},
+  {5,10,7,10}, {6,10,7,10}, {7,10,8,10}, {8,10,8,10}, {0,11,5,11}, {1,11,5,11}, {2,11,6,11}, {3,11,6,12},
+  {5,11,7,11}, {6,11,7,11}, {7,11,8,11}, {8,11,8,11}, {0,12,5,12}, {1,12,5,12}, {2,12,6,12}, {3,12,6,12},
+  {5,12,7,12}, {6,12,7,12}, {7,12,8,12}, {8,12,8,12}, {0,13,5,13}, {1,13,5,13}, {2,13,6,13}, {3,13,6,13},
+  {5,13,7,13}, {6,13,7,13}, {7,13,8,13}, {8,13,8,13}, {0,14,5,14}, {1,14,5,14}, {2,14,6,14}, {3,14,6,14},
+  {5,14,7,14}, {6,14,7,14}, {7,14,8,14}, {8,14,8,14}, {0,15,5,15}, {1,15,5,15}, {2,15,6,15}, {3,15,6,15},
+  {5,15,7,15}, {6,15,7,15}, {7,15,8,15}, {8,15,8,15}, {0,16,5,16}, {1,16,5,16}, {2,16,6,16}, {3,16,6,16},
+  {5,16,7,16}, {6,16,7,16}, {7,16,8,16}, {8,16,8,16}, {0,17,5,16}, {1,17,5,17}, {2,17,6,17}, {3,17,6,17},
+  {5,17,7,17}, {6,17,7,17}, {7,17,8,17}, {8,17,8,17}, {0,18,5,18}, {1,18,5,17}, {2,18,6,18}, {3,18,6,18},
+  {5,18,7,18}, {6,18,7,18}, {7,18,8,18}, {8,18,8,18}, {0,19,5,19}, {1,19,5,18}, {2,19,6,19}, {3,19,6,19},
+  {5,19,7,19}, {6,19,8,19}, {7,19,8,19}, {8,19,8,19}, {0,20,5,20}, {1,20,5,19}, {2,20,6,20}, {3,20,6,20},
+  {5,20,7,19}, {6,20,7,20}, {7,20,8,20}, {8,20,8,20}, {0,21,5,21}, {1,21,5,20}, {2,21,6,21}, {3,21,6,21},
+  {5,21,7,20}, {6,21,7,21}, {7,21,8,21}, {8,21,8,21}, {0,22,5,22}, {1,22,5,21}, {2,22,6,22}, {3,22,6,22},
+  {5,22,7,21}, {6,22,7,22}, {7,22,8,22}, {8,22,8,22}, {0,23,5,23}, {1,23,5,22}, {2,23,6,23}, {3,23,6,23},
+  {5,23,7,23}, {6,23,7,22}, {7,23,8,23}, {8,23,8,23}, {0,24,5,24}, {1,24,5,23}, {2,24,6,24}, {3,24,6,24},
+  {5,24,7,23}, {6,24,7,23}, {7,24,8,24}, {8,24,8,24}, {0,25,5,25}, {1,25,5,24}, {2,25,6,25}, {3,25,6,25},
+  {5,25,7,24}, {6,25,7,24}, {7,25,8,25}, {8,25,8,25}, {0,26,5,26}, {1,26,5,25}, {2,26,6,26}, {3,26,6,26},
+  {5,26,7,25}, {6,26,7,25}, {7,26,8,26}, {8,26,8,26}, {0,27,5,27}, {1,27,5,26}, {2,27,6,27}, {3,27,6,27},
+  {4,27,7,26}, {5,27,7,26}, {6,27,7,27}, {7,27,8,27}, {8,27,8,27}, {0,28,5,27}, {1,28,5,28}, {2,28,6,27},
+  {3,28,6,28}, {4,28,7,28}, {5,28,7,28}, {6,28,7,27}, {7,28,8,28}, {8,28,8,28}, {0,29,5,29}, {1,29,5,28},
+  {2,29,6,28}, {3,29,6,29}, {4,29,6,29}, {5,29,7,29}, {6,29,7,29}, {7,29,8,29}, {8,29,8,29}, {0,30,5,30},
+  {1,30,5,30}, {2,30,5,29}, {3,30,6,30}, {4,30,6,30}, {5,30,7,30}, {6,30,7,30}, {7,30,8,30}, {8,30,8,30},
+  // 0 <-> 2: 248 pairs, total squared travel 829
+  {0,1,0,1}, {1,1,1,1}, {2,1,3,1}, {3,1,4,1}, {4,1,5,1}, {5,1,5,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,1}, {1,2,2,1}, {2,2,2,1}, {3,2,3,2}, {4,2,4,2}, {5,2,5,2}, {6,2,6,2},
+  {7,2,7,1}, {8,2,8,2}, {0,3,0,2}, {1,3,1,2}, {2,3,2,2}, {3,3,4,2}, {4,3,5,3}, {5,3,6,2},
+  {6,3,7,3}, {7,3,7,2}, {8,3,8,3}, {0,4,1,2}, {1,4,1,3}, {2,4,3,3}, {3,4,4,3}, {4,4,5,3},
+  {5,4,6,3}, {6,4,7,4}, {7,4,7,4}, {8,4,8,3}, {0,5,0,3}, {1,5,2,3}, {2,5,3,3}, {3,5,5,4},
+  {5,5,6,5}, {6,5,6,4}, {7,5,8,5}, {8,5,8,4}, {0,6,0,3}, {1,6,2,4}, {2,6,4,4}, {3,6,5,5},
+  {5,6,6,5}, {6,6,7,6}, {7,6,7,5}, {8,6,8,5}, {0,7,1,4}, {1,7,2,4}, {2,7,4,4}, {3,7,5,6},
+  {5,7,6,6}, {6,7,7,6}, {7,7,8,7}, {8,7,8,6}, {0,8,0,4}, {1,8,3,4}, {2,8,5,7}, {3,8,6,7},
+  {5,8,6,7}, {6,8,7,7}, {7,8,8,7}, {8,8,8,8}, {0,9,5,9}, {1,9,5,8}, {2,9,5,9}, {3,9,6,8},
+  {5,9,7,8}, {6,9,7,8}, {7,9,8,9}, {8,9,8,9}, {0,10,1,14}, {1,10,5,11}, {2,10,5,10}, {3,10,6,9},
+  {5,10,6,10}, {6,10,7,9}, {7,10,7,10}, {8,10,8,10}, {0,11,0,14}, {1,11,2,14}, {2,11,5,11}, {3,11,5,12},
+  {5,11,6,11}, {6,11,7,10}, {7,11,8,11}, {8,11,8,11}, {0,12,1,15}, {1,12,2,14}, {2,12,3,14}, {3,12,5,13},
+  {5,12,6,12}, {6,12,7,12}, {7,12,7,11}, {8,12,8,12}, {0,13,0,15}, {1,13,2,15}, {2,13,4,14}, {3,13,4,14},
+  {5,13,5,13}, {6,13,7,12}, {7,13,7,13}, {8,13,8,13}, {0,14,0,16}, {1,14,1,15}, {2,14,3,15}, {3,14,4,15},
+  {5,14,5,14}, {6,14,6,13}, {7,14,7,14}, {8,14,8,13}, {0,15,0,16}, {1,15,1,16}, {2,15,2,16}, {3,15,3,15},
+  {5,15,5,15}, {6,15,6,14}, {7,15,7,14}, {8,15,8,14}, {0,16,0,17}, {1,16,1,17}, {2,16,2,16}, {3,16,3,16},
+  {5,16,5,16}, {6,16,6,15}, {7,16,7,15}, {8,16,8,15}, {0,17,0,18}, {1,17,1,17}, {2,17,2,17}, {3,17,3,17},
+  {5,17,4,16}, {6,17,5,16}, {7,17,6,15}, {8,17,8,16}, {0,18,0,18}, {1,18,1,18}, {2,18,2,18}, {3,18,3,18},
+  {5,18,4,17}, {6,18,4,17}, {7,18,6,16}, {8,18,7,16}, {0,19,0,19}, {1,19,1,19}, {2,19,1,19}, {3,19,2,19},
+  {5,19,3,18}, {6,19,5,17}, {7,19,6,17}, {8,19,7,16}, {0,20,0,20}, {1,20,0,20}, {2,20,1,20}, {3,20,2,20},
+  {5,20,3,20}, {6,20,3,19}, {7,20,6,17}, {8,20,8,17}, {0,21,0,21}, {1,21,0,22}, {2,21,1,21}, {3,21,1,21},
+  {5,21,2,21}, {6,21,3,21}, {7,21,3,20}, {8,21,7,17}, {0,22,0,22}, {1,22,1,23}, {2,22,1,22}, {3,22,2,23},
+  {5,22,2,22}, {6,22,3,22}, {7,22,3,22}, {8,22,3,23}, {0,23,0,24}, {1,23,0,23}, {2,23,1,23}, {3,23,2,24},
+  {5,23,3,24}, {6,23,3,24}, {7,23,6,27}, {8,23,7,27}, {0,24,0,24}, {1,24,1,25}, {2,24,1,24}, {3,24,2,25},
+  {5,24,3,25}, {6,24,3,26}, {7,24,6,27}, {8,24,8,27}, {0,25,0,25}, {1,25,0,26}, {2,25,1,25}, {3,25,2,26},
+  {5,25,3,27}, {6,25,4,27}, {7,25,5,27}, {8,25,8,28}, {0,26,0,27}, {1,26,0,26}, {2,26,1,26}, {3,26,2,26},
+  {5,26,4,27}, {6,26,5,28}, {7,26,6,28}, {8,26,8,28}, {0,27,0,28}, {1,27,1,27}, {2,27,1,27}, {3,27,2,27},
+  {4,27,3,28}, {5,27,4,28}, {6,27,5,28}, {7,27,7,28}, {8,27,8,29}, {0,28,0,28}, {1,28,1,28}, {2,28,2,28},
+  {3,28,3,29}, {4,28,3,28}, {5,28,4,29}, {6,28,5,29}, {7,28,6,29}, {8,28,7,29}, {0,29,0,29}, {1,29,1,29},
+  {2,29,2,29}, {3,29,2,29}, {4,29,3,30}, {5,29,4,29}, {6,29,5,30}, {7,29,7,30}, {8,29,7,29}, {0,30,0,30},
+  {1,30,1,30}, {2,30,1,30}, {3,30,2,30}, {4,30,3,30}, {5,30,4,30}, {6,30,6,30}, {7,30,6,30}, {8,30,8,30},
+  // 0 <-> 3: 248 pairs, total squared travel 859
+  {0,1,0,1}, {1,1,1,1}, {2,1,3,1}, {3,1,4,1}, {4,1,5,1}, {5,1,6,1}, {6,1,7,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,1}, {1,2,2,1}, {2,2,2,1}, {3,2,4,2}, {4,2,5,1}, {5,2,5,2}, {6,2,6,2},
+  {7,2,7,2}, {8,2,8,2}, {0,3,0,2}, {1,3,1,2}, {2,3,3,2}, {3,3,4,2}, {4,3,5,3}, {5,3,6,2},
+  {6,3,7,3}, {7,3,8,3}, {8,3,8,3}, {0,4,1,2}, {1,4,2,2}, {2,4,3,3}, {3,4,4,3}, {4,4,5,3},
+  {5,4,6,3}, {6,4,7,4}, {7,4,7,4}, {8,4,8,4}, {0,5,0,3}, {1,5,2,3}, {2,5,3,3}, {3,5,4,4},
+  {5,5,6,5}, {6,5,6,4}, {7,5,8,5}, {8,5,8,5}, {0,6,0,3}, {1,6,1,3}, {2,6,3,4}, {3,6,5,4},
+  {5,6,6,5}, {6,6,7,6}, {7,6,7,5}, {8,6,8,6}, {0,7,1,4}, {1,7,2,4}, {2,7,4,4}, {3,7,5,5},
+  {5,7,6,6}, {6,7,7,6}, {7,7,8,7}, {8,7,8,7}, {0,8,0,4}, {1,8,2,4}, {2,8,5,6}, {3,8,6,7},
+  {5,8,6,7}, {6,8,7,7}, {7,8,7,8}, {8,8,8,8}, {0,9,5,9}, {1,9,5,8}, {2,9,5,7}, {3,9,6,8},
+  {5,9,7,8}, {6,9,7,9}, {7,9,8,9}, {8,9,8,9}, {0,10,5,10}, {1,10,5,11}, {2,10,5,9}, {3,10,6,9},
+  {5,10,6,10}, {6,10,7,10}, {7,10,7,10}, {8,10,8,10}, {0,11,0,14}, {1,11,3,14}, {2,11,5,11}, {3,11,5,12},
+  {5,11,6,11}, {6,11,7,11}, {7,11,8,11}, {8,11,8,11}, {0,12,1,14}, {1,12,2,14}, {2,12,5,13}, {3,12,5,13},
+  {5,12,6,12}, {6,12,7,12}, {7,12,7,12}, {8,12,8,12}, {0,13,0,15}, {1,13,2,14}, {2,13,4,14}, {3,13,5,14},
+  {5,13,6,13}, {6,13,7,13}, {7,13,8,13}, {8,13,8,13}, {0,14,1,15}, {1,14,3,15}, {2,14,4,14}, {3,14,5,15},
+  {5,14,6,14}, {6,14,7,14}, {7,14,7,14}, {8,14,8,14}, {0,15,1,15}, {1,15,2,15}, {2,15,3,15}, {3,15,4,15},
+  {5,15,6,15}, {6,15,6,15}, {7,15,7,15}, {8,15,8,15}, {0,16,0,16}, {1,16,2,16}, {2,16,3,16}, {3,16,5,16},
+  {5,16,6,16}, {6,16,7,16}, {7,16,7,16}, {8,16,8,16}, {0,17,0,16}, {1,17,2,16}, {2,17,4,16}, {3,17,5,16},
+  {5,17,6,17}, {6,17,6,17}, {7,17,7,17}, {8,17,8,17}, {0,18,1,16}, {1,18,2,17}, {2,18,4,17}, {3,18,5,17},
+  {5,18,6,18}, {6,18,7,18}, {7,18,8,18}, {8,18,8,18}, {0,19,1,17}, {1,19,3,17}, {2,19,4,17}, {3,19,5,18},
+  {5,19,6,19}, {6,19,6,19}, {7,19,7,19}, {8,19,8,19}, {0,20,1,17}, {1,20,5,20}, {2,20,5,19}, {3,20,5,18},
+  {5,20,6,20}, {6,20,7,20}, {7,20,8,20}, {8,20,8,20}, {0,21,0,17}, {1,21,5,20}, {2,21,5,21}, {3,21,6,21},
+  {5,21,6,21}, {6,21,7,21}, {7,21,8,22}, {8,21,8,21}, {0,22,5,22}, {1,22,5,23}, {2,22,5,22}, {3,22,6,22},
+  {5,22,6,23}, {6,22,7,22}, {7,22,8,23}, {8,22,8,22}, {0,23,1,27}, {1,23,5,24}, {2,23,5,24}, {3,23,6,24},
+  {5,23,6,23}, {6,23,7,23}, {7,23,7,24}, {8,23,8,24}, {0,24,1,27}, {1,24,2,27}, {2,24,5,26}, {3,24,5,25},
+  {5,24,6,25}, {6,24,6,25}, {7,24,7,25}, {8,24,8,24}, {0,25,0,27}, {1,25,3,27}, {2,25,4,27}, {3,25,5,26},
+  {5,25,6,26}, {6,25,7,26}, {7,25,7,26}, {8,25,8,25}, {0,26,0,28}, {1,26,2,28}, {2,26,3,28}, {3,26,4,27},
+  {5,26,5,27}, {6,26,6,27}, {7,26,7,27}, {8,26,8,26}, {0,27,0,28}, {1,27,1,28}, {2,27,3,28}, {3,27,4,28},
+  {4,27,5,28}, {5,27,6,28}, {6,27,6,27}, {7,27,8,28}, {8,27,8,27}, {0,28,0,29}, {1,28,2,29}, {2,28,2,29},
+  {3,28,3,29}, {4,28,4,29}, {5,28,5,28}, {6,28,7,29}, {7,28,7,28}, {8,28,8,28}, {0,29,0,30}, {1,29,1,29},
+  {2,29,3,30}, {3,29,4,29}, {4,29,5,29}, {5,29,5,30}, {6,29,6,29}, {7,29,7,29}, {8,29,8,29}, {0,30,1,30},
+  {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,30}, {5,30,6,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 0 <-> 4: 248 pairs, total squared travel 2499
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,3,1}, {5,1,5,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,0,1}, {2,2,2,2}, {3,2,2,2}, {4,2,3,2}, {5,2,5,2}, {6,2,6,2},
+  {7,2,7,2}, {8,2,7,1}, {0,3,0,3}, {1,3,1,2}, {2,3,1,3}, {3,3,2,3}, {4,3,3,3}, {5,3,6,2},
+  {6,3,6,3}, {7,3,7,3}, {8,3,8,2}, {0,4,0,4}, {1,4,1,3}, {2,4,2,4}, {3,4,3,4}, {4,4,5,3},
+  {5,4,5,3}, {6,4,6,4}, {7,4,7,4}, {8,4,8,3}, {0,5,0,4}, {1,5,1,4}, {2,5,2,5}, {3,5,3,4},
+  {5,5,5,4}, {6,5,6,5}, {7,5,7,4}, {8,5,8,4}, {0,6,0,5}, {1,6,1,5}, {2,6,2,5}, {3,6,3,5},
+  {5,6,5,5}, {6,6,6,5}, {7,6,7,5}, {8,6,8,5}, {0,7,0,6}, {1,7,1,6}, {2,7,2,6}, {3,7,3,6},
+  {5,7,5,6}, {6,7,6,6}, {7,7,7,6}, {8,7,8,6}, {0,8,0,7}, {1,8,1,6}, {2,8,2,7}, {3,8,3,7},
+  {5,8,5,6}, {6,8,6,7}, {7,8,7,7}, {8,8,8,7}, {0,9,0,7}, {1,9,1,7}, {2,9,2,8}, {3,9,3,7},
+  {5,9,5,7}, {6,9,6,8}, {7,9,7,7}, {8,9,8,8}, {0,10,0,8}, {1,10,1,8}, {2,10,2,8}, {3,10,3,8},
+  {5,10,5,8}, {6,10,6,8}, {7,10,7,8}, {8,10,8,9}, {0,11,0,9}, {1,11,1,9}, {2,11,2,9}, {3,11,3,9},
+  {5,11,5,9}, {6,11,5,9}, {7,11,6,9}, {8,11,7,9}, {0,12,0,10}, {1,12,1,9}, {2,12,2,10}, {3,12,3,10},
+  {5,12,5,10}, {6,12,6,10}, {7,12,7,10}, {8,12,8,10}, {0,13,0,10}, {1,13,1,10}, {2,13,2,11}, {3,13,3,10},
+  {5,13,5,11}, {6,13,6,11}, {7,13,7,10}, {8,13,8,11}, {0,14,0,11}, {1,14,1,11}, {2,14,2,11}, {3,14,3,11},
+  {5,14,5,12}, {6,14,6,11}, {7,14,7,11}, {8,14,8,12}, {0,15,0,12}, {1,15,1,12}, {2,15,2,12}, {3,15,3,12},
+  {5,15,5,12}, {6,15,6,12}, {7,15,7,12}, {8,15,8,13}, {0,16,0,13}, {1,16,1,12}, {2,16,2,13}, {3,16,3,13},
+  {5,16,5,13}, {6,16,6,13}, {7,16,7,13}, {8,16,7,13}, {0,17,0,13}, {1,17,1,13}, {2,17,2,14}, {3,17,3,13},
+  {5,17,5,14}, {6,17,6,14}, {7,17,7,14}, {8,17,8,14}, {0,18,0,14}, {1,18,1,14}, {2,18,2,14}, {3,18,3,14},
+  {5,18,4,14}, {6,18,5,14}, {7,18,7,15}, {8,18,8,15}, {0,19,0,15}, {1,19,2,15}, {2,19,3,15}, {3,19,4,15},
+  {5,19,5,15}, {6,19,6,15}, {7,19,7,15}, {8,19,8,16}, {0,20,0,15}, {1,20,1,15}, {2,20,3,15}, {3,20,4,16},
+  {5,20,5,16}, {6,20,6,16}, {7,20,7,16}, {8,20,8,16}, {0,21,0,16}, {1,21,1,16}, {2,21,3,16}, {3,21,4,16},
+  {5,21,6,17}, {6,21,6,17}, {7,21,7,17}, {8,21,8,17}, {0,22,1,16}, {1,22,2,16}, {2,22,4,17}, {3,22,5,17},
+  {5,22,6,18}, {6,22,7,18}, {7,22,8,19}, {8,22,8,18}, {0,23,1,17}, {1,23,2,17}, {2,23,5,18}, {3,23,5,18},
+  {5,23,6,19}, {6,23,7,19}, {7,23,8,19}, {8,23,8,20}, {0,24,0,17}, {1,24,3,17}, {2,24,5,19}, {3,24,5,19},
+  {5,24,6,20}, {6,24,7,20}, {7,24,7,20}, {8,24,8,21}, {0,25,2,17}, {1,25,5,21}, {2,25,5,20}, {3,25,6,21},
+  {5,25,6,22}, {6,25,7,21}, {7,25,7,21}, {8,25,8,22}, {0,26,5,23}, {1,26,5,22}, {2,26,6,23}, {3,26,6,23},
+  {5,26,6,22}, {6,26,7,23}, {7,26,7,22}, {8,26,8,23}, {0,27,5,25}, {1,27,5,24}, {2,27,5,24}, {3,27,6,24},
+  {4,27,6,25}, {5,27,7,25}, {6,27,7,24}, {7,27,8,24}, {8,27,8,25}, {0,28,5,26}, {1,28,5,27}, {2,28,5,25},
+  {3,28,6,27}, {4,28,6,26}, {5,28,7,26}, {6,28,7,26}, {7,28,8,26}, {8,28,8,25}, {0,29,5,29}, {1,29,5,28},
+  {2,29,6,28}, {3,29,6,28}, {4,29,7,28}, {5,29,7,27}, {6,29,7,27}, {7,29,8,28}, {8,29,8,27}, {0,30,5,30},
+  {1,30,5,30}, {2,30,6,30}, {3,30,6,29}, {4,30,6,29}, {5,30,7,30}, {6,30,7,29}, {7,30,8,30}, {8,30,8,29},
+  // 0 <-> 5: 248 pairs, total squared travel 797
+  {0,1,0,1}, {1,1,0,1}, {2,1,1,1}, {3,1,2,1}, {4,1,3,1}, {5,1,4,1}, {6,1,5,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,1,2}, {2,2,2,1}, {3,2,3,2}, {4,2,4,2}, {5,2,5,2}, {6,2,5,1},
+  {7,2,6,1}, {8,2,7,1}, {0,3,0,3}, {1,3,1,2}, {2,3,2,2}, {3,3,3,3}, {4,3,3,3}, {5,3,4,2},
+  {6,3,6,2}, {7,3,7,2}, {8,3,8,2}, {0,4,0,3}, {1,4,1,3}, {2,4,2,3}, {3,4,2,4}, {4,4,3,4},
+  {5,4,4,3}, {6,4,5,3}, {7,4,6,2}, {8,4,8,3}, {0,5,0,4}, {1,5,1,4}, {2,5,2,4}, {3,5,2,5},
+  {5,5,4,4}, {6,5,5,3}, {7,5,6,3}, {8,5,8,3}, {0,6,0,5}, {1,6,1,5}, {2,6,1,5}, {3,6,2,6},
+  {5,6,3,5}, {6,6,4,4}, {7,6,5,4}, {8,6,7,3}, {0,7,0,6}, {1,7,1,6}, {2,7,1,7}, {3,7,2,6},
+  {5,7,3,5}, {6,7,3,6}, {7,7,6,4}, {8,7,7,4}, {0,8,0,7}, {1,8,1,8}, {2,8,1,7}, {3,8,2,8},
+  {5,8,2,7}, {6,8,3,7}, {7,8,3,7}, {8,8,7,4}, {0,9,0,8}, {1,9,0,9}, {2,9,1,9}, {3,9,2,9},
+  {5,9,2,8}, {6,9,3,8}, {7,9,3,9}, {8,9,8,4}, {0,10,0,10}, {1,10,0,9}, {2,10,1,10}, {3,10,2,10},
+  {5,10,2,10}, {6,10,3,9}, {7,10,3,10}, {8,10,7,14}, {0,11,0,11}, {1,11,0,11}, {2,11,1,11}, {3,11,2,11},
+  {5,11,3,11}, {6,11,3,11}, {7,11,6,14}, {8,11,8,14}, {0,12,0,12}, {1,12,1,12}, {2,12,2,12}, {3,12,2,12},
+  {5,12,3,13}, {6,12,3,12}, {7,12,5,14}, {8,12,7,14}, {0,13,0,13}, {1,13,1,13}, {2,13,2,13}, {3,13,3,13},
+  {5,13,4,14}, {6,13,4,14}, {7,13,6,15}, {8,13,7,15}, {0,14,0,13}, {1,14,1,14}, {2,14,2,14}, {3,14,3,14},
+  {5,14,4,15}, {6,14,5,15}, {7,14,6,15}, {8,14,8,15}, {0,15,0,14}, {1,15,1,15}, {2,15,2,14}, {3,15,3,15},
+  {5,15,5,16}, {6,15,6,16}, {7,15,7,16}, {8,15,8,16}, {0,16,0,15}, {1,16,1,15}, {2,16,2,15}, {3,16,3,15},
+  {5,16,5,16}, {6,16,6,17}, {7,16,7,16}, {8,16,8,17}, {0,17,0,16}, {1,17,1,16}, {2,17,3,16}, {3,17,4,16},
+  {5,17,5,17}, {6,17,6,17}, {7,17,7,17}, {8,17,8,18}, {0,18,0,16}, {1,18,2,16}, {2,18,3,17}, {3,18,4,17},
+  {5,18,5,18}, {6,18,6,18}, {7,18,7,18}, {8,18,8,18}, {0,19,0,17}, {1,19,2,16}, {2,19,4,17}, {3,19,5,18},
+  {5,19,6,19}, {6,19,6,19}, {7,19,7,19}, {8,19,8,19}, {0,20,1,17}, {1,20,2,17}, {2,20,5,20}, {3,20,5,19},
+  {5,20,6,20}, {6,20,7,20}, {7,20,8,20}, {8,20,8,20}, {0,21,1,17}, {1,21,5,21}, {2,21,5,20}, {3,21,6,21},
+  {5,21,6,21}, {6,21,7,21}, {7,21,8,22}, {8,21,8,21}, {0,22,5,22}, {1,22,5,23}, {2,22,5,22}, {3,22,6,22},
+  {5,22,6,23}, {6,22,7,22}, {7,22,8,23}, {8,22,8,22}, {0,23,0,27}, {1,23,5,24}, {2,23,5,24}, {3,23,6,23},
+  {5,23,6,24}, {6,23,7,23}, {7,23,8,24}, {8,23,8,24}, {0,24,1,27}, {1,24,2,27}, {2,24,5,25}, {3,24,5,26},
+  {5,24,6,25}, {6,24,7,24}, {7,24,7,25}, {8,24,8,25}, {0,25,1,27}, {1,25,3,27}, {2,25,4,27}, {3,25,5,26},
+  {5,25,6,25}, {6,25,7,26}, {7,25,7,26}, {8,25,8,26}, {0,26,0,28}, {1,26,2,28}, {2,26,3,28}, {3,26,4,27},
+  {5,26,6,26}, {6,26,6,27}, {7,26,7,27}, {8,26,8,27}, {0,27,0,28}, {1,27,1,28}, {2,27,3,28}, {3,27,4,28},
+  {4,27,5,28}, {5,27,5,27}, {6,27,6,27}, {7,27,7,28}, {8,27,8,28}, {0,28,0,29}, {1,28,2,29}, {2,28,2,29},
+  {3,28,3,29}, {4,28,5,28}, {5,28,5,29}, {6,28,6,28}, {7,28,7,29}, {8,28,8,28}, {0,29,0,30}, {1,29,1,29},
+  {2,29,3,30}, {3,29,4,29}, {4,29,4,29}, {5,29,5,30}, {6,29,6,29}, {7,29,7,29}, {8,29,8,29}, {0,30,1,30},
+  {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,30}, {5,30,6,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 0 <-> 6: 248 pairs, total squared travel 845
+  {0,1,0,1}, {1,1,0,1}, {2,1,1,1}, {3,1,2,1}, {4,1,3,1}, {5,1,4,1}, {6,1,6,1}, {7,1,6,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,1,2}, {2,2,2,2}, {3,2,3,2}, {4,2,4,2}, {5,2,4,2}, {6,2,5,1},
+  {7,2,6,2}, {8,2,7,1}, {0,3,0,3}, {1,3,1,3}, {2,3,2,3}, {3,3,2,3}, {4,3,3,3}, {5,3,4,3},
+  {6,3,5,2}, {7,3,7,2}, {8,3,8,2}, {0,4,0,4}, {1,4,0,4}, {2,4,1,4}, {3,4,2,4}, {4,4,3,4},
+  {5,4,4,4}, {6,4,5,3}, {7,4,6,3}, {8,4,8,3}, {0,5,0,5}, {1,5,0,6}, {2,5,1,5}, {3,5,2,5},
+  {5,5,3,5}, {6,5,5,4}, {7,5,6,4}, {8,5,7,3}, {0,6,0,6}, {1,6,0,7}, {2,6,1,6}, {3,6,2,6},
+  {5,6,2,7}, {6,6,3,6}, {7,6,6,4}, {8,6,7,4}, {0,7,0,8}, {1,7,1,8}, {2,7,1,7}, {3,7,2,8},
+  {5,7,3,8}, {6,7,3,7}, {7,7,3,7}, {8,7,8,4}, {0,8,0,9}, {1,8,0,10}, {2,8,1,9}, {3,8,2,9},
+  {5,8,2,9}, {6,8,3,9}, {7,8,3,10}, {8,8,8,14}, {0,9,0,11}, {1,9,0,11}, {2,9,1,10}, {3,9,2,10},
+  {5,9,2,11}, {6,9,3,11}, {7,9,3,12}, {8,9,7,14}, {0,10,0,12}, {1,10,1,12}, {2,10,1,11}, {3,10,2,12},
+  {5,10,3,13}, {6,10,3,12}, {7,10,5,14}, {8,10,6,14}, {0,11,0,13}, {1,11,0,14}, {2,11,1,13}, {3,11,2,13},
+  {5,11,3,14}, {6,11,4,14}, {7,11,6,15}, {8,11,7,15}, {0,12,0,15}, {1,12,1,14}, {2,12,2,14}, {3,12,2,14},
+  {5,12,4,15}, {6,12,5,15}, {7,12,6,15}, {8,12,8,15}, {0,13,0,15}, {1,13,1,15}, {2,13,2,15}, {3,13,3,15},
+  {5,13,4,16}, {6,13,5,16}, {7,13,7,16}, {8,13,8,16}, {0,14,0,16}, {1,14,1,16}, {2,14,2,16}, {3,14,3,16},
+  {5,14,4,16}, {6,14,6,16}, {7,14,7,17}, {8,14,8,17}, {0,15,0,17}, {1,15,1,17}, {2,15,2,17}, {3,15,3,17},
+  {5,15,4,17}, {6,15,5,17}, {7,15,6,17}, {8,15,8,18}, {0,16,0,18}, {1,16,1,18}, {2,16,2,17}, {3,16,3,18},
+  {5,16,5,18}, {6,16,6,18}, {7,16,7,18}, {8,16,7,18}, {0,17,0,18}, {1,17,1,19}, {2,17,2,18}, {3,17,3,19},
+  {5,17,5,19}, {6,17,6,19}, {7,17,7,19}, {8,17,8,19}, {0,18,0,19}, {1,18,1,20}, {2,18,2,19}, {3,18,3,20},
+  {5,18,5,20}, {6,18,6,19}, {7,18,7,20}, {8,18,8,20}, {0,19,0,20}, {1,19,1,21}, {2,19,2,20}, {3,19,3,21},
+  {5,19,5,20}, {6,19,6,20}, {7,19,7,21}, {8,19,8,21}, {0,20,0,21}, {1,20,1,22}, {2,20,2,21}, {3,20,3,21},
+  {5,20,5,21}, {6,20,6,21}, {7,20,7,22}, {8,20,8,22}, {0,21,0,22}, {1,21,1,22}, {2,21,2,22}, {3,21,3,22},
+  {5,21,5,22}, {6,21,6,22}, {7,21,7,23}, {8,21,8,23}, {0,22,0,23}, {1,22,1,23}, {2,22,2,23}, {3,22,3,23},
+  {5,22,5,23}, {6,22,6,23}, {7,22,7,24}, {8,22,8,23}, {0,23,0,23}, {1,23,1,24}, {2,23,2,24}, {3,23,3,24},
+  {5,23,5,24}, {6,23,6,24}, {7,23,7,24}, {8,23,8,24}, {0,24,0,24}, {1,24,1,25}, {2,24,2,25}, {3,24,3,25},
+  {5,24,5,25}, {6,24,5,25}, {7,24,6,25}, {8,24,8,25}, {0,25,0,25}, {1,25,1,26}, {2,25,2,26}, {3,25,3,26},
+  {5,25,5,26}, {6,25,6,26}, {7,25,7,26}, {8,25,7,25}, {0,26,0,26}, {1,26,1,27}, {2,26,2,27}, {3,26,3,26},
+  {5,26,4,27}, {6,26,6,27}, {7,26,7,27}, {8,26,8,26}, {0,27,0,27}, {1,27,1,28}, {2,27,2,27}, {3,27,3,27},
+  {4,27,3,28}, {5,27,5,27}, {6,27,5,28}, {7,27,7,28}, {8,27,8,27}, {0,28,0,28}, {1,28,0,28}, {2,28,2,28},
+  {3,28,3,29}, {4,28,4,28}, {5,28,4,29}, {6,28,6,28}, {7,28,6,28}, {8,28,8,28}, {0,29,0,29}, {1,29,1,29},
+  {2,29,2,29}, {3,29,2,30}, {4,29,4,29}, {5,29,5,29}, {6,29,6,29}, {7,29,7,29}, {8,29,8,29}, {0,30,0,30},
+  {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,30}, {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 0 <-> 7: 248 pairs, total squared travel 2737
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,4,1}, {5,1,5,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,1}, {1,2,1,1}, {2,2,2,1}, {3,2,3,1}, {4,2,5,1}, {5,2,6,1}, {6,2,6,2},
+  {7,2,7,1}, {8,2,8,2}, {0,3,0,2}, {1,3,1,2}, {2,3,2,2}, {3,3,3,2}, {4,3,4,2}, {5,3,5,2},
+  {6,3,6,2}, {7,3,7,2}, {8,3,7,2}, {0,4,0,2}, {1,4,1,2}, {2,4,2,2}, {3,4,3,2}, {4,4,5,3},
+  {5,4,5,2}, {6,4,6,3}, {7,4,7,3}, {8,4,8,3}, {0,5,0,3}, {1,5,2,3}, {2,5,3,3}, {3,5,4,3},
+  {5,5,5,3}, {6,5,6,3}, {7,5,7,3}, {8,5,8,4}, {0,6,0,3}, {1,6,1,3}, {2,6,4,3}, {3,6,5,4},
+  {5,6,6,4}, {6,6,6,4}, {7,6,7,4}, {8,6,8,4}, {0,7,1,3}, {1,7,2,3}, {2,7,4,4}, {3,7,5,4},
+  {5,7,6,5}, {6,7,6,5}, {7,7,7,5}, {8,7,8,5}, {0,8,0,4}, {1,8,2,4}, {2,8,3,4}, {3,8,5,5},
+  {5,8,6,6}, {6,8,7,6}, {7,8,7,5}, {8,8,8,6}, {0,9,1,4}, {1,9,2,4}, {2,9,4,4}, {3,9,5,5},
+  {5,9,6,6}, {6,9,7,7}, {7,9,7,6}, {8,9,8,7}, {0,10,0,4}, {1,10,5,6}, {2,10,5,6}, {3,10,6,7},
+  {5,10,6,7}, {6,10,7,7}, {7,10,8,8}, {8,10,8,7}, {0,11,1,4}, {1,11,5,7}, {2,11,5,7}, {3,11,6,8},
+  {5,11,6,8}, {6,11,7,8}, {7,11,7,8}, {8,11,8,8}, {0,12,5,9}, {1,12,5,8}, {2,12,6,9}, {3,12,6,9},
+  {5,12,7,9}, {6,12,7,9}, {7,12,8,9}, {8,12,8,9}, {0,13,5,10}, {1,13,5,11}, {2,13,6,10}, {3,13,6,10},
+  {5,13,7,10}, {6,13,7,10}, {7,13,8,10}, {8,13,8,10}, {0,14,5,12}, {1,14,5,12}, {2,14,5,11}, {3,14,6,11},
+  {5,14,7,11}, {6,14,7,11}, {7,14,8,11}, {8,14,8,11}, {0,15,5,13}, {1,15,5,13}, {2,15,6,13}, {3,15,6,12},
+  {5,15,7,12}, {6,15,7,12}, {7,15,8,12}, {8,15,8,12}, {0,16,5,14}, {1,16,5,14}, {2,16,6,14}, {3,16,6,14},
+  {5,16,7,13}, {6,16,7,13}, {7,16,8,13}, {8,16,8,13}, {0,17,5,15}, {1,17,5,15}, {2,17,6,15}, {3,17,6,15},
+  {5,17,7,15}, {6,17,7,14}, {7,17,8,14}, {8,17,8,14}, {0,18,5,16}, {1,18,5,16}, {2,18,6,16}, {3,18,6,16},
+  {5,18,7,16}, {6,18,7,16}, {7,18,8,15}, {8,18,8,15}, {0,19,5,17}, {1,19,5,17}, {2,19,6,17}, {3,19,6,17},
+  {5,19,7,17}, {6,19,7,17}, {7,19,8,17}, {8,19,8,16}, {0,20,5,18}, {1,20,5,18}, {2,20,6,18}, {3,20,6,18},
+  {5,20,7,18}, {6,20,7,18}, {7,20,8,19}, {8,20,8,18}, {0,21,5,19}, {1,21,5,19}, {2,21,6,19}, {3,21,6,19},
+  {5,21,7,19}, {6,21,7,19}, {7,21,8,20}, {8,21,8,19}, {0,22,5,20}, {1,22,6,20}, {2,22,6,20}, {3,22,7,20},
+  {5,22,7,20}, {6,22,8,20}, {7,22,8,21}, {8,22,8,21}, {0,23,5,21}, {1,23,5,22}, {2,23,6,21}, {3,23,6,21},
+  {5,23,7,21}, {6,23,7,21}, {7,23,8,22}, {8,23,8,22}, {0,24,5,23}, {1,24,5,23}, {2,24,6,22}, {3,24,6,22},
+  {5,24,7,22}, {6,24,7,22}, {7,24,8,23}, {8,24,8,23}, {0,25,5,24}, {1,25,5,24}, {2,25,6,24}, {3,25,6,23},
+  {5,25,7,23}, {6,25,7,23}, {7,25,8,24}, {8,25,8,24}, {0,26,5,25}, {1,26,5,25}, {2,26,6,25}, {3,26,6,25},
+  {5,26,7,24}, {6,26,7,24}, {7,26,8,25}, {8,26,8,25}, {0,27,5,26}, {1,27,5,26}, {2,27,6,27}, {3,27,6,26},
+  {4,27,6,26}, {5,27,7,25}, {6,27,7,26}, {7,27,8,26}, {8,27,8,26}, {0,28,5,27}, {1,28,5,28}, {2,28,5,27},
+  {3,28,6,27}, {4,28,6,28}, {5,28,7,27}, {6,28,7,28}, {7,28,8,27}, {8,28,8,27}, {0,29,5,29}, {1,29,5,29},
+  {2,29,5,28}, {3,29,6,28}, {4,29,6,29}, {5,29,7,29}, {6,29,7,29}, {7,29,7,28}, {8,29,8,28}, {0,30,5,30},
+  {1,30,5,30}, {2,30,6,30}, {3,30,6,30}, {4,30,6,29}, {5,30,7,30}, {6,30,7,30}, {7,30,8,30}, {8,30,8,29},
+  // 0 <-> 8: 252 pairs, total squared travel 39
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,4,1}, {5,1,5,1}, {6,1,6,1},
+  {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,2}, {2,2,2,2}, {3,2,3,2}, {4,2,4,2}, {5,2,5,2},
+  {6,2,6,2}, {7,2,7,2}, {8,2,8,2}, {0,3,0,4}, {1,3,1,3}, {2,3,2,3}, {3,3,3,3}, {4,3,4,3},
+  {5,3,5,3}, {6,3,6,3}, {7,3,7,3}, {8,3,8,3}, {0,4,0,5}, {1,4,1,4}, {2,4,2,4}, {3,4,3,4},
+  {4,4,4,4}, {5,4,5,4}, {6,4,6,4}, {7,4,7,4}, {8,4,8,4}, {0,5,0,6}, {1,5,1,5}, {2,5,2,5},
+  {3,5,3,5}, {5,5,5,5}, {6,5,6,5}, {7,5,7,5}, {8,5,8,5}, {0,6,0,7}, {1,6,1,6}, {2,6,2,6},
+  {3,6,3,6}, {5,6,5,6}, {6,6,6,6}, {7,6,7,6}, {8,6,8,6}, {0,7,1,7}, {1,7,2,8}, {2,7,2,7},
+  {3,7,3,7}, {5,7,5,7}, {6,7,6,7}, {7,7,7,7}, {8,7,8,7}, {0,8,0,8}, {1,8,1,8}, {2,8,2,9},
+  {2,8,3,9}, {3,8,3,8}, {5,8,5,8}, {6,8,6,8}, {7,8,7,8}, {8,8,8,8}, {0,9,0,9}, {1,9,1,9},
+  {2,9,2,10}, {3,9,3,10}, {5,9,5,9}, {6,9,6,9}, {7,9,7,9}, {8,9,8,9}, {0,10,0,10}, {1,10,1,10},
+  {2,10,2,11}, {3,10,3,11}, {5,10,5,10}, {6,10,6,10}, {7,10,7,10}, {8,10,8,10}, {0,11,0,11}, {1,11,1,11},
+  {2,11,2,12}, {3,11,3,12}, {5,11,5,11}, {6,11,6,11}, {7,11,7,11}, {8,11,8,11}, {0,12,0,12}, {1,12,1,12},
+  {2,12,2,13}, {3,12,3,13}, {5,12,5,12}, {6,12,6,12}, {7,12,7,12}, {8,12,8,12}, {0,13,0,13}, {1,13,1,13},
+  {2,13,3,14}, {3,13,4,14}, {5,13,5,13}, {6,13,6,13}, {7,13,7,13}, {8,13,8,13}, {0,14,0,14}, {1,14,1,14},
+  {2,14,2,14}, {3,14,4,15}, {5,14,5,14}, {6,14,6,14}, {7,14,7,14}, {8,14,8,14}, {0,15,0,15}, {1,15,1,15},
+  {2,15,2,15}, {3,15,3,15}, {5,15,5,15}, {6,15,6,15}, {7,15,7,15}, {8,15,8,15}, {0,16,0,16}, {0,16,1,16},
+  {1,16,2,16}, {2,16,3,16}, {3,16,4,16}, {5,16,5,16}, {6,16,6,16}, {7,16,7,16}, {8,16,8,16}, {0,17,0,17},
+  {1,17,1,17}, {2,17,2,17}, {3,17,3,17}, {5,17,5,17}, {6,17,6,17}, {7,17,7,17}, {8,17,8,17}, {0,18,0,18},
+  {1,18,1,18}, {2,18,2,18}, {3,18,3,18}, {5,18,4,17}, {6,18,6,18}, {7,18,7,18}, {8,18,8,18}, {0,19,0,19},
+  {1,19,1,19}, {2,19,2,19}, {3,19,3,19}, {5,19,5,18}, {6,19,6,19}, {7,19,7,19}, {8,19,8,19}, {0,20,0,20},
+  {1,20,1,20}, {2,20,2,20}, {3,20,3,20}, {5,20,5,19}, {6,20,6,20}, {7,20,7,20}, {8,20,8,20}, {0,21,0,21},
+  {1,21,1,21}, {2,21,2,21}, {3,21,3,21}, {5,21,5,20}, {6,21,6,21}, {7,21,7,21}, {8,21,8,21}, {0,22,0,22},
+  {1,22,1,22}, {2,22,2,22}, {3,22,3,22}, {5,22,5,22}, {6,22,5,21}, {7,22,7,22}, {8,22,8,22}, {0,23,0,23},
+  {1,23,1,23}, {2,23,2,23}, {3,23,3,23}, {5,23,5,23}, {6,23,6,23}, {7,23,6,22}, {7,23,7,23}, {8,23,8,23},
+  {0,24,0,24}, {1,24,1,24}, {2,24,2,24}, {3,24,3,24}, {5,24,5,24}, {6,24,6,24}, {7,24,7,24}, {8,24,8,24},
+  {0,25,0,25}, {1,25,1,25}, {2,25,2,25}, {3,25,3,25}, {5,25,5,25}, {6,25,6,25}, {7,25,7,25}, {8,25,8,25},
+  {0,26,0,26}, {1,26,1,26}, {2,26,2,26}, {3,26,3,26}, {5,26,5,26}, {6,26,6,26}, {7,26,7,26}, {8,26,8,26},
+  {0,27,0,27}, {1,27,1,27}, {2,27,2,27}, {3,27,3,27}, {4,27,4,27}, {5,27,5,27}, {6,27,6,27}, {7,27,7,27},
+  {8,27,8,27}, {0,28,0,28}, {1,28,1,28}, {2,28,2,28}, {3,28,3,28}, {4,28,4,28}, {5,28,5,28}, {6,28,6,28},
+  {7,28,7,28}, {8,28,8,28}, {0,29,0,29}, {1,29,1,29}, {2,29,2,29}, {3,29,3,29}, {4,29,4,29}, {5,29,5,29},
+  {6,29,6,29}, {7,29,7,29}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,30},
+  {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 0 <-> 9: 248 pairs, total squared travel 865
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,4,1}, {5,1,5,1}, {6,1,6,1}, {7,1,6,1},
+  {8,1,8,1}, {0,2,0,1}, {1,2,1,2}, {2,2,2,2}, {3,2,3,2}, {4,2,4,2}, {5,2,4,2}, {6,2,5,2},
+  {7,2,6,2}, {8,2,7,1}, {0,3,0,2}, {1,3,1,3}, {2,3,2,3}, {3,3,3,3}, {4,3,4,3}, {5,3,5,3},
+  {6,3,6,3}, {7,3,7,2}, {8,3,8,2}, {0,4,0,4}, {1,4,0,3}, {2,4,2,3}, {3,4,3,4}, {4,4,4,4},
+  {5,4,5,4}, {6,4,6,4}, {7,4,7,3}, {8,4,8,3}, {0,5,0,4}, {1,5,1,4}, {2,5,2,4}, {3,5,3,5},
+  {5,5,5,5}, {6,5,6,4}, {7,5,7,4}, {8,5,8,4}, {0,6,0,5}, {1,6,1,5}, {2,6,2,5}, {3,6,3,6},
+  {5,6,5,5}, {6,6,6,5}, {7,6,7,5}, {8,6,8,5}, {0,7,0,6}, {1,7,1,6}, {2,7,2,6}, {3,7,3,6},
+  {5,7,5,6}, {6,7,6,6}, {7,7,7,6}, {8,7,8,6}, {0,8,0,7}, {1,8,1,7}, {2,8,2,7}, {3,8,3,7},
+  {5,8,5,7}, {6,8,6,7}, {7,8,7,7}, {8,8,8,7}, {0,9,0,8}, {1,9,2,7}, {2,9,2,8}, {3,9,3,8},
+  {5,9,5,8}, {6,9,6,8}, {7,9,7,8}, {8,9,8,8}, {0,10,0,8}, {1,10,1,8}, {2,10,2,9}, {3,10,3,9},
+  {5,10,5,9}, {6,10,6,9}, {7,10,7,9}, {8,10,8,8}, {0,11,0,9}, {1,11,1,9}, {2,11,2,10}, {3,11,3,10},
+  {5,11,5,10}, {6,11,6,10}, {7,11,7,9}, {8,11,8,9}, {0,12,0,10}, {1,12,1,10}, {2,12,2,11}, {3,12,3,11},
+  {5,12,5,11}, {6,12,6,10}, {7,12,7,10}, {8,12,8,10}, {0,13,0,11}, {1,13,1,11}, {2,13,2,12}, {3,13,3,11},
+  {5,13,5,12}, {6,13,6,11}, {7,13,7,11}, {8,13,8,11}, {0,14,0,12}, {1,14,1,12}, {2,14,2,12}, {3,14,3,12},
+  {5,14,5,13}, {6,14,6,12}, {7,14,7,12}, {8,14,8,12}, {0,15,0,13}, {1,15,1,13}, {2,15,2,13}, {3,15,3,13},
+  {5,15,6,14}, {6,15,6,13}, {7,15,7,13}, {8,15,8,13}, {0,16,0,14}, {1,16,1,13}, {2,16,3,14}, {3,16,4,14},
+  {5,16,5,14}, {6,16,6,14}, {7,16,7,14}, {8,16,8,14}, {0,17,0,14}, {1,17,1,14}, {2,17,2,14}, {3,17,4,15},
+  {5,17,5,15}, {6,17,6,15}, {7,17,7,15}, {8,17,8,15}, {0,18,0,15}, {1,18,1,15}, {2,18,3,15}, {3,18,4,15},
+  {5,18,5,16}, {6,18,6,16}, {7,18,7,16}, {8,18,8,16}, {0,19,0,16}, {1,19,2,15}, {2,19,3,16}, {3,19,4,16},
+  {5,19,5,17}, {6,19,6,17}, {7,19,7,17}, {8,19,8,17}, {0,20,1,16}, {1,20,2,16}, {2,20,2,16}, {3,20,4,17},
+  {5,20,6,18}, {6,20,6,17}, {7,20,7,18}, {8,20,8,18}, {0,21,0,17}, {1,21,3,17}, {2,21,5,18}, {3,21,5,19},
+  {5,21,6,19}, {6,21,7,19}, {7,21,8,19}, {8,21,8,20}, {0,22,1,17}, {1,22,2,17}, {2,22,5,20}, {3,22,5,19},
+  {5,22,6,20}, {6,22,7,20}, {7,22,8,20}, {8,22,8,21}, {0,23,0,17}, {1,23,5,21}, {2,23,5,22}, {3,23,6,21},
+  {5,23,6,22}, {6,23,7,22}, {7,23,7,21}, {8,23,8,22}, {0,24,0,27}, {1,24,5,23}, {2,24,5,24}, {3,24,6,24},
+  {5,24,6,23}, {6,24,7,23}, {7,24,7,22}, {8,24,8,23}, {0,25,1,27}, {1,25,2,27}, {2,25,5,24}, {3,25,5,25},
+  {5,25,6,25}, {6,25,7,24}, {7,25,8,24}, {8,25,8,25}, {0,26,0,28}, {1,26,2,27}, {2,26,3,27}, {3,26,5,26},
+  {5,26,6,26}, {6,26,7,25}, {7,26,8,26}, {8,26,8,25}, {0,27,0,28}, {1,27,2,28}, {2,27,3,28}, {3,27,4,27},
+  {4,27,5,27}, {5,27,6,27}, {6,27,7,26}, {7,27,7,27}, {8,27,8,27}, {0,28,1,29}, {1,28,1,28}, {2,28,3,29},
+  {3,28,4,28}, {4,28,5,28}, {5,28,6,28}, {6,28,6,28}, {7,28,7,28}, {8,28,8,28}, {0,29,0,29}, {1,29,2,30},
+  {2,29,2,29}, {3,29,4,29}, {4,29,4,29}, {5,29,5,29}, {6,29,6,29}, {7,29,7,29}, {8,29,8,29}, {0,30,0,30},
+  {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,30}, {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 1 <-> 2: 180 pairs, total squared travel 1850
+  {5,1,1,1}, {5,1,2,1}, {6,1,3,1}, {7,1,6,1}, {7,1,7,1}, {8,1,8,1}, {5,2,0,1}, {5,2,2,2},
+  {6,2,4,1}, {7,2,5,1}, {7,2,7,2}, {8,2,8,2}, {5,3,0,2}, {5,3,3,2}, {6,3,4,2}, {7,3,5,2},
+  {7,3,6,2}, {8,3,8,3}, {5,4,1,2}, {5,4,2,3}, {6,4,4,3}, {7,4,5,3}, {7,4,6,3}, {8,4,7,3},
+  {5,5,0,3}, {5,5,1,3}, {6,5,3,3}, {7,5,6,4}, {7,5,7,4}, {8,5,8,4}, {5,6,0,4}, {5,6,1,4},
+  {6,6,4,4}, {7,6,5,4}, {7,6,7,5}, {8,6,8,5}, {5,7,2,4}, {5,7,3,4}, {6,7,5,5}, {7,7,6,5},
+  {7,7,7,6}, {8,7,8,6}, {5,8,5,6}, {5,8,5,7}, {6,8,6,7}, {7,8,6,6}, {7,8,7,7}, {8,8,8,7},
+  {5,9,5,8}, {5,9,5,9}, {6,9,6,8}, {7,9,7,8}, {7,9,8,8}, {8,9,8,9}, {5,10,6,9}, {5,10,5,10},
+  {6,10,6,10}, {7,10,7,9}, {7,10,7,10}, {8,10,8,10}, {5,11,5,11}, {5,11,5,12}, {6,11,6,11}, {7,11,7,11},
+  {7,11,7,12}, {8,11,8,11}, {5,12,1,14}, {5,12,2,14}, {6,12,5,13}, {7,12,6,12}, {7,12,7,13}, {8,12,8,12},
+  {5,13,0,14}, {5,13,3,14}, {6,13,4,14}, {7,13,6,13}, {7,13,7,14}, {8,13,8,13}, {5,14,1,15}, {5,14,2,15},
+  {6,14,4,15}, {7,14,5,14}, {7,14,6,14}, {8,14,8,14}, {5,15,0,15}, {5,15,2,16}, {6,15,3,15}, {7,15,5,15},
+  {7,15,7,15}, {8,15,8,15}, {5,16,0,16}, {5,16,1,16}, {6,16,3,16}, {7,16,6,15}, {7,16,6,16}, {8,16,8,16},
+  {5,17,0,17}, {5,17,1,17}, {6,17,3,17}, {7,17,4,16}, {7,17,5,16}, {8,17,7,16}, {5,18,0,18}, {5,18,1,18},
+  {6,18,2,17}, {7,18,4,17}, {7,18,5,17}, {8,18,7,17}, {5,19,0,19}, {5,19,1,19}, {6,19,2,18}, {7,19,3,18},
+  {7,19,3,19}, {8,19,8,17}, {5,20,0,20}, {5,20,1,20}, {6,20,2,19}, {7,20,2,20}, {7,20,3,20}, {8,20,6,17},
+  {5,21,0,21}, {5,21,0,22}, {6,21,1,21}, {7,21,2,21}, {7,21,3,22}, {8,21,3,21}, {5,22,0,23}, {5,22,1,23},
+  {6,22,1,22}, {7,22,2,22}, {7,22,2,23}, {8,22,3,23}, {5,23,0,24}, {5,23,1,24}, {6,23,2,24}, {7,23,3,24},
+  {7,23,3,25}, {8,23,8,27}, {5,24,0,25}, {5,24,1,25}, {6,24,2,25}, {7,24,2,26}, {7,24,3,26}, {8,24,7,27},
+  {5,25,0,26}, {5,25,1,26}, {6,25,2,27}, {7,25,4,27}, {7,25,5,27}, {8,25,6,27}, {5,26,0,27}, {5,26,1,27},
+  {6,26,2,28}, {7,26,3,27}, {7,26,6,28}, {8,26,7,28}, {5,27,0,28}, {5,27,1,28}, {6,27,3,28}, {7,27,4,28},
+  {7,27,5,28}, {8,27,8,28}, {5,28,0,29}, {5,28,2,29}, {6,28,3,29}, {7,28,5,29}, {7,28,6,29}, {8,28,7,29},
+  {5,29,1,29}, {5,29,0,30}, {6,29,3,30}, {7,29,4,29}, {7,29,6,30}, {8,29,8,29}, {5,30,1,30}, {5,30,2,30},
+  {6,30,4,30}, {7,30,5,30}, {7,30,7,30}, {8,30,8,30},
+  // 1 <-> 3: 180 pairs, total squared travel 1018
+  {5,1,1,1}, {5,1,2,1}, {6,1,3,1}, {7,1,6,1}, {7,1,7,1}, {8,1,8,1}, {5,2,0,1}, {5,2,2,2},
+  {6,2,4,1}, {7,2,5,1}, {7,2,7,2}, {8,2,8,2}, {5,3,1,2}, {5,3,3,2}, {6,3,4,2}, {7,3,5,2},
+  {7,3,6,2}, {8,3,8,3}, {5,4,0,2}, {5,4,2,3}, {6,4,4,3}, {7,4,5,3}, {7,4,6,3}, {8,4,7,3},
+  {5,5,0,3}, {5,5,1,3}, {6,5,3,3}, {7,5,6,4}, {7,5,7,4}, {8,5,8,4}, {5,6,1,4}, {5,6,3,4},
+  {6,6,4,4}, {7,6,5,4}, {7,6,7,5}, {8,6,8,5}, {5,7,0,4}, {5,7,2,4}, {6,7,5,5}, {7,7,6,5},
+  {7,7,7,6}, {8,7,8,6}, {5,8,5,6}, {5,8,5,7}, {6,8,6,7}, {7,8,6,6}, {7,8,7,7}, {8,8,8,7},
+  {5,9,5,8}, {5,9,5,9}, {6,9,6,8}, {7,9,7,8}, {7,9,8,8}, {8,9,8,9}, {5,10,6,9}, {5,10,5,10},
+  {6,10,6,10}, {7,10,7,9}, {7,10,7,10}, {8,10,8,10}, {5,11,5,11}, {5,11,5,12}, {6,11,6,11}, {7,11,7,11},
+  {7,11,7,12}, {8,11,8,11}, {5,12,0,14}, {5,12,2,14}, {6,12,5,13}, {7,12,6,12}, {7,12,7,13}, {8,12,8,12},
+  {5,13,1,14}, {5,13,3,14}, {6,13,4,14}, {7,13,6,13}, {7,13,7,14}, {8,13,8,13}, {5,14,0,15}, {5,14,1,15},
+  {6,14,5,14}, {7,14,6,14}, {7,14,7,15}, {8,14,8,14}, {5,15,2,15}, {5,15,3,15}, {6,15,4,15}, {7,15,5,15},
+  {7,15,6,15}, {8,15,8,15}, {5,16,1,16}, {5,16,2,16}, {6,16,4,16}, {7,16,6,16}, {7,16,7,16}, {8,16,8,16},
+  {5,17,0,16}, {5,17,3,16}, {6,17,5,16}, {7,17,6,17}, {7,17,7,17}, {8,17,8,17}, {5,18,0,17}, {5,18,1,17},
+  {6,18,4,17}, {7,18,5,17}, {7,18,7,18}, {8,18,8,18}, {5,19,2,17}, {5,19,3,17}, {6,19,5,18}, {7,19,6,18},
+  {7,19,7,19}, {8,19,8,19}, {5,20,5,19}, {5,20,5,20}, {6,20,6,20}, {7,20,6,19}, {7,20,7,20}, {8,20,8,20},
+  {5,21,5,21}, {5,21,6,21}, {6,21,6,22}, {7,21,7,21}, {7,21,7,22}, {8,21,8,21}, {5,22,5,22}, {5,22,5,23},
+  {6,22,6,23}, {7,22,7,23}, {7,22,8,23}, {8,22,8,22}, {5,23,5,24}, {5,23,5,25}, {6,23,6,24}, {7,23,7,24},
+  {7,23,7,25}, {8,23,8,24}, {5,24,1,27}, {5,24,3,27}, {6,24,5,26}, {7,24,6,25}, {7,24,7,26}, {8,24,8,25},
+  {5,25,0,27}, {5,25,2,27}, {6,25,4,27}, {7,25,6,26}, {7,25,7,27}, {8,25,8,26}, {5,26,0,28}, {5,26,2,28},
+  {6,26,3,28}, {7,26,5,27}, {7,26,6,27}, {8,26,8,27}, {5,27,1,28}, {5,27,2,29}, {6,27,4,28}, {7,27,5,28},
+  {7,27,6,28}, {8,27,8,28}, {5,28,0,29}, {5,28,1,29}, {6,28,4,29}, {7,28,6,29}, {7,28,7,29}, {8,28,7,28},
+  {5,29,0,30}, {5,29,3,30}, {6,29,3,29}, {7,29,5,29}, {7,29,7,30}, {8,29,8,29}, {5,30,1,30}, {5,30,2,30},
+  {6,30,4,30}, {7,30,5,30}, {7,30,6,30}, {8,30,8,30},
+  // 1 <-> 4: 192 pairs, total squared travel 2588
+  {5,1,0,1}, {5,1,1,1}, {6,1,2,1}, {6,1,3,1}, {7,1,6,1}, {8,1,7,1}, {8,1,8,1}, {5,2,1,2},
+  {6,2,2,2}, {6,2,3,2}, {7,2,5,1}, {7,2,6,2}, {8,2,8,2}, {5,3,0,2}, {5,3,1,3}, {6,3,3,3},
+  {7,3,5,2}, {7,3,6,3}, {8,3,7,2}, {8,3,8,3}, {5,4,0,3}, {6,4,2,3}, {6,4,3,4}, {7,4,5,3},
+  {8,4,7,3}, {8,4,8,4}, {5,5,0,4}, {5,5,1,4}, {6,5,2,4}, {7,5,5,4}, {7,5,6,4}, {8,5,7,4},
+  {5,6,0,5}, {5,6,1,5}, {6,6,2,5}, {6,6,3,5}, {7,6,5,5}, {8,6,7,5}, {8,6,8,5}, {5,7,0,6},
+  {6,7,2,6}, {6,7,3,6}, {7,7,6,5}, {7,7,6,6}, {8,7,7,6}, {5,8,1,6}, {5,8,1,7}, {6,8,3,7},
+  {7,8,5,6}, {7,8,6,7}, {8,8,8,6}, {8,8,8,7}, {5,9,0,7}, {6,9,2,7}, {6,9,3,8}, {7,9,5,7},
+  {8,9,7,7}, {8,9,8,8}, {5,10,0,8}, {5,10,1,8}, {6,10,2,8}, {7,10,5,8}, {7,10,6,8}, {8,10,7,8},
+  {5,11,0,9}, {5,11,1,9}, {6,11,2,9}, {6,11,3,9}, {7,11,5,9}, {8,11,7,9}, {8,11,8,9}, {5,12,0,10},
+  {6,12,2,10}, {6,12,3,10}, {7,12,6,9}, {7,12,6,10}, {8,12,7,10}, {5,13,1,10}, {5,13,1,11}, {6,13,2,11},
+  {7,13,5,10}, {7,13,6,11}, {8,13,8,10}, {8,13,8,11}, {5,14,0,11}, {6,14,3,11}, {6,14,3,12}, {7,14,5,11},
+  {8,14,7,11}, {8,14,8,12}, {5,15,0,12}, {5,15,1,12}, {6,15,2,12}, {7,15,5,12}, {7,15,6,12}, {8,15,7,12},
+  {5,16,0,13}, {5,16,1,13}, {6,16,2,13}, {6,16,3,13}, {7,16,5,13}, {8,16,7,13}, {8,16,8,13}, {5,17,0,14},
+  {6,17,3,14}, {6,17,4,14}, {7,17,6,13}, {7,17,6,14}, {8,17,8,14}, {5,18,1,14}, {5,18,2,14}, {6,18,3,15},
+  {7,18,5,14}, {7,18,6,15}, {8,18,7,14}, {8,18,8,15}, {5,19,1,15}, {6,19,2,15}, {6,19,4,15}, {7,19,5,15},
+  {8,19,7,15}, {8,19,8,16}, {5,20,0,15}, {5,20,2,16}, {6,20,3,16}, {7,20,5,16}, {7,20,6,16}, {8,20,7,16},
+  {5,21,0,16}, {5,21,1,16}, {6,21,4,16}, {6,21,4,17}, {7,21,6,17}, {8,21,7,17}, {8,21,8,17}, {5,22,0,17},
+  {6,22,3,17}, {6,22,5,18}, {7,22,5,17}, {7,22,7,18}, {8,22,8,18}, {5,23,1,17}, {5,23,2,17}, {6,23,5,19},
+  {7,23,6,18}, {7,23,6,19}, {8,23,7,19}, {8,23,8,19}, {5,24,5,20}, {6,24,6,20}, {6,24,6,21}, {7,24,7,20},
+  {8,24,8,20}, {8,24,8,21}, {5,25,5,21}, {5,25,5,22}, {6,25,6,22}, {7,25,7,21}, {7,25,7,22}, {8,25,8,22},
+  {5,26,5,23}, {5,26,5,24}, {6,26,6,23}, {6,26,6,24}, {7,26,7,23}, {8,26,8,23}, {8,26,8,24}, {5,27,5,25},
+  {6,27,6,25}, {6,27,6,26}, {7,27,7,24}, {7,27,7,25}, {8,27,8,25}, {5,28,5,26}, {5,28,5,27}, {6,28,6,27},
+  {7,28,7,26}, {7,28,7,27}, {8,28,8,26}, {8,28,8,27}, {5,29,5,28}, {6,29,6,28}, {6,29,6,29}, {7,29,7,28},
+  {8,29,8,28}, {8,29,8,29}, {5,30,5,29}, {5,30,5,30}, {6,30,6,30}, {7,30,7,29}, {7,30,7,30}, {8,30,8,30},
+  // 1 <-> 5: 180 pairs, total squared travel 1850
+  {5,1,0,1}, {5,1,1,1}, {6,1,2,1}, {7,1,6,1}, {7,1,7,1}, {8,1,8,1}, {5,2,1,2}, {5,2,2,2},
+  {6,2,3,1}, {7,2,4,1}, {7,2,5,1}, {8,2,8,2}, {5,3,0,2}, {5,3,2,3}, {6,3,3,2}, {7,3,4,2},
+  {7,3,5,2}, {8,3,7,2}, {5,4,0,3}, {5,4,1,3}, {6,4,3,3}, {7,4,6,2}, {7,4,6,3}, {8,4,8,3},
+  {5,5,0,4}, {5,5,1,4}, {6,5,2,4}, {7,5,4,3}, {7,5,5,3}, {8,5,7,3}, {5,6,0,5}, {5,6,1,5},
+  {6,6,3,4}, {7,6,4,4}, {7,6,5,4}, {8,6,7,4}, {5,7,0,6}, {5,7,1,6}, {6,7,2,5}, {7,7,3,5},
+  {7,7,3,6}, {8,7,8,4}, {5,8,0,7}, {5,8,1,7}, {6,8,2,7}, {7,8,2,6}, {7,8,3,7}, {8,8,6,4},
+  {5,9,0,8}, {5,9,1,8}, {6,9,1,9}, {7,9,2,8}, {7,9,3,8}, {8,9,3,9}, {5,10,0,9}, {5,10,0,10},
+  {6,10,1,10}, {7,10,2,9}, {7,10,2,10}, {8,10,3,10}, {5,11,0,11}, {5,11,1,11}, {6,11,2,11}, {7,11,3,11},
+  {7,11,3,12}, {8,11,7,14}, {5,12,0,12}, {5,12,1,12}, {6,12,2,12}, {7,12,3,13}, {7,12,5,14}, {8,12,8,14},
+  {5,13,0,13}, {5,13,1,13}, {6,13,2,13}, {7,13,4,14}, {7,13,6,14}, {8,13,8,15}, {5,14,0,14}, {5,14,1,14},
+  {6,14,2,14}, {7,14,3,14}, {7,14,5,15}, {8,14,7,15}, {5,15,1,15}, {5,15,2,15}, {6,15,3,15}, {7,15,4,15},
+  {7,15,6,15}, {8,15,8,16}, {5,16,0,15}, {5,16,2,16}, {6,16,4,16}, {7,16,5,16}, {7,16,6,16}, {8,16,7,16},
+  {5,17,0,16}, {5,17,1,16}, {6,17,3,16}, {7,17,5,17}, {7,17,6,17}, {8,17,8,17}, {5,18,1,17}, {5,18,2,17},
+  {6,18,4,17}, {7,18,7,17}, {7,18,7,18}, {8,18,8,18}, {5,19,0,17}, {5,19,3,17}, {6,19,5,18}, {7,19,6,18},
+  {7,19,7,19}, {8,19,8,19}, {5,20,5,19}, {5,20,5,20}, {6,20,6,20}, {7,20,6,19}, {7,20,7,20}, {8,20,8,20},
+  {5,21,5,21}, {5,21,5,22}, {6,21,6,21}, {7,21,7,21}, {7,21,7,22}, {8,21,8,21}, {5,22,6,22}, {5,22,5,23},
+  {6,22,6,23}, {7,22,7,23}, {7,22,8,23}, {8,22,8,22}, {5,23,5,24}, {5,23,5,25}, {6,23,6,24}, {7,23,7,24},
+  {7,23,7,25}, {8,23,8,24}, {5,24,2,27}, {5,24,3,27}, {6,24,5,26}, {7,24,6,25}, {7,24,7,26}, {8,24,8,25},
+  {5,25,0,27}, {5,25,1,27}, {6,25,4,27}, {7,25,6,26}, {7,25,7,27}, {8,25,8,26}, {5,26,0,28}, {5,26,2,28},
+  {6,26,3,28}, {7,26,5,27}, {7,26,6,27}, {8,26,8,27}, {5,27,1,28}, {5,27,1,29}, {6,27,4,28}, {7,27,5,28},
+  {7,27,6,28}, {8,27,8,28}, {5,28,0,29}, {5,28,2,29}, {6,28,4,29}, {7,28,5,29}, {7,28,6,29}, {8,28,7,28},
+  {5,29,0,30}, {5,29,3,30}, {6,29,3,29}, {7,29,7,29}, {7,29,7,30}, {8,29,8,29}, {5,30,1,30}, {5,30,2,30},
+  {6,30,4,30}, {7,30,5,30}, {7,30,6,30}, {8,30,8,30},
+  // 1 <-> 6: 216 pairs, total squared travel 3014
+  {5,1,0,1}, {5,1,1,1}, {6,1,2,1}, {6,1,3,1}, {7,1,5,1}, {7,1,6,1}, {8,1,7,1}, {8,1,8,1},
+  {5,2,1,2}, {6,2,2,2}, {6,2,3,2}, {7,2,4,1}, {7,2,5,2}, {8,2,7,2}, {8,2,8,2}, {5,3,0,2},
+  {5,3,1,3}, {6,3,3,3}, {7,3,4,2}, {7,3,5,3}, {8,3,6,2}, {8,3,8,3}, {5,4,0,3}, {5,4,1,4},
+  {6,4,2,3}, {6,4,3,4}, {7,4,4,3}, {8,4,6,3}, {8,4,7,3}, {5,5,0,4}, {5,5,1,5}, {6,5,2,4},
+  {6,5,2,5}, {7,5,4,4}, {7,5,5,4}, {8,5,6,4}, {5,6,0,5}, {5,6,0,6}, {6,6,1,6}, {6,6,2,6},
+  {7,6,3,5}, {7,6,3,6}, {8,6,7,4}, {8,6,8,4}, {5,7,0,7}, {6,7,1,7}, {6,7,1,8}, {7,7,2,7},
+  {7,7,2,8}, {8,7,3,7}, {8,7,3,8}, {5,8,0,8}, {5,8,0,9}, {6,8,1,9}, {7,8,2,9}, {7,8,2,10},
+  {8,8,3,9}, {8,8,3,10}, {5,9,0,10}, {5,9,0,11}, {6,9,1,10}, {6,9,1,11}, {7,9,2,11}, {8,9,3,11},
+  {8,9,8,14}, {5,10,0,12}, {5,10,0,13}, {6,10,1,12}, {6,10,2,12}, {7,10,3,12}, {7,10,3,13}, {8,10,6,14},
+  {5,11,1,13}, {5,11,0,14}, {6,11,2,13}, {6,11,3,14}, {7,11,4,14}, {7,11,5,14}, {8,11,7,14}, {8,11,8,15},
+  {5,12,1,14}, {6,12,2,14}, {6,12,3,15}, {7,12,4,15}, {7,12,5,15}, {8,12,6,15}, {8,12,7,15}, {5,13,0,15},
+  {5,13,1,15}, {6,13,2,15}, {7,13,5,16}, {7,13,6,16}, {8,13,7,16}, {8,13,8,16}, {5,14,0,16}, {5,14,1,16},
+  {6,14,2,16}, {6,14,3,16}, {7,14,4,16}, {8,14,7,17}, {8,14,8,17}, {5,15,0,17}, {5,15,1,17}, {6,15,2,17},
+  {6,15,3,17}, {7,15,4,17}, {7,15,5,17}, {8,15,6,17}, {5,16,0,18}, {5,16,1,18}, {6,16,2,18}, {6,16,3,18},
+  {7,16,5,18}, {7,16,6,18}, {8,16,7,18}, {8,16,8,18}, {5,17,1,19}, {6,17,2,19}, {6,17,3,19}, {7,17,5,19},
+  {7,17,6,19}, {8,17,7,19}, {8,17,8,19}, {5,18,0,19}, {5,18,0,20}, {6,18,3,20}, {7,18,5,20}, {7,18,6,20},
+  {8,18,7,20}, {8,18,8,20}, {5,19,1,20}, {5,19,1,21}, {6,19,2,20}, {6,19,3,21}, {7,19,6,21}, {8,19,7,21},
+  {8,19,8,21}, {5,20,0,21}, {5,20,1,22}, {6,20,2,21}, {6,20,3,22}, {7,20,5,21}, {7,20,6,22}, {8,20,8,22},
+  {5,21,0,22}, {5,21,0,23}, {6,21,2,22}, {6,21,2,23}, {7,21,5,22}, {7,21,6,23}, {8,21,7,22}, {8,21,8,23},
+  {5,22,1,23}, {6,22,3,23}, {6,22,2,24}, {7,22,5,23}, {7,22,5,24}, {8,22,7,23}, {8,22,8,24}, {5,23,0,24},
+  {5,23,1,24}, {6,23,3,24}, {7,23,6,24}, {7,23,5,25}, {8,23,7,24}, {8,23,8,25}, {5,24,0,25}, {5,24,1,25},
+  {6,24,2,25}, {6,24,3,25}, {7,24,6,25}, {8,24,7,25}, {8,24,8,26}, {5,25,0,26}, {5,25,1,26}, {6,25,2,26},
+  {6,25,3,26}, {7,25,5,26}, {7,25,6,26}, {8,25,7,26}, {5,26,0,27}, {5,26,1,27}, {6,26,2,27}, {6,26,3,27},
+  {7,26,4,27}, {7,26,5,27}, {8,26,7,27}, {8,26,8,27}, {5,27,0,28}, {6,27,2,28}, {6,27,3,28}, {7,27,4,28},
+  {7,27,6,28}, {8,27,6,27}, {8,27,8,28}, {5,28,1,28}, {5,28,0,29}, {6,28,2,29}, {7,28,5,28}, {7,28,6,29},
+  {8,28,7,28}, {8,28,8,29}, {5,29,1,29}, {5,29,0,30}, {6,29,3,29}, {6,29,4,29}, {7,29,5,29}, {8,29,7,29},
+  {8,29,8,30}, {5,30,1,30}, {5,30,2,30}, {6,30,3,30}, {6,30,4,30}, {7,30,5,30}, {7,30,6,30}, {8,30,7,30},
+  // 1 <-> 7: 140 pairs, total squared travel 920
+  {5,1,1,1}, {5,1,2,1}, {6,1,4,1}, {7,1,7,1}, {8,1,8,1}, {5,2,0,1}, {6,2,3,1}, {7,2,5,1},
+  {7,2,6,1}, {8,2,8,2}, {5,3,2,2}, {6,3,4,2}, {7,3,6,2}, {8,3,7,2}, {5,4,0,2}, {5,4,1,2},
+  {6,4,3,2}, {7,4,5,2}, {8,4,8,3}, {5,5,1,3}, {6,5,4,3}, {7,5,5,3}, {7,5,6,3}, {8,5,7,3},
+  {5,6,0,3}, {6,6,3,3}, {7,6,6,4}, {8,6,8,4}, {5,7,2,3}, {5,7,2,4}, {6,7,4,4}, {7,7,5,4},
+  {8,7,7,4}, {5,8,1,4}, {6,8,3,4}, {7,8,6,5}, {7,8,7,5}, {8,8,8,5}, {5,9,0,4}, {6,9,5,5},
+  {7,9,7,6}, {8,9,8,6}, {5,10,5,6}, {5,10,5,7}, {6,10,6,6}, {7,10,7,7}, {8,10,8,7}, {5,11,5,8},
+  {6,11,6,8}, {7,11,6,7}, {7,11,7,8}, {8,11,8,8}, {5,12,5,9}, {6,12,6,9}, {7,12,7,9}, {8,12,8,9},
+  {5,13,5,10}, {5,13,6,10}, {6,13,6,11}, {7,13,7,10}, {8,13,8,10}, {5,14,5,11}, {6,14,6,12}, {7,14,7,11},
+  {7,14,8,11}, {8,14,8,12}, {5,15,5,12}, {6,15,6,13}, {7,15,7,12}, {8,15,8,13}, {5,16,5,13}, {5,16,5,14},
+  {6,16,6,14}, {7,16,7,13}, {8,16,8,14}, {5,17,5,15}, {6,17,6,15}, {7,17,7,14}, {7,17,7,15}, {8,17,8,15},
+  {5,18,5,16}, {6,18,6,16}, {7,18,7,16}, {8,18,8,16}, {5,19,5,17}, {5,19,6,17}, {6,19,6,18}, {7,19,7,17},
+  {8,19,8,17}, {5,20,5,18}, {6,20,6,19}, {7,20,7,18}, {7,20,8,18}, {8,20,8,19}, {5,21,5,19}, {6,21,6,20},
+  {7,21,7,19}, {8,21,8,20}, {5,22,5,20}, {5,22,5,21}, {6,22,6,21}, {7,22,7,20}, {8,22,8,21}, {5,23,5,22},
+  {6,23,6,22}, {7,23,7,21}, {7,23,7,22}, {8,23,8,22}, {5,24,5,23}, {6,24,6,23}, {7,24,7,23}, {8,24,8,23},
+  {5,25,5,24}, {5,25,6,24}, {6,25,6,25}, {7,25,7,24}, {8,25,8,24}, {5,26,5,25}, {6,26,6,26}, {7,26,7,25},
+  {7,26,8,25}, {8,26,8,26}, {5,27,5,26}, {6,27,6,27}, {7,27,7,26}, {8,27,8,27}, {5,28,5,27}, {5,28,5,28},
+  {6,28,6,28}, {7,28,7,27}, {8,28,8,28}, {5,29,5,29}, {6,29,6,29}, {7,29,7,28}, {7,29,7,29}, {8,29,8,29},
+  {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 1 <-> 8: 252 pairs, total squared travel 2226
+  {5,1,0,1}, {5,1,1,1}, {5,1,2,1}, {6,1,3,1}, {6,1,4,1}, {7,1,5,1}, {7,1,6,1}, {8,1,7,1},
+  {8,1,8,1}, {5,2,0,2}, {5,2,1,2}, {6,2,3,2}, {6,2,4,2}, {7,2,5,2}, {7,2,6,2}, {8,2,7,2},
+  {8,2,8,2}, {5,3,0,3}, {5,3,1,3}, {6,3,2,2}, {6,3,3,3}, {7,3,4,3}, {7,3,5,3}, {7,3,6,3},
+  {8,3,7,3}, {8,3,8,3}, {5,4,0,4}, {5,4,1,4}, {6,4,2,3}, {6,4,3,4}, {7,4,5,4}, {7,4,6,4},
+  {8,4,7,4}, {8,4,8,4}, {5,5,0,5}, {5,5,1,5}, {6,5,2,4}, {6,5,3,5}, {7,5,4,4}, {7,5,6,5},
+  {8,5,7,5}, {8,5,8,5}, {5,6,0,6}, {5,6,1,6}, {5,6,2,6}, {6,6,2,5}, {6,6,3,6}, {7,6,5,5},
+  {7,6,6,6}, {8,6,7,6}, {8,6,8,6}, {5,7,0,7}, {5,7,1,7}, {6,7,2,7}, {6,7,3,7}, {7,7,5,6},
+  {7,7,6,7}, {8,7,7,7}, {8,7,8,7}, {5,8,0,8}, {5,8,1,8}, {6,8,2,8}, {6,8,3,8}, {7,8,5,7},
+  {7,8,5,8}, {7,8,6,8}, {8,8,7,8}, {8,8,8,8}, {5,9,0,9}, {5,9,1,9}, {6,9,2,9}, {6,9,3,9},
+  {7,9,5,9}, {7,9,6,9}, {8,9,7,9}, {8,9,8,9}, {5,10,0,10}, {5,10,1,10}, {6,10,2,10}, {6,10,3,10},
+  {7,10,5,10}, {7,10,6,10}, {8,10,7,10}, {8,10,8,10}, {5,11,0,11}, {5,11,1,11}, {5,11,1,12}, {6,11,2,11},
+  {6,11,3,11}, {7,11,5,11}, {7,11,6,11}, {8,11,7,11}, {8,11,8,11}, {5,12,0,12}, {5,12,1,13}, {6,12,2,12},
+  {6,12,3,12}, {7,12,5,12}, {7,12,6,12}, {8,12,7,12}, {8,12,8,12}, {5,13,0,13}, {5,13,0,14}, {6,13,2,13},
+  {6,13,3,13}, {7,13,5,13}, {7,13,6,13}, {7,13,4,14}, {8,13,7,13}, {8,13,8,13}, {5,14,1,14}, {5,14,0,15},
+  {6,14,2,14}, {6,14,3,14}, {7,14,5,14}, {7,14,6,14}, {8,14,7,14}, {8,14,8,14}, {5,15,1,15}, {5,15,2,15},
+  {6,15,3,15}, {6,15,4,15}, {7,15,5,15}, {7,15,6,15}, {8,15,7,15}, {8,15,8,15}, {5,16,0,16}, {5,16,1,16},
+  {5,16,2,16}, {6,16,3,16}, {6,16,4,16}, {7,16,5,16}, {7,16,6,16}, {8,16,7,16}, {8,16,8,16}, {5,17,0,17},
+  {5,17,1,17}, {6,17,2,17}, {6,17,3,17}, {7,17,5,17}, {7,17,6,17}, {8,17,7,17}, {8,17,8,17}, {5,18,0,18},
+  {5,18,1,18}, {6,18,2,18}, {6,18,3,18}, {7,18,4,17}, {7,18,5,18}, {7,18,6,18}, {8,18,7,18}, {8,18,8,18},
+  {5,19,0,19}, {5,19,1,19}, {6,19,2,19}, {6,19,3,19}, {7,19,5,19}, {7,19,6,19}, {8,19,7,19}, {8,19,8,19},
+  {5,20,0,20}, {5,20,1,20}, {6,20,2,20}, {6,20,3,20}, {7,20,5,20}, {7,20,6,20}, {8,20,7,20}, {8,20,8,20},
+  {5,21,0,21}, {5,21,1,21}, {5,21,0,22}, {6,21,2,21}, {6,21,3,21}, {7,21,5,21}, {7,21,6,21}, {8,21,7,21},
+  {8,21,8,21}, {5,22,1,22}, {5,22,0,23}, {6,22,2,22}, {6,22,3,22}, {7,22,5,22}, {7,22,6,22}, {8,22,7,22},
+  {8,22,8,22}, {5,23,1,23}, {5,23,0,24}, {6,23,2,23}, {6,23,3,23}, {7,23,5,23}, {7,23,6,23}, {7,23,5,24},
+  {8,23,7,23}, {8,23,8,23}, {5,24,1,24}, {5,24,0,25}, {6,24,2,24}, {6,24,3,24}, {7,24,6,24}, {7,24,5,25},
+  {8,24,7,24}, {8,24,8,24}, {5,25,1,25}, {5,25,0,26}, {6,25,2,25}, {6,25,3,25}, {7,25,6,25}, {7,25,5,26},
+  {8,25,7,25}, {8,25,8,25}, {5,26,1,26}, {5,26,0,27}, {5,26,1,27}, {6,26,2,26}, {6,26,3,26}, {7,26,6,26},
+  {7,26,4,27}, {8,26,7,26}, {8,26,8,26}, {5,27,0,28}, {5,27,1,28}, {6,27,2,27}, {6,27,3,27}, {7,27,5,27},
+  {7,27,6,27}, {8,27,7,27}, {8,27,8,27}, {5,28,0,29}, {5,28,1,29}, {6,28,2,28}, {6,28,3,28}, {7,28,4,28},
+  {7,28,5,28}, {7,28,6,28}, {8,28,7,28}, {8,28,8,28}, {5,29,2,29}, {5,29,0,30}, {6,29,3,29}, {6,29,4,29},
+  {7,29,5,29}, {7,29,6,29}, {8,29,7,29}, {8,29,8,29}, {5,30,1,30}, {5,30,2,30}, {6,30,3,30}, {6,30,4,30},
+  {7,30,5,30}, {7,30,6,30}, {8,30,7,30}, {8,30,8,30},
+  // 1 <-> 9: 216 pairs, total squared travel 2060
+  {5,1,1,1}, {5,1,2,1}, {6,1,3,1}, {6,1,4,1}, {7,1,5,1}, {7,1,6,1}, {8,1,7,1}, {8,1,8,1},
+  {5,2,0,1}, {6,2,2,2}, {6,2,3,2}, {7,2,4,2}, {7,2,5,2}, {8,2,7,2}, {8,2,8,2}, {5,3,0,2},
+  {5,3,1,2}, {6,3,4,3}, {7,3,5,3}, {7,3,6,3}, {8,3,6,2}, {8,3,8,3}, {5,4,0,3}, {5,4,1,3},
+  {6,4,2,3}, {6,4,3,3}, {7,4,6,4}, {8,4,7,3}, {8,4,8,4}, {5,5,0,4}, {5,5,1,4}, {6,5,2,4},
+  {6,5,3,4}, {7,5,4,4}, {7,5,5,4}, {8,5,7,4}, {5,6,0,5}, {5,6,1,5}, {6,6,2,5}, {6,6,3,5},
+  {7,6,5,5}, {7,6,6,5}, {8,6,7,5}, {8,6,8,5}, {5,7,0,6}, {6,7,2,6}, {6,7,3,6}, {7,7,5,6},
+  {7,7,6,6}, {8,7,7,6}, {8,7,8,6}, {5,8,1,6}, {5,8,1,7}, {6,8,2,7}, {7,8,5,7}, {7,8,6,7},
+  {8,8,7,7}, {8,8,8,7}, {5,9,0,7}, {5,9,1,8}, {6,9,3,7}, {6,9,3,8}, {7,9,5,8}, {8,9,7,8},
+  {8,9,8,8}, {5,10,0,8}, {5,10,1,9}, {6,10,2,8}, {6,10,3,9}, {7,10,6,8}, {7,10,6,9}, {8,10,7,9},
+  {5,11,0,9}, {5,11,1,10}, {6,11,2,9}, {6,11,3,10}, {7,11,5,9}, {7,11,6,10}, {8,11,8,9}, {8,11,8,10},
+  {5,12,0,10}, {6,12,2,10}, {6,12,3,11}, {7,12,5,10}, {7,12,6,11}, {8,12,7,10}, {8,12,8,11}, {5,13,0,11},
+  {5,13,1,11}, {6,13,2,11}, {7,13,5,11}, {7,13,6,12}, {8,13,7,11}, {8,13,8,12}, {5,14,0,12}, {5,14,1,12},
+  {6,14,2,12}, {6,14,3,12}, {7,14,5,12}, {8,14,7,12}, {8,14,8,13}, {5,15,0,13}, {5,15,1,13}, {6,15,2,13},
+  {6,15,3,13}, {7,15,5,13}, {7,15,6,13}, {8,15,7,13}, {5,16,0,14}, {5,16,1,14}, {6,16,2,14}, {6,16,3,14},
+  {7,16,5,14}, {7,16,6,14}, {8,16,7,14}, {8,16,8,14}, {5,17,1,15}, {6,17,4,14}, {6,17,3,15}, {7,17,5,15},
+  {7,17,6,15}, {8,17,7,15}, {8,17,8,15}, {5,18,0,15}, {5,18,2,15}, {6,18,4,15}, {7,18,5,16}, {7,18,6,16},
+  {8,18,7,16}, {8,18,8,16}, {5,19,0,16}, {5,19,1,16}, {6,19,3,16}, {6,19,4,16}, {7,19,6,17}, {8,19,7,17},
+  {8,19,8,17}, {5,20,2,16}, {5,20,1,17}, {6,20,3,17}, {6,20,4,17}, {7,20,5,17}, {7,20,6,18}, {8,20,8,18},
+  {5,21,0,17}, {5,21,2,17}, {6,21,5,18}, {6,21,5,19}, {7,21,6,19}, {7,21,7,19}, {8,21,7,18}, {8,21,8,19},
+  {5,22,5,20}, {6,22,6,20}, {6,22,6,21}, {7,22,7,20}, {7,22,7,21}, {8,22,8,20}, {8,22,8,21}, {5,23,5,21},
+  {5,23,5,22}, {6,23,6,22}, {7,23,7,22}, {7,23,7,23}, {8,23,8,22}, {8,23,8,23}, {5,24,5,23}, {5,24,5,24},
+  {6,24,6,23}, {6,24,6,24}, {7,24,7,24}, {8,24,8,24}, {8,24,8,25}, {5,25,0,27}, {5,25,2,27}, {6,25,5,25},
+  {6,25,5,26}, {7,25,6,25}, {7,25,7,25}, {8,25,8,26}, {5,26,1,27}, {5,26,2,28}, {6,26,3,27}, {6,26,4,27},
+  {7,26,6,26}, {7,26,6,27}, {8,26,7,26}, {8,26,8,27}, {5,27,0,28}, {6,27,3,28}, {6,27,4,28}, {7,27,5,27},
+  {7,27,6,28}, {8,27,7,27}, {8,27,8,28}, {5,28,1,28}, {5,28,2,29}, {6,28,3,29}, {7,28,5,28}, {7,28,6,29},
+  {8,28,7,28}, {8,28,8,29}, {5,29,0,29}, {5,29,1,29}, {6,29,4,29}, {6,29,4,30}, {7,29,5,29}, {8,29,7,29},
+  {8,29,8,30}, {5,30,0,30}, {5,30,1,30}, {6,30,2,30}, {6,30,3,30}, {7,30,5,30}, {7,30,6,30}, {8,30,7,30},
+  // 2 <-> 3: 180 pairs, total squared travel 668
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,4,1}, {5,1,5,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,1,2}, {2,2,2,2}, {3,2,3,2}, {4,2,4,2}, {5,2,5,2}, {6,2,6,2},
+  {7,2,7,2}, {8,2,8,2}, {0,3,0,3}, {1,3,1,3}, {2,3,2,3}, {3,3,3,3}, {4,3,4,3}, {5,3,5,3},
+  {6,3,6,3}, {7,3,7,3}, {8,3,8,3}, {0,4,0,4}, {1,4,1,4}, {2,4,2,4}, {3,4,3,4}, {4,4,4,4},
+  {5,4,5,4}, {6,4,6,4}, {7,4,7,4}, {8,4,8,4}, {5,5,5,5}, {6,5,6,5}, {7,5,7,5}, {8,5,8,5},
+  {5,6,5,6}, {6,6,6,6}, {7,6,7,6}, {8,6,8,6}, {5,7,5,7}, {6,7,6,7}, {7,7,7,7}, {8,7,8,7},
+  {5,8,5,8}, {6,8,6,8}, {7,8,7,8}, {8,8,8,8}, {5,9,5,9}, {6,9,6,9}, {7,9,7,9}, {8,9,8,9},
+  {5,10,5,10}, {6,10,6,10}, {7,10,7,10}, {8,10,8,10}, {5,11,5,11}, {6,11,6,11}, {7,11,7,11}, {8,11,8,11},
+  {5,12,5,12}, {6,12,6,12}, {7,12,7,12}, {8,12,8,12}, {5,13,5,13}, {6,13,6,13}, {7,13,7,13}, {8,13,8,13},
+  {0,14,0,14}, {1,14,2,14}, {2,14,3,14}, {3,14,4,14}, {4,14,5,14}, {5,14,6,14}, {6,14,7,15}, {7,14,7,14},
+  {8,14,8,14}, {0,15,1,14}, {1,15,2,15}, {2,15,3,15}, {3,15,4,15}, {4,15,5,15}, {5,15,6,15}, {6,15,7,16},
+  {7,15,8,16}, {8,15,8,15}, {0,16,0,15}, {1,16,1,15}, {2,16,3,16}, {3,16,4,16}, {4,16,5,16}, {5,16,6,16},
+  {6,16,7,17}, {7,16,8,17}, {8,16,8,18}, {0,17,0,16}, {1,17,2,16}, {2,17,4,17}, {3,17,5,17}, {4,17,6,17},
+  {5,17,7,19}, {6,17,7,18}, {7,17,8,20}, {8,17,8,19}, {0,18,1,16}, {1,18,2,17}, {2,18,5,18}, {3,18,6,18},
+  {0,19,1,17}, {1,19,3,17}, {2,19,6,19}, {3,19,7,20}, {0,20,0,17}, {1,20,5,19}, {2,20,6,20}, {3,20,8,21},
+  {0,21,5,21}, {1,21,5,20}, {2,21,6,21}, {3,21,7,21}, {0,22,5,22}, {1,22,6,22}, {2,22,7,22}, {3,22,8,22},
+  {0,23,5,23}, {1,23,5,24}, {2,23,6,23}, {3,23,7,23}, {0,24,0,27}, {1,24,5,25}, {2,24,6,24}, {3,24,8,23},
+  {0,25,1,27}, {1,25,3,27}, {2,25,5,26}, {3,25,7,24}, {0,26,0,28}, {1,26,2,27}, {2,26,4,27}, {3,26,6,25},
+  {0,27,1,28}, {1,27,2,28}, {2,27,4,28}, {3,27,5,27}, {4,27,6,26}, {5,27,7,25}, {6,27,7,26}, {7,27,8,24},
+  {8,27,8,25}, {0,28,1,29}, {1,28,2,29}, {2,28,3,28}, {3,28,5,28}, {4,28,6,28}, {5,28,6,27}, {6,28,7,27},
+  {7,28,8,27}, {8,28,8,26}, {0,29,0,29}, {1,29,2,30}, {2,29,3,29}, {3,29,4,29}, {4,29,5,29}, {5,29,6,29},
+  {6,29,7,28}, {7,29,8,29}, {8,29,8,28}, {0,30,0,30}, {1,30,1,30}, {2,30,3,30}, {3,30,4,30}, {4,30,5,30},
+  {5,30,6,30}, {6,30,7,30}, {7,30,7,29}, {8,30,8,30},
+  // 2 <-> 4: 192 pairs, total squared travel 2712
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,1,2}, {3,1,2,1}, {4,1,3,1}, {5,1,5,1}, {6,1,6,1},
+  {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,3}, {2,2,2,2}, {3,2,2,3}, {4,2,3,2}, {5,2,5,2},
+  {6,2,6,2}, {6,2,6,3}, {7,2,7,2}, {8,2,8,2}, {0,3,0,4}, {1,3,0,5}, {2,3,1,4}, {3,3,2,4},
+  {4,3,3,3}, {5,3,5,3}, {6,3,6,4}, {7,3,7,3}, {8,3,8,3}, {0,4,0,6}, {1,4,0,7}, {2,4,1,6},
+  {3,4,1,5}, {3,4,2,5}, {4,4,3,4}, {5,4,3,5}, {6,4,5,4}, {7,4,7,4}, {8,4,8,4}, {5,5,3,6},
+  {6,5,5,5}, {7,5,7,5}, {8,5,8,5}, {5,6,2,6}, {6,6,6,5}, {7,6,7,6}, {8,6,8,6}, {5,7,2,7},
+  {6,7,5,6}, {6,7,3,7}, {7,7,6,6}, {8,7,8,7}, {5,8,1,7}, {6,8,5,7}, {7,8,6,7}, {8,8,7,7},
+  {5,9,2,8}, {6,9,5,8}, {7,9,7,8}, {8,9,8,8}, {5,10,3,8}, {6,10,6,8}, {7,10,7,9}, {8,10,8,9},
+  {5,11,1,8}, {5,11,3,9}, {6,11,5,9}, {7,11,6,9}, {8,11,8,10}, {5,12,2,9}, {6,12,5,10}, {7,12,6,10},
+  {8,12,7,10}, {5,13,3,10}, {6,13,6,11}, {7,13,7,11}, {8,13,8,11}, {0,14,0,9}, {1,14,0,8}, {2,14,1,9},
+  {3,14,2,10}, {3,14,2,11}, {4,14,3,11}, {5,14,5,11}, {6,14,6,12}, {7,14,7,12}, {8,14,8,12}, {0,15,0,10},
+  {1,15,1,11}, {2,15,1,10}, {3,15,3,12}, {4,15,5,13}, {5,15,5,12}, {6,15,6,13}, {7,15,7,13}, {8,15,8,13},
+  {0,16,0,11}, {0,16,0,12}, {1,16,1,12}, {2,16,2,12}, {3,16,3,13}, {4,16,5,14}, {5,16,6,14}, {6,16,7,14},
+  {7,16,8,14}, {8,16,8,15}, {0,17,0,13}, {1,17,1,13}, {2,17,2,13}, {3,17,4,14}, {4,17,5,15}, {5,17,6,15},
+  {6,17,7,15}, {6,17,7,16}, {7,17,8,16}, {8,17,8,17}, {0,18,0,14}, {1,18,2,14}, {2,18,3,14}, {3,18,4,15},
+  {0,19,1,14}, {1,19,2,15}, {2,19,3,15}, {3,19,6,16}, {0,20,0,15}, {1,20,2,16}, {2,20,4,16}, {3,20,7,17},
+  {0,21,1,15}, {0,21,1,16}, {1,21,3,16}, {2,21,5,16}, {3,21,6,17}, {0,22,0,16}, {1,22,3,17}, {2,22,5,17},
+  {3,22,8,18}, {0,23,0,17}, {1,23,4,17}, {2,23,6,18}, {3,23,7,18}, {0,24,2,17}, {1,24,5,18}, {2,24,6,19},
+  {3,24,7,19}, {3,24,8,19}, {0,25,1,17}, {1,25,5,19}, {2,25,6,20}, {3,25,7,20}, {0,26,5,20}, {1,26,5,21},
+  {2,26,6,21}, {3,26,7,21}, {0,27,5,22}, {1,27,5,23}, {2,27,6,23}, {3,27,6,22}, {4,27,7,22}, {5,27,7,23},
+  {6,27,8,21}, {6,27,8,23}, {7,27,8,20}, {8,27,8,22}, {0,28,5,26}, {1,28,5,25}, {2,28,5,24}, {3,28,6,25},
+  {4,28,6,24}, {5,28,7,24}, {6,28,7,25}, {7,28,8,24}, {8,28,8,25}, {0,29,5,28}, {1,29,5,27}, {2,29,6,28},
+  {3,29,6,26}, {3,29,6,27}, {4,29,7,27}, {5,29,7,26}, {6,29,8,26}, {7,29,8,27}, {8,29,8,28}, {0,30,5,30},
+  {1,30,5,29}, {2,30,6,30}, {3,30,6,29}, {4,30,7,30}, {5,30,7,29}, {6,30,7,28}, {7,30,8,29}, {8,30,8,30},
+  // 2 <-> 5: 180 pairs, total squared travel 1260
+  {0,1,0,1}, {1,1,1,1}, {2,1,1,2}, {3,1,2,1}, {4,1,3,1}, {5,1,4,1}, {6,1,5,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,0,3}, {2,2,1,3}, {3,2,2,2}, {4,2,3,2}, {5,2,4,2}, {6,2,5,2},
+  {7,2,6,1}, {8,2,8,2}, {0,3,0,4}, {1,3,0,5}, {2,3,1,4}, {3,3,2,3}, {4,3,3,3}, {5,3,4,3},
+  {6,3,5,3}, {7,3,6,2}, {8,3,7,2}, {0,4,0,6}, {1,4,0,7}, {2,4,1,6}, {3,4,1,5}, {4,4,2,4},
+  {5,4,3,4}, {6,4,4,4}, {7,4,6,3}, {8,4,8,3}, {5,5,2,5}, {6,5,3,5}, {7,5,6,4}, {8,5,7,3},
+  {5,6,1,7}, {6,6,2,6}, {7,6,5,4}, {8,6,7,4}, {5,7,0,8}, {6,7,2,7}, {7,7,3,6}, {8,7,8,4},
+  {5,8,1,8}, {6,8,2,8}, {7,8,3,7}, {8,8,3,8}, {5,9,0,9}, {6,9,1,9}, {7,9,2,9}, {8,9,3,9},
+  {5,10,1,10}, {6,10,2,10}, {7,10,3,10}, {8,10,8,14}, {5,11,1,11}, {6,11,2,11}, {7,11,3,11}, {8,11,7,14},
+  {5,12,2,12}, {6,12,3,12}, {7,12,6,14}, {8,12,8,15}, {5,13,3,13}, {6,13,5,14}, {7,13,6,15}, {8,13,7,15},
+  {0,14,0,11}, {1,14,0,10}, {2,14,1,12}, {3,14,2,13}, {4,14,3,14}, {5,14,4,14}, {6,14,5,15}, {7,14,7,16},
+  {8,14,8,16}, {0,15,0,13}, {1,15,0,12}, {2,15,1,13}, {3,15,2,14}, {4,15,4,15}, {5,15,5,16}, {6,15,6,16},
+  {7,15,7,17}, {8,15,8,17}, {0,16,0,14}, {1,16,1,14}, {2,16,2,15}, {3,16,3,15}, {4,16,4,16}, {5,16,6,17},
+  {6,16,7,18}, {7,16,8,19}, {8,16,8,18}, {0,17,0,15}, {1,17,1,15}, {2,17,3,16}, {3,17,4,17}, {4,17,5,17},
+  {5,17,6,18}, {6,17,7,19}, {7,17,8,20}, {8,17,8,21}, {0,18,0,16}, {1,18,2,16}, {2,18,3,17}, {3,18,5,18},
+  {0,19,1,16}, {1,19,2,17}, {2,19,5,19}, {3,19,6,19}, {0,20,1,17}, {1,20,5,20}, {2,20,6,20}, {3,20,7,20},
+  {0,21,0,17}, {1,21,5,21}, {2,21,6,21}, {3,21,7,21}, {0,22,5,22}, {1,22,6,22}, {2,22,7,22}, {3,22,8,22},
+  {0,23,5,23}, {1,23,5,24}, {2,23,6,23}, {3,23,7,23}, {0,24,0,27}, {1,24,5,25}, {2,24,6,24}, {3,24,8,23},
+  {0,25,1,27}, {1,25,3,27}, {2,25,5,26}, {3,25,7,24}, {0,26,0,28}, {1,26,2,27}, {2,26,4,27}, {3,26,6,25},
+  {0,27,1,28}, {1,27,2,28}, {2,27,4,28}, {3,27,5,27}, {4,27,6,26}, {5,27,7,25}, {6,27,7,26}, {7,27,8,24},
+  {8,27,8,25}, {0,28,1,29}, {1,28,2,29}, {2,28,3,28}, {3,28,5,28}, {4,28,6,28}, {5,28,6,27}, {6,28,7,27},
+  {7,28,8,27}, {8,28,8,26}, {0,29,0,29}, {1,29,2,30}, {2,29,3,29}, {3,29,4,29}, {4,29,5,29}, {5,29,6,29},
+  {6,29,7,28}, {7,29,8,29}, {8,29,8,28}, {0,30,0,30}, {1,30,1,30}, {2,30,3,30}, {3,30,4,30}, {4,30,5,30},
+  {5,30,6,30}, {6,30,7,30}, {7,30,7,29}, {8,30,8,30},
+  // 2 <-> 6: 216 pairs, total squared travel 1519
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,1,2}, {3,1,2,1}, {4,1,3,1}, {5,1,4,1}, {5,1,3,2},
+  {6,1,5,1}, {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,3}, {1,2,0,4}, {2,2,2,3}, {3,2,2,2},
+  {4,2,3,3}, {5,2,4,2}, {6,2,5,2}, {6,2,4,3}, {7,2,6,1}, {8,2,8,2}, {0,3,0,6}, {1,3,0,5},
+  {2,3,1,4}, {2,3,1,5}, {3,3,2,4}, {4,3,2,5}, {5,3,3,4}, {6,3,5,3}, {7,3,6,2}, {7,3,6,3},
+  {8,3,7,2}, {0,4,0,7}, {1,4,0,8}, {2,4,0,9}, {3,4,1,6}, {3,4,1,7}, {4,4,2,6}, {5,4,3,5},
+  {6,4,4,4}, {7,4,6,4}, {8,4,7,3}, {8,4,8,3}, {5,5,2,7}, {6,5,3,6}, {7,5,5,4}, {8,5,7,4},
+  {5,6,1,8}, {5,6,1,9}, {6,6,2,8}, {7,6,3,7}, {8,6,8,4}, {5,7,0,10}, {6,7,2,9}, {6,7,1,10},
+  {7,7,3,9}, {8,7,3,8}, {5,8,0,11}, {6,8,2,11}, {7,8,2,10}, {7,8,3,11}, {8,8,3,10}, {5,9,1,11},
+  {6,9,2,12}, {7,9,3,12}, {8,9,7,14}, {8,9,8,14}, {5,10,1,12}, {6,10,3,13}, {7,10,5,14}, {8,10,6,14},
+  {5,11,1,13}, {5,11,2,13}, {6,11,3,14}, {7,11,4,14}, {8,11,8,15}, {5,12,2,14}, {6,12,4,15}, {6,12,5,15},
+  {7,12,6,15}, {8,12,7,15}, {5,13,3,15}, {6,13,5,16}, {7,13,6,16}, {7,13,7,16}, {8,13,8,16}, {0,14,0,12},
+  {1,14,0,13}, {2,14,1,14}, {3,14,1,15}, {3,14,2,15}, {4,14,3,16}, {5,14,4,16}, {6,14,6,17}, {7,14,7,17},
+  {8,14,8,17}, {8,14,8,18}, {0,15,0,15}, {1,15,0,14}, {2,15,1,16}, {3,15,2,16}, {4,15,3,17}, {4,15,4,17},
+  {5,15,5,17}, {6,15,6,18}, {7,15,7,18}, {8,15,8,19}, {0,16,0,16}, {0,16,0,17}, {1,16,1,17}, {2,16,2,17},
+  {3,16,3,18}, {4,16,5,18}, {5,16,5,19}, {5,16,6,19}, {6,16,7,20}, {7,16,7,19}, {8,16,8,20}, {0,17,0,18},
+  {1,17,1,18}, {1,17,1,19}, {2,17,2,18}, {3,17,3,19}, {4,17,5,20}, {5,17,6,20}, {6,17,7,21}, {6,17,7,22},
+  {7,17,8,22}, {8,17,8,21}, {0,18,0,19}, {1,18,2,19}, {2,18,2,20}, {2,18,3,20}, {3,18,6,21}, {0,19,0,20},
+  {1,19,1,20}, {2,19,2,21}, {3,19,5,21}, {3,19,6,22}, {0,20,0,21}, {1,20,1,21}, {2,20,3,21}, {3,20,5,22},
+  {0,21,0,22}, {0,21,1,22}, {1,21,2,22}, {2,21,3,22}, {3,21,6,23}, {0,22,0,23}, {1,22,1,23}, {1,22,2,23},
+  {2,22,3,23}, {3,22,7,23}, {0,23,0,24}, {1,23,2,24}, {2,23,5,23}, {2,23,3,24}, {3,23,8,23}, {0,24,1,24},
+  {1,24,2,25}, {2,24,5,24}, {3,24,6,24}, {3,24,7,24}, {0,25,0,25}, {1,25,1,25}, {2,25,3,25}, {3,25,5,25},
+  {0,26,0,26}, {0,26,1,26}, {1,26,2,26}, {2,26,3,26}, {3,26,5,26}, {0,27,0,27}, {1,27,1,27}, {1,27,2,27},
+  {2,27,3,27}, {3,27,4,27}, {4,27,6,25}, {5,27,6,26}, {6,27,7,25}, {6,27,7,26}, {7,27,8,24}, {8,27,8,25},
+  {0,28,0,28}, {1,28,1,28}, {2,28,2,28}, {2,28,3,28}, {3,28,4,28}, {4,28,5,27}, {5,28,6,27}, {6,28,7,27},
+  {7,28,8,27}, {7,28,7,28}, {8,28,8,26}, {0,29,0,29}, {1,29,1,29}, {2,29,2,29}, {3,29,3,29}, {3,29,4,29},
+  {4,29,5,28}, {5,29,6,29}, {6,29,6,28}, {7,29,7,29}, {8,29,8,28}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30},
+  {2,30,2,30}, {3,30,3,30}, {4,30,4,30}, {4,30,5,30}, {5,30,5,29}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 2 <-> 7: 180 pairs, total squared travel 2438
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,3,1}, {5,1,5,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,0,1}, {2,2,1,2}, {3,2,2,2}, {4,2,4,2}, {5,2,4,1}, {6,2,6,2},
+  {7,2,7,1}, {8,2,8,2}, {0,3,0,3}, {1,3,1,3}, {2,3,1,2}, {3,3,2,3}, {4,3,3,2}, {5,3,5,2},
+  {6,3,5,2}, {7,3,7,2}, {8,3,8,2}, {0,4,0,4}, {1,4,1,4}, {2,4,1,4}, {3,4,2,4}, {4,4,3,3},
+  {5,4,4,3}, {6,4,6,3}, {7,4,7,3}, {8,4,8,3}, {5,5,3,3}, {6,5,5,3}, {7,5,6,3}, {8,5,8,4},
+  {5,6,4,4}, {6,6,5,4}, {7,6,7,4}, {8,6,8,4}, {5,7,3,4}, {6,7,6,4}, {7,7,7,5}, {8,7,8,5},
+  {5,8,4,4}, {6,8,6,5}, {7,8,7,5}, {8,8,8,6}, {5,9,5,5}, {6,9,6,6}, {7,9,7,6}, {8,9,7,6},
+  {5,10,5,6}, {6,10,6,7}, {7,10,7,7}, {8,10,8,7}, {5,11,5,7}, {6,11,6,7}, {7,11,7,8}, {8,11,8,8},
+  {5,12,6,8}, {6,12,6,8}, {7,12,7,9}, {8,12,8,9}, {5,13,6,9}, {6,13,7,10}, {7,13,8,10}, {8,13,8,10},
+  {0,14,5,9}, {1,14,5,9}, {2,14,5,10}, {3,14,5,8}, {4,14,6,10}, {5,14,7,12}, {6,14,7,11}, {7,14,8,11},
+  {8,14,8,11}, {0,15,5,11}, {1,15,5,10}, {2,15,6,13}, {3,15,6,12}, {4,15,6,11}, {5,15,7,13}, {6,15,7,12},
+  {7,15,8,13}, {8,15,8,12}, {0,16,5,12}, {1,16,5,13}, {2,16,6,14}, {3,16,6,14}, {4,16,7,15}, {5,16,7,14},
+  {6,16,7,13}, {7,16,8,14}, {8,16,8,15}, {0,17,5,14}, {1,17,5,15}, {2,17,6,15}, {3,17,6,15}, {4,17,7,16},
+  {5,17,8,17}, {6,17,8,16}, {7,17,8,18}, {8,17,8,17}, {0,18,5,16}, {1,18,5,16}, {2,18,6,16}, {3,18,7,17},
+  {0,19,5,17}, {1,19,5,17}, {2,19,6,17}, {3,19,7,18}, {0,20,5,18}, {1,20,6,18}, {2,20,7,19}, {3,20,8,18},
+  {0,21,5,19}, {1,21,6,19}, {2,21,7,19}, {3,21,8,19}, {0,22,5,20}, {1,22,6,20}, {2,22,7,20}, {3,22,8,20},
+  {0,23,5,21}, {1,23,6,21}, {2,23,7,20}, {3,23,8,21}, {0,24,5,22}, {1,24,6,21}, {2,24,7,21}, {3,24,8,22},
+  {0,25,5,23}, {1,25,6,22}, {2,25,6,22}, {3,25,7,22}, {0,26,5,24}, {1,26,5,23}, {2,26,6,23}, {3,26,7,23},
+  {0,27,5,24}, {1,27,5,25}, {2,27,6,25}, {3,27,6,24}, {4,27,7,25}, {5,27,7,24}, {6,27,8,24}, {7,27,8,24},
+  {8,27,8,23}, {0,28,5,27}, {1,28,5,26}, {2,28,6,26}, {3,28,6,27}, {4,28,7,26}, {5,28,7,26}, {6,28,8,25},
+  {7,28,8,26}, {8,28,8,25}, {0,29,5,29}, {1,29,5,28}, {2,29,6,28}, {3,29,6,28}, {4,29,7,28}, {5,29,7,27},
+  {6,29,7,27}, {7,29,8,28}, {8,29,8,27}, {0,30,5,30}, {1,30,5,30}, {2,30,6,30}, {3,30,6,29}, {4,30,6,29},
+  {5,30,7,29}, {6,30,7,30}, {7,30,8,29}, {8,30,8,30},
+  // 2 <-> 8: 252 pairs, total squared travel 823
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,1,2}, {2,1,2,2}, {3,1,2,1}, {4,1,3,1}, {5,1,4,1},
+  {5,1,4,2}, {6,1,5,1}, {7,1,6,1}, {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,3}, {1,2,0,4},
+  {2,2,1,4}, {3,2,3,2}, {3,2,2,3}, {4,2,4,3}, {5,2,5,3}, {6,2,5,2}, {6,2,6,2}, {7,2,7,2},
+  {8,2,8,2}, {8,2,8,3}, {0,3,0,6}, {1,3,0,5}, {2,3,1,5}, {2,3,1,6}, {3,3,2,4}, {4,3,3,3},
+  {4,3,3,4}, {5,3,5,4}, {6,3,6,4}, {7,3,6,3}, {7,3,7,3}, {8,3,8,4}, {0,4,0,7}, {0,4,0,8},
+  {1,4,0,9}, {2,4,1,7}, {3,4,2,5}, {3,4,2,6}, {4,4,3,5}, {5,4,4,4}, {5,4,3,6}, {6,4,6,5},
+  {7,4,7,5}, {8,4,7,4}, {8,4,8,5}, {5,5,3,7}, {6,5,5,5}, {6,5,5,6}, {7,5,7,6}, {8,5,8,6},
+  {5,6,2,7}, {5,6,2,8}, {6,6,5,7}, {7,6,6,6}, {7,6,7,7}, {8,6,8,7}, {5,7,1,8}, {6,7,3,8},
+  {6,7,5,8}, {7,7,6,7}, {8,7,7,8}, {8,7,8,8}, {5,8,1,9}, {6,8,5,9}, {7,8,6,8}, {7,8,7,9},
+  {8,8,8,9}, {5,9,2,9}, {5,9,1,10}, {6,9,3,9}, {7,9,6,9}, {8,9,7,10}, {8,9,8,10}, {5,10,2,10},
+  {6,10,3,10}, {6,10,5,10}, {7,10,6,10}, {8,10,8,11}, {5,11,2,11}, {5,11,3,11}, {6,11,5,11}, {7,11,6,11},
+  {7,11,7,11}, {8,11,8,12}, {5,12,3,12}, {6,12,5,12}, {6,12,6,12}, {7,12,7,13}, {8,12,7,12}, {8,12,8,13},
+  {5,13,3,13}, {6,13,5,13}, {7,13,6,13}, {7,13,7,14}, {8,13,8,14}, {0,14,0,10}, {0,14,0,11}, {1,14,1,12},
+  {2,14,1,11}, {3,14,2,12}, {3,14,2,13}, {4,14,3,14}, {5,14,4,14}, {5,14,5,14}, {6,14,6,14}, {7,14,7,15},
+  {8,14,8,15}, {8,14,8,16}, {0,15,0,12}, {1,15,0,13}, {1,15,1,14}, {2,15,1,13}, {3,15,2,14}, {4,15,3,15},
+  {4,15,4,15}, {5,15,5,15}, {6,15,6,15}, {6,15,6,16}, {7,15,7,16}, {8,15,8,17}, {0,16,0,14}, {0,16,0,15},
+  {1,16,1,15}, {2,16,2,15}, {2,16,2,16}, {3,16,3,16}, {4,16,4,16}, {5,16,5,16}, {5,16,6,17}, {6,16,6,18},
+  {7,16,7,17}, {7,16,7,18}, {8,16,8,18}, {0,17,0,16}, {1,17,1,16}, {1,17,1,17}, {2,17,2,17}, {3,17,3,17},
+  {3,17,4,17}, {4,17,5,17}, {5,17,6,19}, {6,17,7,19}, {6,17,7,20}, {7,17,8,21}, {8,17,8,19}, {8,17,8,20},
+  {0,18,0,17}, {1,18,1,18}, {2,18,2,18}, {2,18,3,18}, {3,18,5,18}, {0,19,0,18}, {0,19,1,19}, {1,19,2,19},
+  {2,19,3,19}, {3,19,5,19}, {3,19,6,20}, {0,20,0,19}, {1,20,1,20}, {1,20,2,20}, {2,20,3,20}, {3,20,5,20},
+  {0,21,0,20}, {0,21,1,21}, {1,21,2,21}, {2,21,3,21}, {2,21,5,21}, {3,21,7,21}, {0,22,0,21}, {1,22,1,22},
+  {1,22,2,22}, {2,22,3,22}, {3,22,6,21}, {3,22,6,22}, {0,23,0,22}, {1,23,2,23}, {2,23,5,22}, {2,23,5,23},
+  {3,23,7,22}, {0,24,0,23}, {0,24,0,24}, {1,24,1,23}, {2,24,3,23}, {3,24,6,23}, {3,24,7,23}, {0,25,0,25},
+  {1,25,1,24}, {1,25,2,24}, {2,25,3,24}, {3,25,5,24}, {0,26,0,26}, {0,26,1,26}, {1,26,1,25}, {2,26,2,25},
+  {2,26,3,25}, {3,26,5,25}, {0,27,0,27}, {1,27,1,27}, {1,27,2,27}, {2,27,2,26}, {3,27,3,26}, {3,27,3,27},
+  {4,27,6,25}, {5,27,6,24}, {6,27,7,24}, {6,27,7,25}, {7,27,8,24}, {8,27,8,22}, {8,27,8,23}, {0,28,0,28},
+  {1,28,1,28}, {2,28,2,28}, {2,28,3,28}, {3,28,4,27}, {4,28,5,26}, {4,28,5,27}, {5,28,6,26}, {6,28,7,26},
+  {7,28,8,25}, {7,28,8,27}, {8,28,8,26}, {0,29,0,29}, {0,29,1,29}, {1,29,2,29}, {2,29,3,29}, {3,29,4,28},
+  {3,29,4,29}, {4,29,5,28}, {5,29,6,27}, {5,29,6,28}, {6,29,7,28}, {7,29,7,27}, {8,29,8,28}, {8,29,8,29},
+  {0,30,0,30}, {1,30,1,30}, {1,30,2,30}, {2,30,3,30}, {3,30,4,30}, {4,30,5,29}, {4,30,5,30}, {5,30,6,30},
+  {6,30,6,29}, {6,30,7,30}, {7,30,7,29}, {8,30,8,30},
+  // 2 <-> 9: 216 pairs, total squared travel 1465
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,3,2}, {5,1,4,1}, {5,1,5,1},
+  {6,1,6,1}, {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,2}, {1,2,1,3}, {2,2,2,2}, {3,2,2,3},
+  {4,2,3,3}, {5,2,4,2}, {6,2,5,2}, {6,2,6,2}, {7,2,7,2}, {8,2,8,2}, {0,3,0,4}, {1,3,0,5},
+  {2,3,1,4}, {2,3,1,5}, {3,3,2,4}, {4,3,3,4}, {5,3,4,3}, {6,3,5,3}, {7,3,6,3}, {7,3,7,3},
+  {8,3,8,3}, {0,4,0,6}, {1,4,0,7}, {2,4,1,6}, {3,4,2,6}, {3,4,1,7}, {4,4,2,5}, {5,4,4,4},
+  {6,4,5,4}, {7,4,6,4}, {8,4,7,4}, {8,4,8,4}, {5,5,3,5}, {6,5,6,5}, {7,5,7,5}, {8,5,8,5},
+  {5,6,3,6}, {5,6,3,7}, {6,6,5,5}, {7,6,7,6}, {8,6,8,6}, {5,7,2,7}, {6,7,5,6}, {6,7,5,7},
+  {7,7,6,6}, {8,7,8,7}, {5,8,2,8}, {6,8,3,8}, {7,8,6,7}, {7,8,7,7}, {8,8,8,8}, {5,9,1,8},
+  {6,9,5,8}, {7,9,6,8}, {8,9,7,8}, {8,9,8,9}, {5,10,0,8}, {6,10,5,9}, {7,10,6,9}, {8,10,7,9},
+  {5,11,2,9}, {5,11,3,9}, {6,11,5,10}, {7,11,7,10}, {8,11,8,10}, {5,12,3,10}, {6,12,6,10}, {6,12,6,11},
+  {7,12,7,11}, {8,12,8,11}, {5,13,5,11}, {6,13,6,12}, {7,13,7,12}, {7,13,7,13}, {8,13,8,12}, {0,14,0,10},
+  {1,14,0,9}, {2,14,1,10}, {3,14,1,9}, {3,14,2,10}, {4,14,3,11}, {5,14,5,12}, {6,14,6,13}, {7,14,7,14},
+  {8,14,8,13}, {8,14,8,14}, {0,15,0,11}, {1,15,1,11}, {2,15,2,12}, {3,15,2,11}, {4,15,3,12}, {4,15,3,13},
+  {5,15,5,13}, {6,15,6,14}, {7,15,7,15}, {8,15,8,15}, {0,16,0,12}, {0,16,0,13}, {1,16,1,12}, {2,16,2,13},
+  {3,16,3,14}, {4,16,4,14}, {5,16,5,14}, {5,16,6,15}, {6,16,7,16}, {7,16,8,16}, {8,16,8,17}, {0,17,0,14},
+  {1,17,1,13}, {1,17,1,14}, {2,17,2,14}, {3,17,4,15}, {4,17,5,15}, {5,17,6,16}, {6,17,7,17}, {6,17,7,18},
+  {7,17,8,19}, {8,17,8,18}, {0,18,0,15}, {1,18,1,15}, {2,18,3,15}, {2,18,3,16}, {3,18,5,16}, {0,19,1,16},
+  {1,19,2,15}, {2,19,4,16}, {3,19,5,17}, {3,19,6,17}, {0,20,0,16}, {1,20,2,16}, {2,20,4,17}, {3,20,6,18},
+  {0,21,0,17}, {0,21,1,17}, {1,21,3,17}, {2,21,5,18}, {3,21,7,19}, {0,22,2,17}, {1,22,5,19}, {1,22,5,20},
+  {2,22,6,19}, {3,22,8,20}, {0,23,5,21}, {1,23,6,21}, {2,23,6,20}, {2,23,7,21}, {3,23,7,20}, {0,24,5,23},
+  {1,24,5,22}, {2,24,6,22}, {3,24,8,21}, {3,24,7,22}, {0,25,1,27}, {1,25,5,24}, {2,25,6,23}, {3,25,7,23},
+  {0,26,0,27}, {0,26,1,28}, {1,26,3,27}, {2,26,5,25}, {3,26,6,24}, {0,27,0,28}, {1,27,2,27}, {1,27,2,28},
+  {2,27,4,27}, {3,27,5,26}, {4,27,6,25}, {5,27,7,24}, {6,27,8,22}, {6,27,7,25}, {7,27,8,23}, {8,27,8,24},
+  {0,28,1,29}, {1,28,2,29}, {2,28,3,28}, {2,28,4,28}, {3,28,5,27}, {4,28,6,27}, {5,28,6,26}, {6,28,7,26},
+  {7,28,8,26}, {7,28,8,27}, {8,28,8,25}, {0,29,0,29}, {1,29,2,30}, {2,29,3,29}, {3,29,5,28}, {3,29,4,29},
+  {4,29,6,28}, {5,29,6,29}, {6,29,7,27}, {7,29,7,28}, {8,29,8,28}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30},
+  {2,30,3,30}, {3,30,4,30}, {4,30,5,29}, {4,30,5,30}, {5,30,6,30}, {6,30,7,30}, {7,30,7,29}, {8,30,8,30},
+  // 3 <-> 4: 192 pairs, total squared travel 2378
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,1,2}, {3,1,2,1}, {4,1,3,1}, {5,1,5,1}, {6,1,6,1},
+  {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,3}, {2,2,2,2}, {3,2,2,3}, {4,2,3,2}, {5,2,5,2},
+  {6,2,6,2}, {6,2,6,3}, {7,2,7,2}, {8,2,8,2}, {0,3,0,4}, {1,3,0,5}, {2,3,1,4}, {3,3,2,4},
+  {4,3,3,3}, {5,3,5,3}, {6,3,6,4}, {7,3,7,3}, {8,3,8,3}, {0,4,0,6}, {1,4,0,7}, {2,4,1,6},
+  {3,4,1,5}, {3,4,2,5}, {4,4,3,5}, {5,4,3,4}, {6,4,5,4}, {7,4,7,4}, {8,4,8,4}, {5,5,3,6},
+  {6,5,5,5}, {7,5,7,5}, {8,5,8,5}, {5,6,2,6}, {6,6,6,5}, {7,6,7,6}, {8,6,8,6}, {5,7,2,7},
+  {6,7,5,6}, {6,7,3,7}, {7,7,6,6}, {8,7,8,7}, {5,8,1,7}, {6,8,5,7}, {7,8,6,7}, {8,8,7,7},
+  {5,9,2,8}, {6,9,5,8}, {7,9,6,8}, {8,9,8,8}, {5,10,1,8}, {6,10,3,8}, {7,10,7,8}, {8,10,8,9},
+  {5,11,0,8}, {5,11,2,9}, {6,11,5,9}, {7,11,6,9}, {8,11,7,9}, {5,12,3,9}, {6,12,5,10}, {7,12,6,10},
+  {8,12,7,10}, {5,13,3,10}, {6,13,5,11}, {7,13,7,11}, {8,13,8,10}, {0,14,0,9}, {1,14,0,10}, {2,14,1,11},
+  {3,14,1,9}, {3,14,1,10}, {4,14,2,10}, {5,14,3,11}, {6,14,6,11}, {7,14,6,12}, {8,14,8,11}, {0,15,0,12},
+  {1,15,0,11}, {2,15,1,12}, {3,15,2,12}, {4,15,2,11}, {5,15,3,12}, {6,15,5,12}, {7,15,7,12}, {8,15,8,12},
+  {0,16,0,13}, {0,16,0,14}, {1,16,1,14}, {2,16,1,13}, {3,16,2,13}, {4,16,3,13}, {5,16,4,14}, {6,16,5,13},
+  {7,16,6,13}, {8,16,8,13}, {0,17,0,16}, {1,17,0,15}, {2,17,1,15}, {3,17,2,14}, {4,17,2,15}, {5,17,3,14},
+  {6,17,5,14}, {6,17,6,14}, {7,17,7,13}, {8,17,8,14}, {5,18,4,15}, {6,18,5,15}, {7,18,7,14}, {8,18,8,15},
+  {5,19,3,15}, {6,19,6,15}, {7,19,7,15}, {8,19,8,16}, {5,20,2,16}, {6,20,5,16}, {7,20,6,16}, {8,20,7,16},
+  {5,21,1,16}, {5,21,3,16}, {6,21,4,16}, {7,21,6,17}, {8,21,7,17}, {5,22,3,17}, {6,22,5,17}, {7,22,7,18},
+  {8,22,8,17}, {5,23,4,17}, {6,23,5,18}, {7,23,6,18}, {8,23,8,18}, {5,24,5,19}, {6,24,6,19}, {7,24,7,19},
+  {8,24,8,19}, {8,24,8,20}, {5,25,5,20}, {6,25,6,20}, {7,25,7,20}, {8,25,8,21}, {5,26,6,21}, {6,26,7,22},
+  {7,26,7,21}, {8,26,8,22}, {0,27,0,17}, {1,27,2,17}, {2,27,5,21}, {3,27,5,22}, {4,27,6,22}, {5,27,6,23},
+  {6,27,7,23}, {6,27,7,24}, {7,27,8,23}, {8,27,8,24}, {0,28,1,17}, {1,28,5,24}, {2,28,5,23}, {3,28,6,24},
+  {4,28,6,25}, {5,28,7,26}, {6,28,7,25}, {7,28,8,26}, {8,28,8,25}, {0,29,5,25}, {1,29,5,27}, {2,29,5,26},
+  {3,29,6,27}, {3,29,6,28}, {4,29,6,26}, {5,29,7,28}, {6,29,7,27}, {7,29,8,27}, {8,29,8,28}, {0,30,5,30},
+  {1,30,5,29}, {2,30,5,28}, {3,30,6,29}, {4,30,6,30}, {5,30,7,29}, {6,30,7,30}, {7,30,8,29}, {8,30,8,30},
+  // 3 <-> 5: 180 pairs, total squared travel 668
+  {0,1,0,1}, {1,1,1,1}, {2,1,1,2}, {3,1,2,1}, {4,1,3,1}, {5,1,4,1}, {6,1,5,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,0,3}, {2,2,1,3}, {3,2,2,2}, {4,2,3,2}, {5,2,4,2}, {6,2,5,2},
+  {7,2,6,1}, {8,2,8,2}, {0,3,0,4}, {1,3,0,5}, {2,3,1,4}, {3,3,2,3}, {4,3,3,3}, {5,3,4,3},
+  {6,3,5,3}, {7,3,6,2}, {8,3,7,2}, {0,4,0,6}, {1,4,0,7}, {2,4,1,6}, {3,4,1,5}, {4,4,2,4},
+  {5,4,3,4}, {6,4,4,4}, {7,4,6,3}, {8,4,8,3}, {5,5,2,5}, {6,5,3,5}, {7,5,6,4}, {8,5,7,3},
+  {5,6,1,7}, {6,6,2,6}, {7,6,5,4}, {8,6,7,4}, {5,7,0,8}, {6,7,2,7}, {7,7,3,6}, {8,7,8,4},
+  {5,8,1,8}, {6,8,2,8}, {7,8,3,7}, {8,8,3,8}, {5,9,0,9}, {6,9,1,9}, {7,9,2,9}, {8,9,3,9},
+  {5,10,1,10}, {6,10,2,10}, {7,10,3,11}, {8,10,3,10}, {5,11,0,10}, {6,11,2,11}, {7,11,3,12}, {8,11,7,14},
+  {5,12,1,11}, {6,12,3,13}, {7,12,6,14}, {8,12,8,14}, {5,13,2,12}, {6,13,4,14}, {7,13,5,14}, {8,13,7,15},
+  {0,14,0,11}, {1,14,0,12}, {2,14,1,13}, {3,14,1,12}, {4,14,2,13}, {5,14,3,14}, {6,14,5,15}, {7,14,6,15},
+  {8,14,8,15}, {0,15,0,13}, {1,15,0,14}, {2,15,1,14}, {3,15,2,15}, {4,15,2,14}, {5,15,3,15}, {6,15,4,15},
+  {7,15,6,16}, {8,15,8,16}, {0,16,0,16}, {1,16,0,15}, {2,16,1,15}, {3,16,2,16}, {4,16,3,16}, {5,16,4,16},
+  {6,16,5,16}, {7,16,6,17}, {8,16,7,16}, {0,17,0,17}, {1,17,1,17}, {2,17,1,16}, {3,17,2,17}, {4,17,3,17},
+  {5,17,4,17}, {6,17,5,17}, {7,17,7,17}, {8,17,8,17}, {5,18,5,18}, {6,18,6,18}, {7,18,7,18}, {8,18,8,18},
+  {5,19,5,19}, {6,19,6,19}, {7,19,7,19}, {8,19,8,19}, {5,20,5,20}, {6,20,6,20}, {7,20,7,20}, {8,20,8,20},
+  {5,21,5,21}, {6,21,6,21}, {7,21,7,21}, {8,21,8,21}, {5,22,5,22}, {6,22,6,22}, {7,22,7,22}, {8,22,8,22},
+  {5,23,5,23}, {6,23,6,23}, {7,23,7,23}, {8,23,8,23}, {5,24,5,24}, {6,24,6,24}, {7,24,7,24}, {8,24,8,24},
+  {5,25,5,25}, {6,25,6,25}, {7,25,7,25}, {8,25,8,25}, {5,26,5,26}, {6,26,6,26}, {7,26,7,26}, {8,26,8,26},
+  {0,27,0,27}, {1,27,1,27}, {2,27,2,27}, {3,27,3,27}, {4,27,4,27}, {5,27,5,27}, {6,27,6,27}, {7,27,7,27},
+  {8,27,8,27}, {0,28,0,28}, {1,28,1,28}, {2,28,2,28}, {3,28,3,28}, {4,28,4,28}, {5,28,5,28}, {6,28,6,28},
+  {7,28,7,28}, {8,28,8,28}, {0,29,0,29}, {1,29,1,29}, {2,29,2,29}, {3,29,3,29}, {4,29,4,29}, {5,29,5,29},
+  {6,29,6,29}, {7,29,7,29}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,30},
+  {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 3 <-> 6: 216 pairs, total squared travel 1584
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,1,2}, {3,1,2,1}, {4,1,3,1}, {5,1,4,1}, {5,1,3,2},
+  {6,1,5,1}, {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,3}, {1,2,0,4}, {2,2,2,3}, {3,2,2,2},
+  {4,2,3,3}, {5,2,4,2}, {6,2,5,2}, {6,2,4,3}, {7,2,6,1}, {8,2,8,2}, {0,3,0,6}, {1,3,0,5},
+  {2,3,1,4}, {2,3,1,5}, {3,3,2,4}, {4,3,2,5}, {5,3,3,4}, {6,3,5,3}, {7,3,6,2}, {7,3,6,3},
+  {8,3,7,2}, {0,4,0,7}, {1,4,0,8}, {2,4,0,9}, {3,4,1,6}, {3,4,1,7}, {4,4,2,6}, {5,4,3,5},
+  {6,4,4,4}, {7,4,6,4}, {8,4,7,3}, {8,4,8,3}, {5,5,2,7}, {6,5,3,6}, {7,5,5,4}, {8,5,7,4},
+  {5,6,1,8}, {5,6,1,9}, {6,6,2,8}, {7,6,3,7}, {8,6,8,4}, {5,7,0,10}, {6,7,2,9}, {6,7,1,10},
+  {7,7,3,9}, {8,7,3,8}, {5,8,0,11}, {6,8,2,11}, {7,8,2,10}, {7,8,3,11}, {8,8,3,10}, {5,9,1,11},
+  {6,9,2,12}, {7,9,3,12}, {8,9,7,14}, {8,9,8,14}, {5,10,1,12}, {6,10,3,13}, {7,10,5,14}, {8,10,6,14},
+  {5,11,0,12}, {5,11,1,13}, {6,11,2,13}, {7,11,4,14}, {8,11,8,15}, {5,12,2,14}, {6,12,3,14}, {6,12,5,15},
+  {7,12,6,15}, {8,12,7,15}, {5,13,3,15}, {6,13,4,15}, {7,13,6,16}, {7,13,7,16}, {8,13,8,16}, {0,14,0,14},
+  {1,14,0,13}, {2,14,0,15}, {3,14,1,14}, {3,14,1,15}, {4,14,2,15}, {5,14,3,16}, {6,14,4,16}, {7,14,5,16},
+  {8,14,7,17}, {8,14,8,17}, {0,15,0,16}, {1,15,0,17}, {2,15,1,16}, {3,15,1,17}, {4,15,2,16}, {4,15,2,17},
+  {5,15,4,17}, {6,15,5,17}, {7,15,6,17}, {8,15,8,18}, {0,16,0,18}, {0,16,0,19}, {1,16,1,19}, {2,16,1,18},
+  {3,16,2,18}, {4,16,2,19}, {5,16,3,17}, {5,16,3,18}, {6,16,5,18}, {7,16,6,18}, {8,16,7,18}, {0,17,0,21},
+  {1,17,0,20}, {1,17,0,22}, {2,17,1,21}, {3,17,1,20}, {4,17,2,20}, {5,17,3,19}, {6,17,5,19}, {6,17,6,19},
+  {7,17,7,19}, {8,17,8,19}, {5,18,3,20}, {6,18,5,20}, {7,18,6,20}, {7,18,7,20}, {8,18,8,20}, {5,19,2,21},
+  {6,19,3,21}, {7,19,6,21}, {8,19,7,21}, {8,19,8,21}, {5,20,1,22}, {6,20,5,22}, {7,20,5,21}, {8,20,8,22},
+  {5,21,2,22}, {5,21,1,23}, {6,21,3,22}, {7,21,6,22}, {8,21,7,22}, {5,22,2,23}, {6,22,3,23}, {6,22,5,23},
+  {7,22,6,23}, {8,22,8,23}, {5,23,1,24}, {6,23,5,24}, {7,23,7,23}, {7,23,7,24}, {8,23,8,24}, {5,24,2,24},
+  {6,24,3,24}, {7,24,6,24}, {8,24,7,25}, {8,24,8,25}, {5,25,3,25}, {6,25,5,25}, {7,25,6,25}, {8,25,7,26},
+  {5,26,2,25}, {5,26,3,26}, {6,26,5,26}, {7,26,6,26}, {8,26,8,26}, {0,27,0,25}, {1,27,0,23}, {1,27,0,24},
+  {2,27,1,25}, {3,27,2,26}, {4,27,3,27}, {5,27,4,27}, {6,27,5,27}, {6,27,6,27}, {7,27,7,27}, {8,27,8,27},
+  {0,28,0,26}, {1,28,0,27}, {2,28,1,26}, {2,28,1,27}, {3,28,2,27}, {4,28,3,28}, {5,28,4,28}, {6,28,5,28},
+  {7,28,6,28}, {7,28,7,28}, {8,28,8,28}, {0,29,0,29}, {1,29,0,28}, {2,29,1,28}, {3,29,2,28}, {3,29,2,29},
+  {4,29,3,29}, {5,29,4,29}, {6,29,5,29}, {7,29,6,29}, {8,29,7,29}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30},
+  {2,30,1,29}, {3,30,2,30}, {4,30,3,30}, {4,30,4,30}, {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 3 <-> 7: 180 pairs, total squared travel 1544
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,3,1}, {5,1,5,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,0,1}, {2,2,1,2}, {3,2,2,2}, {4,2,4,2}, {5,2,4,1}, {6,2,6,2},
+  {7,2,7,1}, {8,2,8,2}, {0,3,0,3}, {1,3,1,3}, {2,3,1,2}, {3,3,2,3}, {4,3,3,2}, {5,3,5,2},
+  {6,3,5,2}, {7,3,7,2}, {8,3,8,2}, {0,4,0,4}, {1,4,1,4}, {2,4,1,4}, {3,4,2,4}, {4,4,3,3},
+  {5,4,4,3}, {6,4,6,3}, {7,4,7,3}, {8,4,8,3}, {5,5,3,3}, {6,5,5,3}, {7,5,6,3}, {8,5,8,4},
+  {5,6,4,4}, {6,6,5,4}, {7,6,7,4}, {8,6,8,4}, {5,7,3,4}, {6,7,6,4}, {7,7,7,5}, {8,7,8,5},
+  {5,8,4,4}, {6,8,6,5}, {7,8,7,5}, {8,8,8,6}, {5,9,5,5}, {6,9,6,6}, {7,9,7,6}, {8,9,7,6},
+  {5,10,5,6}, {6,10,6,7}, {7,10,7,7}, {8,10,8,7}, {5,11,5,7}, {6,11,6,7}, {7,11,7,8}, {8,11,8,8},
+  {5,12,6,8}, {6,12,6,8}, {7,12,7,9}, {8,12,8,9}, {5,13,6,9}, {6,13,7,10}, {7,13,8,10}, {8,13,8,10},
+  {0,14,5,9}, {1,14,5,10}, {2,14,5,8}, {3,14,5,9}, {4,14,6,11}, {5,14,6,10}, {6,14,7,11}, {7,14,8,11},
+  {8,14,8,11}, {0,15,5,10}, {1,15,5,11}, {2,15,5,12}, {3,15,6,12}, {4,15,6,13}, {5,15,7,12}, {6,15,7,12},
+  {7,15,8,12}, {8,15,8,13}, {0,16,5,13}, {1,16,5,14}, {2,16,5,15}, {3,16,6,14}, {4,16,6,14}, {5,16,7,13},
+  {6,16,7,13}, {7,16,7,14}, {8,16,8,14}, {0,17,5,17}, {1,17,5,17}, {2,17,5,16}, {3,17,5,16}, {4,17,6,15},
+  {5,17,6,16}, {6,17,6,15}, {7,17,7,15}, {8,17,8,15}, {5,18,6,17}, {6,18,7,16}, {7,18,8,16}, {8,18,8,17},
+  {5,19,6,18}, {6,19,7,17}, {7,19,8,17}, {8,19,8,18}, {5,20,5,18}, {6,20,7,18}, {7,20,7,19}, {8,20,8,18},
+  {5,21,5,19}, {6,21,6,19}, {7,21,7,19}, {8,21,8,19}, {5,22,5,20}, {6,22,6,20}, {7,22,7,20}, {8,22,8,20},
+  {5,23,5,21}, {6,23,7,20}, {7,23,7,21}, {8,23,8,21}, {5,24,6,21}, {6,24,6,21}, {7,24,7,22}, {8,24,8,22},
+  {5,25,6,22}, {6,25,6,22}, {7,25,7,23}, {8,25,8,23}, {5,26,6,23}, {6,26,7,24}, {7,26,8,24}, {8,26,8,24},
+  {0,27,5,22}, {1,27,5,23}, {2,27,5,24}, {3,27,5,23}, {4,27,6,24}, {5,27,6,25}, {6,27,7,25}, {7,27,8,25},
+  {8,27,8,25}, {0,28,5,26}, {1,28,5,24}, {2,28,5,25}, {3,28,6,26}, {4,28,6,27}, {5,28,7,27}, {6,28,7,26},
+  {7,28,7,26}, {8,28,8,26}, {0,29,5,29}, {1,29,5,28}, {2,29,5,27}, {3,29,6,28}, {4,29,6,28}, {5,29,7,28},
+  {6,29,7,27}, {7,29,8,28}, {8,29,8,27}, {0,30,5,30}, {1,30,5,30}, {2,30,6,30}, {3,30,6,29}, {4,30,6,29},
+  {5,30,7,30}, {6,30,7,29}, {7,30,8,30}, {8,30,8,29},
+  // 3 <-> 8: 252 pairs, total squared travel 881
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,1,2}, {2,1,2,2}, {3,1,2,1}, {4,1,3,1}, {5,1,4,1},
+  {5,1,4,2}, {6,1,5,1}, {7,1,6,1}, {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,3}, {1,2,0,4},
+  {2,2,1,4}, {3,2,3,2}, {3,2,2,3}, {4,2,4,3}, {5,2,5,3}, {6,2,5,2}, {6,2,6,2}, {7,2,7,2},
+  {8,2,8,2}, {8,2,8,3}, {0,3,0,6}, {1,3,0,5}, {2,3,1,5}, {2,3,1,6}, {3,3,2,4}, {4,3,3,3},
+  {4,3,3,4}, {5,3,5,4}, {6,3,6,4}, {7,3,6,3}, {7,3,7,3}, {8,3,8,4}, {0,4,0,7}, {0,4,0,8},
+  {1,4,0,9}, {2,4,1,7}, {3,4,2,5}, {3,4,2,6}, {4,4,3,5}, {5,4,4,4}, {5,4,3,6}, {6,4,6,5},
+  {7,4,7,5}, {8,4,7,4}, {8,4,8,5}, {5,5,3,7}, {6,5,5,5}, {6,5,5,6}, {7,5,7,6}, {8,5,8,6},
+  {5,6,2,7}, {5,6,2,8}, {6,6,5,7}, {7,6,6,6}, {7,6,7,7}, {8,6,8,7}, {5,7,1,8}, {6,7,3,8},
+  {6,7,5,8}, {7,7,6,7}, {8,7,7,8}, {8,7,8,8}, {5,8,1,9}, {6,8,5,9}, {7,8,6,8}, {7,8,7,9},
+  {8,8,8,9}, {5,9,2,9}, {5,9,1,10}, {6,9,3,9}, {7,9,6,9}, {8,9,7,10}, {8,9,8,10}, {5,10,2,10},
+  {6,10,3,10}, {6,10,5,10}, {7,10,6,10}, {8,10,8,11}, {5,11,0,10}, {5,11,2,11}, {6,11,3,11}, {7,11,5,11},
+  {7,11,6,11}, {8,11,7,11}, {5,12,2,12}, {6,12,3,12}, {6,12,5,12}, {7,12,6,12}, {8,12,7,12}, {8,12,8,12},
+  {5,13,3,13}, {6,13,5,13}, {7,13,6,13}, {7,13,7,13}, {8,13,8,13}, {0,14,0,12}, {0,14,0,13}, {1,14,0,11},
+  {2,14,1,13}, {3,14,1,11}, {3,14,1,12}, {4,14,2,13}, {5,14,3,14}, {5,14,4,14}, {6,14,5,14}, {7,14,6,14},
+  {8,14,7,14}, {8,14,8,14}, {0,15,0,15}, {1,15,0,14}, {1,15,1,15}, {2,15,1,14}, {3,15,2,15}, {4,15,2,14},
+  {4,15,3,15}, {5,15,4,15}, {6,15,5,15}, {6,15,6,15}, {7,15,7,15}, {8,15,8,15}, {0,16,0,16}, {0,16,0,17},
+  {1,16,0,18}, {2,16,1,16}, {2,16,1,17}, {3,16,2,16}, {4,16,3,17}, {5,16,3,16}, {5,16,4,16}, {6,16,5,16},
+  {7,16,6,16}, {7,16,7,16}, {8,16,8,16}, {0,17,0,20}, {1,17,0,19}, {1,17,0,21}, {2,17,1,18}, {3,17,2,17},
+  {3,17,1,19}, {4,17,2,18}, {5,17,3,18}, {6,17,4,17}, {6,17,5,17}, {7,17,6,17}, {8,17,7,17}, {8,17,8,17},
+  {5,18,3,19}, {6,18,5,18}, {7,18,6,18}, {7,18,7,18}, {8,18,8,18}, {5,19,2,19}, {5,19,2,20}, {6,19,5,19},
+  {7,19,6,19}, {8,19,7,19}, {8,19,8,19}, {5,20,1,20}, {6,20,3,20}, {6,20,5,20}, {7,20,7,20}, {8,20,8,20},
+  {5,21,1,21}, {5,21,2,21}, {6,21,5,21}, {7,21,6,20}, {7,21,7,21}, {8,21,8,21}, {5,22,2,22}, {6,22,3,21},
+  {6,22,5,22}, {7,22,6,21}, {8,22,7,22}, {8,22,8,22}, {5,23,1,22}, {6,23,3,22}, {7,23,6,22}, {7,23,7,23},
+  {8,23,8,23}, {5,24,1,23}, {5,24,2,23}, {6,24,5,23}, {7,24,6,23}, {8,24,7,24}, {8,24,8,24}, {5,25,2,24},
+  {6,25,3,23}, {6,25,5,24}, {7,25,6,24}, {8,25,8,25}, {5,26,3,24}, {5,26,3,25}, {6,26,5,25}, {7,26,6,25},
+  {7,26,7,25}, {8,26,8,26}, {0,27,0,22}, {1,27,0,23}, {1,27,0,24}, {2,27,1,24}, {3,27,1,25}, {3,27,2,25},
+  {4,27,2,26}, {5,27,3,26}, {6,27,5,26}, {6,27,6,27}, {7,27,6,26}, {8,27,7,26}, {8,27,8,27}, {0,28,0,25},
+  {1,28,0,26}, {2,28,1,26}, {2,28,1,27}, {3,28,2,27}, {4,28,3,27}, {4,28,3,28}, {5,28,4,27}, {6,28,5,27},
+  {7,28,6,28}, {7,28,7,28}, {8,28,7,27}, {0,29,0,28}, {0,29,0,29}, {1,29,0,27}, {2,29,1,28}, {3,29,2,28},
+  {3,29,2,29}, {4,29,3,29}, {5,29,4,28}, {5,29,5,29}, {6,29,5,28}, {7,29,7,29}, {8,29,8,28}, {8,29,8,29},
+  {0,30,0,30}, {1,30,1,29}, {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,29}, {4,30,4,30}, {5,30,5,30},
+  {6,30,6,29}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 3 <-> 9: 216 pairs, total squared travel 908
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,3,2}, {5,1,4,1}, {5,1,5,1},
+  {6,1,6,1}, {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,2}, {1,2,1,3}, {2,2,2,2}, {3,2,2,3},
+  {4,2,3,3}, {5,2,4,2}, {6,2,5,2}, {6,2,6,2}, {7,2,7,2}, {8,2,8,2}, {0,3,0,4}, {1,3,0,5},
+  {2,3,1,4}, {2,3,1,5}, {3,3,2,4}, {4,3,3,4}, {5,3,4,3}, {6,3,5,3}, {7,3,6,3}, {7,3,7,3},
+  {8,3,8,3}, {0,4,0,6}, {1,4,0,7}, {2,4,1,6}, {3,4,2,5}, {3,4,2,6}, {4,4,3,5}, {5,4,4,4},
+  {6,4,5,4}, {7,4,6,4}, {8,4,7,4}, {8,4,8,4}, {5,5,5,5}, {6,5,6,5}, {7,5,7,5}, {8,5,8,5},
+  {5,6,3,6}, {5,6,2,7}, {6,6,5,6}, {7,6,7,6}, {8,6,8,6}, {5,7,1,7}, {6,7,3,7}, {6,7,5,7},
+  {7,7,6,6}, {8,7,8,7}, {5,8,1,8}, {6,8,5,8}, {7,8,6,7}, {7,8,7,7}, {8,8,8,8}, {5,9,2,8},
+  {6,9,3,8}, {7,9,6,8}, {8,9,7,8}, {8,9,8,9}, {5,10,0,8}, {6,10,5,9}, {7,10,6,9}, {8,10,7,9},
+  {5,11,1,9}, {5,11,2,9}, {6,11,3,9}, {7,11,6,10}, {8,11,7,10}, {5,12,2,10}, {6,12,3,10}, {6,12,5,10},
+  {7,12,7,11}, {8,12,8,10}, {5,13,3,11}, {6,13,5,11}, {7,13,6,11}, {7,13,7,12}, {8,13,8,11}, {0,14,0,11},
+  {1,14,0,10}, {2,14,0,9}, {3,14,1,10}, {3,14,1,11}, {4,14,2,11}, {5,14,3,12}, {6,14,5,12}, {7,14,6,12},
+  {8,14,8,12}, {8,14,8,13}, {0,15,0,12}, {1,15,0,13}, {2,15,1,13}, {3,15,1,12}, {4,15,2,12}, {4,15,2,13},
+  {5,15,3,13}, {6,15,5,13}, {7,15,6,13}, {8,15,7,13}, {0,16,0,14}, {0,16,0,15}, {1,16,1,15}, {2,16,1,14},
+  {3,16,2,14}, {4,16,3,14}, {5,16,4,14}, {5,16,4,15}, {6,16,5,14}, {7,16,6,14}, {8,16,8,14}, {0,17,0,17},
+  {1,17,0,16}, {1,17,1,17}, {2,17,1,16}, {3,17,2,16}, {4,17,2,15}, {5,17,3,15}, {6,17,5,15}, {6,17,6,15},
+  {7,17,7,14}, {8,17,8,15}, {5,18,3,16}, {6,18,5,16}, {7,18,7,15}, {7,18,7,16}, {8,18,8,16}, {5,19,4,16},
+  {6,19,6,16}, {7,19,6,17}, {8,19,7,17}, {8,19,8,17}, {5,20,2,17}, {6,20,5,17}, {7,20,7,18}, {8,20,8,18},
+  {5,21,3,17}, {5,21,4,17}, {6,21,5,18}, {7,21,6,18}, {8,21,8,19}, {5,22,5,19}, {6,22,6,19}, {6,22,6,20},
+  {7,22,7,19}, {8,22,8,20}, {5,23,5,20}, {6,23,6,21}, {7,23,7,20}, {7,23,7,21}, {8,23,8,21}, {5,24,5,21},
+  {6,24,6,22}, {7,24,7,22}, {8,24,8,22}, {8,24,8,23}, {5,25,5,22}, {6,25,6,23}, {7,25,7,23}, {8,25,8,24},
+  {5,26,5,23}, {5,26,5,24}, {6,26,6,24}, {7,26,7,24}, {8,26,8,25}, {0,27,0,27}, {1,27,1,27}, {1,27,2,27},
+  {2,27,3,27}, {3,27,5,25}, {4,27,5,26}, {5,27,6,25}, {6,27,6,26}, {6,27,7,26}, {7,27,7,25}, {8,27,8,26},
+  {0,28,0,28}, {1,28,1,28}, {2,28,2,28}, {2,28,3,28}, {3,28,4,27}, {4,28,5,27}, {5,28,6,27}, {6,28,6,28},
+  {7,28,7,27}, {7,28,7,28}, {8,28,8,27}, {0,29,0,29}, {1,29,1,29}, {2,29,2,29}, {3,29,4,28}, {3,29,3,29},
+  {4,29,5,29}, {5,29,5,28}, {6,29,6,29}, {7,29,7,29}, {8,29,8,28}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30},
+  {2,30,2,30}, {3,30,3,30}, {4,30,4,29}, {4,30,4,30}, {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 4 <-> 5: 192 pairs, total squared travel 2352
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {5,1,4,1}, {6,1,6,1}, {7,1,7,1}, {8,1,8,1},
+  {0,2,0,2}, {1,2,0,1}, {2,2,2,2}, {3,2,3,2}, {5,2,4,2}, {6,2,5,1}, {7,2,6,2}, {8,2,8,2},
+  {0,3,0,3}, {1,3,1,3}, {2,3,1,2}, {3,3,3,3}, {5,3,4,3}, {6,3,5,2}, {7,3,6,2}, {8,3,7,2},
+  {0,4,0,4}, {1,4,1,4}, {2,4,2,4}, {3,4,2,3}, {5,4,3,4}, {6,4,5,3}, {7,4,6,3}, {8,4,8,3},
+  {0,5,0,5}, {1,5,1,5}, {2,5,1,6}, {3,5,2,5}, {5,5,3,4}, {6,5,4,4}, {7,5,5,4}, {8,5,7,3},
+  {0,6,0,6}, {1,6,1,7}, {2,6,1,7}, {3,6,2,6}, {5,6,3,5}, {6,6,3,6}, {7,6,6,4}, {8,6,8,4},
+  {0,7,0,7}, {1,7,0,8}, {2,7,1,8}, {3,7,2,8}, {5,7,2,7}, {6,7,3,8}, {7,7,3,7}, {8,7,7,4},
+  {0,8,0,9}, {1,8,0,10}, {2,8,1,9}, {3,8,2,9}, {5,8,2,10}, {6,8,3,9}, {7,8,3,10}, {8,8,8,14},
+  {0,9,0,11}, {1,9,0,11}, {2,9,1,10}, {3,9,2,11}, {5,9,3,11}, {6,9,3,12}, {7,9,6,14}, {8,9,7,14},
+  {0,10,0,12}, {1,10,1,12}, {2,10,1,11}, {3,10,2,12}, {5,10,3,13}, {6,10,5,14}, {7,10,7,15}, {8,10,8,15},
+  {0,11,0,13}, {1,11,1,13}, {2,11,2,13}, {3,11,3,14}, {5,11,4,14}, {6,11,5,15}, {7,11,6,15}, {8,11,8,16},
+  {0,12,0,14}, {1,12,1,14}, {2,12,2,14}, {3,12,3,14}, {5,12,4,15}, {6,12,5,16}, {7,12,6,16}, {8,12,7,16},
+  {0,13,0,15}, {1,13,1,15}, {2,13,2,15}, {3,13,3,15}, {5,13,4,16}, {6,13,6,17}, {7,13,7,17}, {8,13,8,17},
+  {0,14,0,16}, {1,14,1,16}, {2,14,2,16}, {3,14,3,16}, {4,14,4,17}, {5,14,5,17}, {6,14,6,17}, {7,14,7,18},
+  {8,14,8,18}, {0,15,0,16}, {1,15,1,17}, {2,15,3,17}, {3,15,5,19}, {4,15,5,18}, {5,15,6,19}, {6,15,6,18},
+  {7,15,7,19}, {8,15,8,19}, {0,16,0,17}, {1,16,2,17}, {2,16,5,21}, {3,16,5,20}, {4,16,5,21}, {5,16,6,20},
+  {6,16,7,20}, {7,16,8,20}, {8,16,8,21}, {0,17,0,27}, {1,17,0,28}, {2,17,1,27}, {3,17,5,23}, {4,17,5,22},
+  {5,17,6,21}, {6,17,7,22}, {7,17,7,21}, {8,17,8,22}, {5,18,6,22}, {6,18,6,23}, {7,18,7,23}, {8,18,8,23},
+  {5,19,5,24}, {6,19,6,24}, {7,19,7,24}, {8,19,8,24}, {5,20,5,25}, {6,20,6,25}, {7,20,7,25}, {8,20,8,24},
+  {5,21,2,27}, {6,21,5,26}, {7,21,7,26}, {8,21,8,25}, {5,22,3,27}, {6,22,5,27}, {7,22,6,26}, {8,22,8,26},
+  {5,23,1,28}, {6,23,4,27}, {7,23,6,27}, {8,23,8,27}, {5,24,2,28}, {6,24,3,28}, {7,24,6,27}, {8,24,7,27},
+  {5,25,0,29}, {6,25,4,28}, {7,25,6,28}, {8,25,8,28}, {5,26,1,29}, {6,26,3,29}, {7,26,5,28}, {8,26,7,28},
+  {5,27,2,29}, {6,27,4,29}, {7,27,6,29}, {8,27,7,29}, {5,28,0,30}, {6,28,3,29}, {7,28,5,29}, {8,28,8,29},
+  {5,29,1,30}, {6,29,4,30}, {7,29,5,30}, {8,29,7,30}, {5,30,2,30}, {6,30,3,30}, {7,30,6,30}, {8,30,8,30},
+  // 4 <-> 6: 216 pairs, total squared travel 4171
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {5,1,4,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,3}, {0,2,1,3}, {1,2,1,2}, {2,2,2,2}, {3,2,3,2}, {5,2,4,2}, {6,2,5,1},
+  {7,2,6,2}, {8,2,8,2}, {0,3,0,4}, {0,3,1,4}, {1,3,2,3}, {2,3,2,4}, {3,3,3,3}, {5,3,4,3},
+  {6,3,5,2}, {7,3,7,3}, {8,3,7,2}, {0,4,0,5}, {0,4,0,6}, {1,4,1,5}, {2,4,2,5}, {3,4,3,4},
+  {5,4,4,4}, {6,4,5,3}, {7,4,6,3}, {8,4,8,3}, {0,5,0,7}, {0,5,1,7}, {1,5,1,6}, {2,5,2,6},
+  {3,5,3,5}, {5,5,3,6}, {6,5,5,4}, {7,5,6,4}, {8,5,8,4}, {0,6,0,8}, {0,6,0,9}, {1,6,1,8},
+  {2,6,2,7}, {3,6,2,8}, {5,6,3,8}, {6,6,3,7}, {7,6,3,9}, {8,6,7,4}, {0,7,1,9}, {0,7,0,10},
+  {1,7,1,10}, {2,7,2,9}, {3,7,2,10}, {5,7,3,10}, {6,7,3,11}, {7,7,6,14}, {8,7,8,14}, {0,8,0,11},
+  {0,8,1,12}, {1,8,1,11}, {2,8,2,11}, {3,8,2,12}, {5,8,3,12}, {6,8,3,13}, {7,8,5,14}, {8,8,7,14},
+  {0,9,0,12}, {0,9,0,13}, {1,9,1,13}, {2,9,2,13}, {3,9,2,14}, {5,9,3,14}, {6,9,4,14}, {7,9,6,15},
+  {8,9,8,15}, {0,10,0,14}, {0,10,0,15}, {1,10,1,14}, {2,10,2,15}, {3,10,3,15}, {5,10,4,15}, {6,10,5,15},
+  {7,10,7,15}, {8,10,7,16}, {0,11,1,15}, {0,11,0,16}, {1,11,1,16}, {2,11,2,16}, {3,11,3,16}, {5,11,4,16},
+  {6,11,5,16}, {7,11,6,16}, {8,11,8,16}, {0,12,0,17}, {0,12,0,18}, {1,12,1,17}, {2,12,2,17}, {3,12,3,17},
+  {5,12,4,17}, {6,12,5,17}, {7,12,6,17}, {8,12,8,17}, {0,13,0,19}, {0,13,1,19}, {1,13,1,18}, {2,13,2,18},
+  {3,13,3,18}, {5,13,5,18}, {6,13,6,18}, {7,13,7,17}, {8,13,8,18}, {0,14,0,20}, {0,14,0,21}, {1,14,1,20},
+  {2,14,2,19}, {3,14,2,20}, {4,14,3,19}, {5,14,5,19}, {6,14,6,19}, {7,14,7,19}, {8,14,7,18}, {8,14,8,19},
+  {0,15,0,22}, {1,15,1,21}, {2,15,2,21}, {3,15,3,20}, {4,15,3,21}, {5,15,5,20}, {6,15,6,20}, {7,15,7,20},
+  {7,15,7,21}, {8,15,8,20}, {0,16,0,23}, {1,16,1,23}, {2,16,1,22}, {3,16,2,22}, {4,16,3,22}, {5,16,5,21},
+  {6,16,6,21}, {6,16,6,22}, {7,16,7,22}, {8,16,8,21}, {0,17,0,24}, {1,17,0,25}, {2,17,1,25}, {3,17,1,24},
+  {4,17,2,23}, {5,17,5,22}, {5,17,3,23}, {6,17,6,23}, {7,17,7,23}, {8,17,8,22}, {5,18,2,24}, {6,18,5,23},
+  {7,18,7,24}, {8,18,8,23}, {5,19,3,24}, {5,19,3,25}, {6,19,5,24}, {7,19,6,24}, {8,19,8,24}, {5,20,2,25},
+  {6,20,5,25}, {7,20,6,25}, {8,20,8,25}, {5,21,0,26}, {5,21,2,26}, {6,21,5,26}, {7,21,6,26}, {8,21,7,25},
+  {5,22,1,26}, {6,22,3,26}, {7,22,7,26}, {8,22,8,26}, {5,23,0,27}, {5,23,1,27}, {6,23,4,27}, {7,23,6,27},
+  {8,23,8,27}, {5,24,2,27}, {6,24,3,27}, {7,24,5,27}, {8,24,7,27}, {5,25,0,28}, {5,25,2,28}, {6,25,3,28},
+  {7,25,6,28}, {8,25,8,28}, {5,26,1,28}, {6,26,4,28}, {7,26,5,28}, {8,26,7,28}, {5,27,0,29}, {5,27,2,29},
+  {6,27,4,29}, {7,27,6,29}, {8,27,8,29}, {5,28,1,29}, {6,28,3,29}, {7,28,5,29}, {8,28,7,29}, {5,29,0,30},
+  {5,29,2,30}, {6,29,3,30}, {7,29,6,30}, {8,29,8,30}, {5,30,1,30}, {6,30,4,30}, {7,30,5,30}, {8,30,7,30},
+  // 4 <-> 7: 192 pairs, total squared travel 1293
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,4,1}, {5,1,5,1}, {6,1,6,1}, {7,1,8,1}, {8,1,8,1},
+  {0,2,0,1}, {1,2,2,1}, {2,2,3,1}, {3,2,4,2}, {5,2,5,1}, {6,2,7,1}, {7,2,7,2}, {8,2,8,2},
+  {0,3,0,2}, {1,3,1,2}, {2,3,3,2}, {3,3,4,2}, {5,3,5,2}, {6,3,6,2}, {7,3,7,2}, {8,3,8,3},
+  {0,4,1,2}, {1,4,2,2}, {2,4,3,3}, {3,4,5,3}, {5,4,6,3}, {6,4,6,3}, {7,4,7,3}, {8,4,8,3},
+  {0,5,0,3}, {1,5,2,3}, {2,5,4,3}, {3,5,5,4}, {5,5,6,4}, {6,5,7,4}, {7,5,8,4}, {8,5,8,4},
+  {0,6,0,3}, {1,6,3,3}, {2,6,4,4}, {3,6,5,4}, {5,6,6,5}, {6,6,6,5}, {7,6,7,5}, {8,6,8,5},
+  {0,7,1,3}, {1,7,2,4}, {2,7,3,4}, {3,7,5,5}, {5,7,6,6}, {6,7,7,6}, {7,7,8,6}, {8,7,8,6},
+  {0,8,0,4}, {1,8,2,4}, {2,8,5,6}, {3,8,5,6}, {5,8,6,7}, {6,8,7,7}, {7,8,8,8}, {8,8,8,7},
+  {0,9,1,4}, {1,9,5,7}, {2,9,5,8}, {3,9,6,8}, {5,9,6,7}, {6,9,7,8}, {7,9,8,8}, {8,9,8,9},
+  {0,10,5,8}, {1,10,5,9}, {2,10,6,9}, {3,10,6,10}, {5,10,6,9}, {6,10,7,9}, {7,10,8,10}, {8,10,8,10},
+  {0,11,5,10}, {1,11,5,10}, {2,11,6,11}, {3,11,6,11}, {5,11,7,11}, {6,11,7,10}, {7,11,8,12}, {8,11,8,11},
+  {0,12,5,12}, {1,12,5,12}, {2,12,5,11}, {3,12,6,12}, {5,12,7,12}, {6,12,7,13}, {7,12,8,13}, {8,12,8,12},
+  {0,13,5,13}, {1,13,5,14}, {2,13,5,14}, {3,13,6,13}, {5,13,7,13}, {6,13,7,14}, {7,13,8,14}, {8,13,8,14},
+  {0,14,5,15}, {1,14,5,16}, {2,14,6,16}, {3,14,6,15}, {4,14,6,14}, {5,14,7,15}, {6,14,7,15}, {7,14,8,16},
+  {8,14,8,15}, {0,15,5,18}, {1,15,5,16}, {2,15,5,17}, {3,15,6,17}, {4,15,7,17}, {5,15,7,17}, {6,15,7,16},
+  {7,15,8,17}, {8,15,8,16}, {0,16,5,19}, {1,16,5,18}, {2,16,5,20}, {3,16,6,18}, {4,16,6,19}, {5,16,7,18},
+  {6,16,7,19}, {7,16,8,18}, {8,16,8,18}, {0,17,5,22}, {1,17,5,20}, {2,17,5,21}, {3,17,6,20}, {4,17,6,21},
+  {5,17,7,20}, {6,17,7,19}, {7,17,8,19}, {8,17,8,20}, {5,18,6,22}, {6,18,7,21}, {7,18,7,21}, {8,18,8,20},
+  {5,19,6,22}, {6,19,7,22}, {7,19,8,22}, {8,19,8,21}, {5,20,5,23}, {6,20,6,23}, {7,20,7,23}, {8,20,8,22},
+  {5,21,5,24}, {6,21,6,24}, {7,21,7,23}, {8,21,8,23}, {5,22,6,24}, {6,22,7,24}, {7,22,8,24}, {8,22,8,24},
+  {5,23,5,25}, {6,23,6,25}, {7,23,7,25}, {8,23,8,25}, {5,24,5,26}, {6,24,6,26}, {7,24,7,25}, {8,24,8,26},
+  {5,25,5,27}, {6,25,6,26}, {7,25,7,26}, {8,25,8,26}, {5,26,6,27}, {6,26,7,27}, {7,26,7,27}, {8,26,8,27},
+  {5,27,5,28}, {6,27,6,28}, {7,27,7,28}, {8,27,8,28}, {5,28,5,29}, {6,28,6,28}, {7,28,7,29}, {8,28,8,28},
+  {5,29,5,30}, {6,29,6,29}, {7,29,7,29}, {8,29,8,29}, {5,30,6,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 4 <-> 8: 252 pairs, total squared travel 2475
+  {0,1,0,1}, {0,1,1,1}, {1,1,2,1}, {2,1,3,2}, {3,1,3,1}, {3,1,4,1}, {5,1,5,1}, {6,1,6,1},
+  {7,1,7,1}, {7,1,7,2}, {8,1,8,1}, {0,2,0,2}, {1,2,1,2}, {1,2,2,2}, {2,2,3,3}, {3,2,4,2},
+  {5,2,5,2}, {5,2,5,3}, {6,2,6,2}, {7,2,7,3}, {8,2,8,2}, {0,3,0,3}, {0,3,1,4}, {1,3,1,3},
+  {2,3,2,3}, {3,3,4,3}, {3,3,4,4}, {5,3,5,4}, {6,3,6,3}, {7,3,7,4}, {7,3,8,4}, {8,3,8,3},
+  {0,4,0,4}, {1,4,1,5}, {1,4,2,5}, {2,4,2,4}, {3,4,3,4}, {5,4,5,5}, {5,4,6,5}, {6,4,6,4},
+  {7,4,7,5}, {8,4,8,5}, {0,5,0,5}, {0,5,0,6}, {1,5,1,6}, {2,5,2,6}, {3,5,3,5}, {3,5,3,6},
+  {5,5,5,6}, {6,5,6,6}, {7,5,7,6}, {7,5,7,7}, {8,5,8,6}, {0,6,0,7}, {1,6,1,7}, {1,6,2,8},
+  {2,6,2,7}, {3,6,3,7}, {5,6,5,7}, {5,6,6,7}, {6,6,6,8}, {7,6,7,8}, {8,6,8,7}, {0,7,0,8},
+  {0,7,0,9}, {1,7,1,8}, {2,7,2,9}, {3,7,3,8}, {3,7,3,9}, {5,7,5,8}, {6,7,6,9}, {7,7,7,9},
+  {7,7,8,9}, {8,7,8,8}, {0,8,0,10}, {1,8,1,9}, {1,8,1,10}, {2,8,2,10}, {3,8,3,10}, {5,8,5,9},
+  {5,8,5,10}, {6,8,6,10}, {7,8,7,10}, {8,8,8,10}, {0,9,0,11}, {0,9,1,11}, {1,9,1,12}, {2,9,2,11},
+  {3,9,3,11}, {3,9,3,12}, {5,9,5,11}, {6,9,6,11}, {7,9,7,11}, {7,9,7,12}, {8,9,8,11}, {0,10,0,12},
+  {1,10,1,13}, {1,10,2,13}, {2,10,2,12}, {3,10,3,13}, {5,10,5,12}, {5,10,5,13}, {6,10,6,12}, {7,10,7,13},
+  {8,10,8,12}, {0,11,0,13}, {0,11,0,14}, {1,11,1,14}, {2,11,2,14}, {3,11,3,14}, {3,11,4,14}, {5,11,5,14},
+  {6,11,6,13}, {7,11,6,14}, {7,11,7,14}, {8,11,8,13}, {0,12,0,15}, {1,12,1,15}, {1,12,1,16}, {2,12,2,15},
+  {3,12,3,15}, {5,12,4,15}, {5,12,5,15}, {6,12,6,15}, {7,12,7,15}, {8,12,8,14}, {0,13,0,16}, {0,13,0,17},
+  {1,13,1,17}, {2,13,2,16}, {3,13,3,16}, {3,13,2,17}, {5,13,4,16}, {6,13,5,16}, {7,13,6,16}, {7,13,7,16},
+  {8,13,8,15}, {0,14,0,18}, {1,14,1,18}, {1,14,0,19}, {2,14,2,18}, {3,14,3,17}, {4,14,4,17}, {4,14,3,18},
+  {5,14,5,17}, {6,14,6,17}, {7,14,7,17}, {8,14,8,16}, {8,14,8,17}, {0,15,0,20}, {1,15,1,19}, {2,15,2,19},
+  {2,15,1,20}, {3,15,2,20}, {4,15,3,19}, {5,15,5,18}, {5,15,5,19}, {6,15,6,18}, {7,15,7,18}, {8,15,8,18},
+  {8,15,8,19}, {0,16,0,21}, {1,16,0,22}, {2,16,1,21}, {2,16,1,22}, {3,16,2,21}, {4,16,3,20}, {5,16,5,20},
+  {6,16,6,19}, {6,16,6,20}, {7,16,7,19}, {8,16,8,20}, {0,17,0,23}, {0,17,0,24}, {1,17,0,25}, {2,17,1,23},
+  {3,17,2,23}, {3,17,1,24}, {4,17,2,22}, {5,17,3,21}, {6,17,5,21}, {6,17,6,21}, {7,17,7,20}, {8,17,8,21},
+  {5,18,3,22}, {5,18,5,22}, {6,18,6,22}, {7,18,7,21}, {8,18,8,22}, {5,19,3,23}, {5,19,3,24}, {6,19,5,23},
+  {7,19,7,22}, {8,19,7,23}, {8,19,8,23}, {5,20,2,24}, {6,20,5,24}, {7,20,6,23}, {7,20,7,24}, {8,20,8,24},
+  {5,21,1,25}, {6,21,3,25}, {6,21,5,25}, {7,21,6,24}, {8,21,8,25}, {5,22,0,26}, {5,22,1,26}, {6,22,2,25},
+  {7,22,6,25}, {8,22,7,25}, {5,23,2,26}, {5,23,0,27}, {6,23,3,26}, {7,23,6,26}, {8,23,7,26}, {8,23,8,26},
+  {5,24,1,27}, {6,24,4,27}, {7,24,5,26}, {7,24,6,27}, {8,24,8,27}, {5,25,2,27}, {6,25,3,27}, {6,25,3,28},
+  {7,25,5,27}, {8,25,7,27}, {5,26,0,28}, {5,26,2,28}, {6,26,4,28}, {7,26,6,28}, {8,26,7,28}, {5,27,1,28},
+  {5,27,0,29}, {6,27,3,29}, {7,27,5,28}, {8,27,8,28}, {8,27,8,29}, {5,28,1,29}, {6,28,4,29}, {7,28,5,29},
+  {7,28,6,29}, {8,28,7,29}, {5,29,0,30}, {6,29,2,29}, {6,29,4,30}, {7,29,6,30}, {8,29,8,30}, {5,30,1,30},
+  {5,30,2,30}, {6,30,3,30}, {7,30,5,30}, {8,30,7,30},
+  // 4 <-> 9: 216 pairs, total squared travel 1079
+  {0,1,0,1}, {0,1,1,1}, {1,1,2,1}, {2,1,3,1}, {3,1,4,1}, {5,1,5,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {0,2,1,2}, {1,2,2,2}, {2,2,3,2}, {3,2,4,2}, {5,2,5,2}, {6,2,6,2},
+  {7,2,7,2}, {8,2,8,2}, {0,3,0,3}, {0,3,1,3}, {1,3,2,3}, {2,3,3,3}, {3,3,4,3}, {5,3,5,3},
+  {6,3,6,3}, {7,3,7,3}, {8,3,8,3}, {0,4,0,4}, {0,4,1,4}, {1,4,2,4}, {2,4,3,4}, {3,4,4,4},
+  {5,4,5,4}, {6,4,6,4}, {7,4,7,4}, {8,4,8,4}, {0,5,0,5}, {0,5,1,5}, {1,5,2,5}, {2,5,3,5},
+  {3,5,5,5}, {5,5,6,5}, {6,5,7,5}, {7,5,8,6}, {8,5,8,5}, {0,6,0,6}, {0,6,1,6}, {1,6,2,6},
+  {2,6,3,6}, {3,6,5,6}, {5,6,6,6}, {6,6,7,6}, {7,6,7,7}, {8,6,8,7}, {0,7,0,7}, {0,7,1,7},
+  {1,7,2,7}, {2,7,3,7}, {3,7,5,7}, {5,7,6,7}, {6,7,6,8}, {7,7,7,8}, {8,7,8,8}, {0,8,0,8},
+  {0,8,1,8}, {1,8,2,8}, {2,8,3,8}, {3,8,5,8}, {5,8,5,9}, {6,8,6,9}, {7,8,7,9}, {8,8,8,9},
+  {0,9,0,9}, {0,9,1,9}, {1,9,2,9}, {2,9,2,10}, {3,9,3,9}, {5,9,5,10}, {6,9,6,10}, {7,9,7,10},
+  {8,9,8,10}, {0,10,0,10}, {0,10,1,11}, {1,10,1,10}, {2,10,2,11}, {3,10,3,10}, {5,10,5,11}, {6,10,6,11},
+  {7,10,7,11}, {8,10,8,11}, {0,11,0,11}, {0,11,0,12}, {1,11,1,12}, {2,11,2,12}, {3,11,3,11}, {5,11,5,12},
+  {6,11,6,12}, {7,11,7,12}, {8,11,8,12}, {0,12,0,13}, {0,12,1,13}, {1,12,2,13}, {2,12,3,13}, {3,12,3,12},
+  {5,12,5,13}, {6,12,6,13}, {7,12,7,13}, {8,12,8,13}, {0,13,0,14}, {0,13,1,14}, {1,13,2,14}, {2,13,3,14},
+  {3,13,4,14}, {5,13,5,14}, {6,13,6,14}, {7,13,7,14}, {8,13,8,14}, {0,14,0,15}, {0,14,1,15}, {1,14,2,15},
+  {2,14,3,15}, {3,14,4,15}, {4,14,5,16}, {5,14,5,15}, {6,14,6,15}, {7,14,7,15}, {8,14,8,15}, {8,14,8,16},
+  {0,15,0,16}, {1,15,1,16}, {2,15,3,16}, {3,15,4,16}, {4,15,5,17}, {5,15,6,17}, {6,15,6,16}, {7,15,7,16},
+  {7,15,7,17}, {8,15,8,17}, {0,16,0,17}, {1,16,2,16}, {2,16,3,17}, {3,16,4,17}, {4,16,5,18}, {5,16,6,18},
+  {6,16,7,18}, {6,16,6,19}, {7,16,8,19}, {8,16,8,18}, {0,17,0,27}, {1,17,1,17}, {2,17,2,17}, {3,17,5,20},
+  {4,17,5,21}, {5,17,5,19}, {5,17,6,20}, {6,17,7,20}, {7,17,7,19}, {8,17,8,20}, {5,18,5,22}, {6,18,6,21},
+  {7,18,7,21}, {8,18,8,21}, {5,19,6,22}, {5,19,5,23}, {6,19,6,23}, {7,19,7,22}, {8,19,8,22}, {5,20,5,24},
+  {6,20,6,24}, {7,20,7,23}, {8,20,8,23}, {5,21,5,25}, {5,21,5,26}, {6,21,6,25}, {7,21,7,24}, {8,21,8,24},
+  {5,22,3,27}, {6,22,6,26}, {7,22,7,25}, {8,22,8,25}, {5,23,1,27}, {5,23,2,27}, {6,23,4,27}, {7,23,7,26},
+  {8,23,8,26}, {5,24,1,28}, {6,24,5,27}, {7,24,6,27}, {8,24,8,27}, {5,25,2,28}, {5,25,3,28}, {6,25,5,28},
+  {7,25,7,27}, {8,25,8,28}, {5,26,0,28}, {6,26,4,28}, {7,26,6,28}, {8,26,7,28}, {5,27,0,29}, {5,27,2,29},
+  {6,27,4,29}, {7,27,6,29}, {8,27,8,29}, {5,28,1,29}, {6,28,3,29}, {7,28,5,29}, {8,28,7,29}, {5,29,0,30},
+  {5,29,2,30}, {6,29,3,30}, {7,29,6,30}, {8,29,8,30}, {5,30,1,30}, {6,30,4,30}, {7,30,5,30}, {8,30,7,30},
+  // 5 <-> 6: 216 pairs, total squared travel 929
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,4,2}, {5,1,4,1}, {5,1,5,1},
+  {6,1,6,1}, {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {1,2,1,2}, {1,2,1,3}, {2,2,2,2}, {3,2,3,2},
+  {4,2,3,3}, {5,2,4,3}, {6,2,5,2}, {6,2,6,2}, {7,2,7,2}, {8,2,8,2}, {0,3,0,4}, {1,3,1,4},
+  {2,3,2,3}, {2,3,1,5}, {3,3,2,4}, {4,3,3,4}, {5,3,4,4}, {6,3,5,3}, {7,3,6,3}, {7,3,7,3},
+  {8,3,8,3}, {0,4,0,5}, {1,4,1,6}, {2,4,2,5}, {3,4,2,6}, {3,4,3,6}, {4,4,3,5}, {5,4,3,7},
+  {6,4,5,4}, {7,4,6,4}, {8,4,7,4}, {8,4,8,4}, {0,5,0,6}, {1,5,1,7}, {2,5,2,7}, {3,5,3,8},
+  {0,6,0,7}, {0,6,0,8}, {1,6,1,8}, {2,6,2,8}, {3,6,3,9}, {0,7,0,9}, {1,7,1,9}, {1,7,1,10},
+  {2,7,2,9}, {3,7,3,10}, {0,8,0,10}, {1,8,1,11}, {2,8,2,10}, {2,8,2,11}, {3,8,3,11}, {0,9,0,11},
+  {1,9,1,12}, {2,9,2,12}, {3,9,3,12}, {3,9,3,13}, {0,10,0,12}, {1,10,1,13}, {2,10,2,13}, {3,10,6,14},
+  {0,11,0,13}, {0,11,0,14}, {1,11,1,14}, {2,11,3,14}, {3,11,5,14}, {0,12,0,15}, {1,12,1,15}, {1,12,2,15},
+  {2,12,2,14}, {3,12,4,14}, {0,13,0,16}, {1,13,1,16}, {2,13,3,15}, {2,13,2,16}, {3,13,4,15}, {0,14,0,17},
+  {1,14,1,17}, {2,14,2,17}, {3,14,3,16}, {3,14,4,16}, {4,14,5,15}, {5,14,6,15}, {6,14,7,14}, {7,14,7,15},
+  {8,14,8,14}, {8,14,8,15}, {0,15,0,18}, {1,15,1,18}, {2,15,2,18}, {3,15,3,17}, {4,15,4,17}, {4,15,3,18},
+  {5,15,5,16}, {6,15,6,16}, {7,15,7,16}, {8,15,8,16}, {0,16,0,19}, {0,16,0,20}, {1,16,1,19}, {2,16,1,20},
+  {3,16,2,19}, {4,16,3,19}, {5,16,5,17}, {5,16,5,18}, {6,16,6,17}, {7,16,7,17}, {8,16,8,17}, {0,17,0,21},
+  {1,17,0,22}, {1,17,1,22}, {2,17,1,21}, {3,17,2,21}, {4,17,2,20}, {5,17,5,19}, {6,17,6,18}, {6,17,6,19},
+  {7,17,7,18}, {8,17,8,18}, {5,18,3,20}, {6,18,6,20}, {7,18,7,19}, {7,18,7,20}, {8,18,8,19}, {5,19,3,21},
+  {6,19,5,20}, {7,19,7,21}, {8,19,8,20}, {8,19,8,21}, {5,20,2,22}, {6,20,5,21}, {7,20,6,21}, {8,20,8,22},
+  {5,21,3,22}, {5,21,2,23}, {6,21,5,22}, {7,21,6,22}, {8,21,7,22}, {5,22,1,23}, {6,22,3,23}, {6,22,5,23},
+  {7,22,7,23}, {8,22,8,23}, {5,23,1,24}, {6,23,5,24}, {7,23,6,23}, {7,23,7,24}, {8,23,8,24}, {5,24,2,24},
+  {6,24,3,24}, {7,24,6,24}, {8,24,7,25}, {8,24,8,25}, {5,25,3,25}, {6,25,5,25}, {7,25,6,25}, {8,25,8,26},
+  {5,26,2,25}, {5,26,3,26}, {6,26,5,26}, {7,26,6,26}, {8,26,7,26}, {0,27,0,25}, {1,27,0,23}, {1,27,0,24},
+  {2,27,1,25}, {3,27,2,26}, {4,27,3,27}, {5,27,4,27}, {6,27,5,27}, {6,27,6,27}, {7,27,7,27}, {8,27,8,27},
+  {0,28,0,26}, {1,28,0,27}, {2,28,1,26}, {2,28,1,27}, {3,28,2,27}, {4,28,3,28}, {5,28,4,28}, {6,28,5,28},
+  {7,28,6,28}, {7,28,7,28}, {8,28,8,28}, {0,29,0,29}, {1,29,0,28}, {2,29,1,28}, {3,29,2,28}, {3,29,2,29},
+  {4,29,3,29}, {5,29,4,29}, {6,29,5,29}, {7,29,6,29}, {8,29,7,29}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30},
+  {2,30,1,29}, {3,30,2,30}, {4,30,3,30}, {4,30,4,30}, {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 5 <-> 7: 180 pairs, total squared travel 2118
+  {0,1,0,1}, {1,1,1,1}, {2,1,3,1}, {3,1,4,1}, {4,1,5,1}, {5,1,6,1}, {6,1,7,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,1}, {1,2,2,1}, {2,2,3,1}, {3,2,4,2}, {4,2,5,2}, {5,2,6,2}, {6,2,7,2},
+  {7,2,8,2}, {8,2,8,2}, {0,3,0,2}, {1,3,1,2}, {2,3,3,2}, {3,3,5,2}, {4,3,6,3}, {5,3,6,3},
+  {6,3,7,3}, {7,3,8,4}, {8,3,8,3}, {0,4,1,2}, {1,4,2,2}, {2,4,3,3}, {3,4,5,3}, {4,4,6,4},
+  {5,4,7,4}, {6,4,7,5}, {7,4,8,4}, {8,4,8,5}, {0,5,0,3}, {1,5,2,3}, {2,5,4,3}, {3,5,5,4},
+  {0,6,1,3}, {1,6,3,3}, {2,6,4,4}, {3,6,6,5}, {0,7,0,4}, {1,7,3,4}, {2,7,4,4}, {3,7,7,5},
+  {0,8,1,4}, {1,8,2,4}, {2,8,5,5}, {3,8,7,6}, {0,9,1,4}, {1,9,5,6}, {2,9,6,6}, {3,9,7,6},
+  {0,10,5,7}, {1,10,6,7}, {2,10,6,7}, {3,10,8,6}, {0,11,5,8}, {1,11,6,8}, {2,11,7,7}, {3,11,8,7},
+  {0,12,5,9}, {1,12,6,8}, {2,12,6,9}, {3,12,7,8}, {0,13,5,9}, {1,13,5,10}, {2,13,6,10}, {3,13,7,9},
+  {0,14,5,10}, {1,14,5,11}, {2,14,6,11}, {3,14,7,10}, {4,14,7,11}, {5,14,8,8}, {6,14,8,10}, {7,14,8,9},
+  {8,14,8,10}, {0,15,5,13}, {1,15,5,12}, {2,15,6,12}, {3,15,6,13}, {4,15,7,12}, {5,15,7,12}, {6,15,7,13},
+  {7,15,8,11}, {8,15,8,11}, {0,16,5,16}, {1,16,5,15}, {2,16,5,14}, {3,16,6,14}, {4,16,6,14}, {5,16,7,13},
+  {6,16,7,14}, {7,16,8,13}, {8,16,8,12}, {0,17,5,17}, {1,17,5,17}, {2,17,5,16}, {3,17,6,16}, {4,17,6,15},
+  {5,17,6,15}, {6,17,7,15}, {7,17,8,15}, {8,17,8,14}, {5,18,6,17}, {6,18,7,16}, {7,18,8,16}, {8,18,8,17},
+  {5,19,6,18}, {6,19,7,17}, {7,19,8,17}, {8,19,8,18}, {5,20,5,18}, {6,20,7,19}, {7,20,7,18}, {8,20,8,18},
+  {5,21,5,19}, {6,21,6,19}, {7,21,7,19}, {8,21,8,19}, {5,22,5,20}, {6,22,6,20}, {7,22,7,20}, {8,22,8,20},
+  {5,23,5,21}, {6,23,7,20}, {7,23,7,21}, {8,23,8,21}, {5,24,6,21}, {6,24,6,21}, {7,24,7,22}, {8,24,8,22},
+  {5,25,6,22}, {6,25,6,22}, {7,25,7,23}, {8,25,8,23}, {5,26,6,23}, {6,26,7,24}, {7,26,8,24}, {8,26,8,24},
+  {0,27,5,22}, {1,27,5,23}, {2,27,5,24}, {3,27,5,23}, {4,27,6,24}, {5,27,6,25}, {6,27,7,25}, {7,27,8,25},
+  {8,27,8,25}, {0,28,5,26}, {1,28,5,24}, {2,28,5,25}, {3,28,6,26}, {4,28,6,27}, {5,28,7,27}, {6,28,7,26},
+  {7,28,7,26}, {8,28,8,26}, {0,29,5,29}, {1,29,5,28}, {2,29,5,27}, {3,29,6,28}, {4,29,6,28}, {5,29,7,28},
+  {6,29,7,27}, {7,29,8,28}, {8,29,8,27}, {0,30,5,30}, {1,30,5,30}, {2,30,6,30}, {3,30,6,29}, {4,30,6,29},
+  {5,30,7,30}, {6,30,7,29}, {7,30,8,30}, {8,30,8,29},
+  // 5 <-> 8: 252 pairs, total squared travel 835
+  {0,1,0,1}, {0,1,1,1}, {1,1,2,1}, {2,1,3,1}, {2,1,2,2}, {3,1,4,1}, {4,1,5,1}, {5,1,6,1},
+  {5,1,6,2}, {6,1,7,1}, {7,1,7,2}, {7,1,8,2}, {8,1,8,1}, {0,2,0,2}, {1,2,1,2}, {1,2,1,3},
+  {2,2,3,2}, {3,2,4,2}, {3,2,4,3}, {4,2,5,3}, {5,2,5,2}, {6,2,6,3}, {6,2,7,4}, {7,2,7,3},
+  {8,2,8,3}, {8,2,8,4}, {0,3,0,3}, {1,3,2,3}, {2,3,3,3}, {2,3,2,4}, {3,3,4,4}, {4,3,5,4},
+  {4,3,5,5}, {5,3,6,4}, {6,3,7,6}, {7,3,7,5}, {7,3,8,5}, {8,3,8,6}, {0,4,0,4}, {0,4,0,5},
+  {1,4,1,4}, {2,4,2,5}, {3,4,3,4}, {3,4,3,5}, {4,4,6,6}, {5,4,6,5}, {5,4,6,7}, {6,4,7,7},
+  {7,4,8,8}, {8,4,8,7}, {8,4,8,9}, {0,5,0,6}, {1,5,1,5}, {1,5,1,6}, {2,5,3,6}, {3,5,5,6},
+  {0,6,0,7}, {0,6,1,7}, {1,6,2,7}, {2,6,2,6}, {2,6,3,7}, {3,6,5,7}, {0,7,0,8}, {1,7,1,8},
+  {1,7,2,8}, {2,7,3,8}, {3,7,6,8}, {3,7,7,8}, {0,8,0,9}, {1,8,2,9}, {2,8,5,8}, {2,8,5,9},
+  {3,8,6,9}, {0,9,1,9}, {0,9,0,10}, {1,9,2,10}, {2,9,3,9}, {3,9,7,9}, {3,9,6,10}, {0,10,1,10},
+  {1,10,1,11}, {1,10,2,11}, {2,10,3,10}, {3,10,7,10}, {0,11,0,11}, {0,11,0,12}, {1,11,2,12}, {2,11,3,11},
+  {2,11,3,12}, {3,11,5,10}, {0,12,0,13}, {1,12,1,12}, {1,12,1,13}, {2,12,3,13}, {3,12,5,11}, {3,12,6,11},
+  {0,13,0,14}, {1,13,1,14}, {2,13,2,13}, {2,13,2,14}, {3,13,5,12}, {0,14,0,15}, {0,14,0,16}, {1,14,1,15},
+  {2,14,2,15}, {3,14,3,14}, {3,14,4,14}, {4,14,5,13}, {5,14,6,12}, {5,14,6,13}, {6,14,7,11}, {7,14,8,10},
+  {8,14,8,11}, {8,14,8,12}, {0,15,0,17}, {1,15,1,16}, {1,15,1,17}, {2,15,2,16}, {3,15,3,15}, {4,15,5,14},
+  {4,15,4,15}, {5,15,6,14}, {6,15,7,13}, {6,15,7,14}, {7,15,7,12}, {8,15,8,13}, {0,16,0,18}, {0,16,0,19},
+  {1,16,1,18}, {2,16,2,17}, {2,16,2,18}, {3,16,3,16}, {4,16,4,16}, {5,16,5,15}, {5,16,5,16}, {6,16,6,15},
+  {7,16,7,15}, {7,16,7,16}, {8,16,8,14}, {0,17,0,21}, {1,17,0,20}, {1,17,1,20}, {2,17,1,19}, {3,17,3,17},
+  {3,17,2,19}, {4,17,3,18}, {5,17,4,17}, {6,17,6,16}, {6,17,6,17}, {7,17,7,17}, {8,17,8,15}, {8,17,8,16},
+  {5,18,5,17}, {6,18,5,18}, {7,18,6,18}, {7,18,7,18}, {8,18,8,17}, {5,19,3,19}, {5,19,3,20}, {6,19,5,19},
+  {7,19,6,19}, {8,19,8,18}, {8,19,8,19}, {5,20,2,20}, {6,20,5,20}, {6,20,6,20}, {7,20,7,19}, {8,20,8,20},
+  {5,21,1,21}, {5,21,2,21}, {6,21,5,21}, {7,21,7,20}, {7,21,7,21}, {8,21,8,21}, {5,22,2,22}, {6,22,3,21},
+  {6,22,5,22}, {7,22,6,21}, {8,22,7,22}, {8,22,8,22}, {5,23,1,22}, {6,23,3,22}, {7,23,6,22}, {7,23,7,23},
+  {8,23,8,23}, {5,24,1,23}, {5,24,2,23}, {6,24,5,23}, {7,24,6,23}, {8,24,7,24}, {8,24,8,24}, {5,25,2,24},
+  {6,25,3,23}, {6,25,5,24}, {7,25,6,24}, {8,25,8,25}, {5,26,3,24}, {5,26,3,25}, {6,26,5,25}, {7,26,6,25},
+  {7,26,7,25}, {8,26,8,26}, {0,27,0,24}, {1,27,0,22}, {1,27,0,23}, {2,27,1,24}, {3,27,1,25}, {3,27,2,25},
+  {4,27,2,26}, {5,27,3,26}, {6,27,5,26}, {6,27,6,27}, {7,27,6,26}, {8,27,7,26}, {8,27,8,27}, {0,28,0,25},
+  {1,28,0,26}, {2,28,1,26}, {2,28,1,27}, {3,28,2,27}, {4,28,3,27}, {4,28,3,28}, {5,28,4,27}, {6,28,5,27},
+  {7,28,6,28}, {7,28,7,28}, {8,28,7,27}, {0,29,0,28}, {0,29,0,29}, {1,29,0,27}, {2,29,1,28}, {3,29,2,28},
+  {3,29,2,29}, {4,29,3,29}, {5,29,4,28}, {5,29,5,29}, {6,29,5,28}, {7,29,7,29}, {8,29,8,28}, {8,29,8,29},
+  {0,30,0,30}, {1,30,1,29}, {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,29}, {4,30,4,30}, {5,30,5,30},
+  {6,30,6,29}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 5 <-> 9: 216 pairs, total squared travel 859
+  {0,1,0,1}, {0,1,1,1}, {1,1,2,1}, {2,1,3,1}, {3,1,4,1}, {4,1,5,1}, {5,1,6,1}, {5,1,6,2},
+  {6,1,7,2}, {7,1,7,1}, {8,1,8,1}, {0,2,0,2}, {1,2,1,2}, {1,2,2,2}, {2,2,3,2}, {3,2,4,2},
+  {4,2,5,2}, {5,2,5,3}, {6,2,6,3}, {6,2,7,3}, {7,2,8,3}, {8,2,8,2}, {0,3,0,3}, {1,3,1,3},
+  {2,3,2,3}, {2,3,3,3}, {3,3,4,3}, {4,3,5,4}, {5,3,6,4}, {6,3,7,4}, {7,3,7,5}, {7,3,8,5},
+  {8,3,8,4}, {0,4,0,4}, {1,4,1,4}, {2,4,2,4}, {3,4,3,4}, {3,4,4,4}, {4,4,6,5}, {5,4,6,6},
+  {6,4,7,6}, {7,4,7,7}, {8,4,8,6}, {8,4,8,7}, {0,5,0,5}, {1,5,2,5}, {2,5,3,5}, {3,5,5,5},
+  {0,6,1,5}, {0,6,0,6}, {1,6,2,6}, {2,6,3,6}, {3,6,5,6}, {0,7,1,6}, {1,7,1,7}, {1,7,2,7},
+  {2,7,3,7}, {3,7,6,7}, {0,8,0,7}, {1,8,2,8}, {2,8,5,7}, {2,8,5,8}, {3,8,6,8}, {0,9,0,8},
+  {1,9,1,8}, {2,9,3,8}, {3,9,7,8}, {3,9,8,8}, {0,10,0,9}, {1,10,1,9}, {2,10,2,9}, {3,10,5,9},
+  {0,11,0,10}, {0,11,1,10}, {1,11,2,10}, {2,11,3,9}, {3,11,6,9}, {0,12,0,11}, {1,12,1,11}, {1,12,2,11},
+  {2,12,3,10}, {3,12,5,10}, {0,13,0,12}, {1,13,1,12}, {2,13,3,11}, {2,13,2,12}, {3,13,5,11}, {0,14,0,13},
+  {1,14,1,13}, {2,14,2,13}, {3,14,3,12}, {3,14,3,13}, {4,14,6,10}, {5,14,6,11}, {6,14,7,10}, {7,14,7,9},
+  {8,14,8,9}, {8,14,8,10}, {0,15,0,14}, {1,15,1,14}, {2,15,2,14}, {3,15,3,14}, {4,15,5,12}, {4,15,5,13},
+  {5,15,6,12}, {6,15,7,11}, {7,15,8,11}, {8,15,8,12}, {0,16,0,15}, {0,16,0,16}, {1,16,1,15}, {2,16,2,15},
+  {3,16,3,15}, {4,16,4,14}, {5,16,6,13}, {5,16,5,14}, {6,16,7,12}, {7,16,7,13}, {8,16,8,13}, {0,17,0,17},
+  {1,17,1,16}, {1,17,1,17}, {2,17,2,16}, {3,17,2,17}, {4,17,4,15}, {5,17,5,15}, {6,17,6,14}, {6,17,6,15},
+  {7,17,7,14}, {8,17,8,14}, {5,18,4,16}, {6,18,5,16}, {7,18,7,15}, {7,18,7,16}, {8,18,8,15}, {5,19,3,16},
+  {6,19,6,16}, {7,19,7,17}, {8,19,8,16}, {8,19,8,17}, {5,20,3,17}, {6,20,5,17}, {7,20,6,17}, {8,20,8,18},
+  {5,21,4,17}, {5,21,5,18}, {6,21,6,18}, {7,21,7,18}, {8,21,8,19}, {5,22,5,19}, {6,22,6,19}, {6,22,6,20},
+  {7,22,7,19}, {8,22,8,20}, {5,23,5,20}, {6,23,6,21}, {7,23,7,20}, {7,23,7,21}, {8,23,8,21}, {5,24,5,21},
+  {6,24,6,22}, {7,24,7,22}, {8,24,8,22}, {8,24,8,23}, {5,25,5,22}, {6,25,6,23}, {7,25,7,23}, {8,25,8,24},
+  {5,26,5,23}, {5,26,5,24}, {6,26,6,24}, {7,26,7,24}, {8,26,8,25}, {0,27,0,27}, {1,27,1,27}, {1,27,2,27},
+  {2,27,3,27}, {3,27,5,25}, {4,27,5,26}, {5,27,6,25}, {6,27,6,26}, {6,27,7,26}, {7,27,7,25}, {8,27,8,26},
+  {0,28,0,28}, {1,28,1,28}, {2,28,2,28}, {2,28,3,28}, {3,28,4,27}, {4,28,5,27}, {5,28,6,27}, {6,28,6,28},
+  {7,28,7,27}, {7,28,7,28}, {8,28,8,27}, {0,29,0,29}, {1,29,1,29}, {2,29,2,29}, {3,29,4,28}, {3,29,3,29},
+  {4,29,5,29}, {5,29,5,28}, {6,29,6,29}, {7,29,7,29}, {8,29,8,28}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30},
+  {2,30,2,30}, {3,30,3,30}, {4,30,4,29}, {4,30,4,30}, {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 6 <-> 7: 216 pairs, total squared travel 4460
+  {0,1,0,1}, {1,1,2,1}, {2,1,3,1}, {3,1,5,1}, {4,1,5,1}, {5,1,6,1}, {6,1,7,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,1}, {1,2,1,1}, {2,2,3,1}, {3,2,4,1}, {4,2,5,2}, {5,2,6,2}, {6,2,7,2},
+  {7,2,7,2}, {8,2,8,2}, {0,3,1,1}, {1,3,1,2}, {2,3,3,2}, {3,3,4,2}, {4,3,5,2}, {5,3,6,3},
+  {6,3,7,3}, {7,3,7,3}, {8,3,8,3}, {0,4,0,2}, {1,4,2,2}, {2,4,3,2}, {3,4,4,3}, {4,4,5,3},
+  {5,4,7,4}, {6,4,8,5}, {7,4,8,4}, {8,4,8,4}, {0,5,0,2}, {1,5,2,2}, {2,5,3,3}, {3,5,5,3},
+  {0,6,0,3}, {1,6,2,3}, {2,6,4,3}, {3,6,5,4}, {0,7,1,3}, {1,7,2,3}, {2,7,4,4}, {3,7,6,4},
+  {0,8,0,3}, {1,8,2,4}, {2,8,4,4}, {3,8,6,4}, {0,9,0,4}, {1,9,3,4}, {2,9,5,5}, {3,9,7,5},
+  {0,10,0,4}, {1,10,5,5}, {2,10,6,5}, {3,10,7,5}, {0,11,2,4}, {1,11,5,6}, {2,11,6,6}, {3,11,7,6},
+  {0,12,1,4}, {1,12,5,6}, {2,12,7,6}, {3,12,8,6}, {0,13,5,7}, {1,13,5,7}, {2,13,6,7}, {3,13,7,7},
+  {0,14,5,8}, {1,14,6,8}, {2,14,6,9}, {3,14,6,8}, {4,14,7,7}, {5,14,7,8}, {6,14,8,8}, {7,14,8,7},
+  {8,14,8,7}, {0,15,5,9}, {1,15,5,10}, {2,15,6,10}, {3,15,6,9}, {4,15,7,10}, {5,15,7,9}, {6,15,8,8},
+  {7,15,8,9}, {8,15,8,9}, {0,16,5,11}, {1,16,5,11}, {2,16,6,10}, {3,16,6,11}, {4,16,7,11}, {5,16,7,11},
+  {6,16,7,10}, {7,16,8,11}, {8,16,8,10}, {0,17,5,12}, {1,17,5,12}, {2,17,6,13}, {3,17,6,12}, {4,17,7,12},
+  {5,17,7,12}, {6,17,8,12}, {7,17,8,13}, {8,17,8,13}, {0,18,5,13}, {1,18,5,13}, {2,18,6,14}, {3,18,6,14},
+  {5,18,7,13}, {6,18,7,13}, {7,18,8,14}, {8,18,8,14}, {0,19,5,14}, {1,19,5,15}, {2,19,6,15}, {3,19,6,15},
+  {5,19,7,14}, {6,19,7,15}, {7,19,8,15}, {8,19,8,15}, {0,20,5,17}, {1,20,5,16}, {2,20,6,16}, {3,20,6,16},
+  {5,20,7,16}, {6,20,7,17}, {7,20,7,16}, {8,20,8,16}, {0,21,5,18}, {1,21,5,17}, {2,21,6,17}, {3,21,6,18},
+  {5,21,7,17}, {6,21,7,18}, {7,21,8,18}, {8,21,8,17}, {0,22,5,19}, {1,22,5,18}, {2,22,6,19}, {3,22,6,19},
+  {5,22,7,18}, {6,22,7,19}, {7,22,8,19}, {8,22,8,19}, {0,23,5,20}, {1,23,5,19}, {2,23,6,20}, {3,23,6,20},
+  {5,23,7,20}, {6,23,7,21}, {7,23,8,20}, {8,23,8,20}, {0,24,5,22}, {1,24,5,21}, {2,24,6,21}, {3,24,6,21},
+  {5,24,7,22}, {6,24,7,22}, {7,24,8,21}, {8,24,8,21}, {0,25,5,23}, {1,25,5,23}, {2,25,6,22}, {3,25,6,22},
+  {5,25,7,23}, {6,25,7,23}, {7,25,8,22}, {8,25,8,23}, {0,26,5,24}, {1,26,5,24}, {2,26,6,24}, {3,26,6,23},
+  {5,26,7,24}, {6,26,7,24}, {7,26,8,24}, {8,26,8,25}, {0,27,5,25}, {1,27,5,25}, {2,27,6,26}, {3,27,6,25},
+  {4,27,6,25}, {5,27,7,25}, {6,27,8,25}, {7,27,8,26}, {8,27,8,26}, {0,28,5,27}, {1,28,5,26}, {2,28,6,26},
+  {3,28,6,27}, {4,28,6,27}, {5,28,7,27}, {6,28,7,26}, {7,28,8,27}, {8,28,8,27}, {0,29,5,29}, {1,29,5,28},
+  {2,29,5,28}, {3,29,6,28}, {4,29,6,29}, {5,29,7,29}, {6,29,7,28}, {7,29,7,28}, {8,29,8,28}, {0,30,5,30},
+  {1,30,5,30}, {2,30,5,29}, {3,30,6,30}, {4,30,7,30}, {5,30,7,30}, {6,30,7,29}, {7,30,8,30}, {8,30,8,29},
+  // 6 <-> 8: 252 pairs, total squared travel 872
+  {0,1,0,1}, {0,1,1,1}, {1,1,2,1}, {2,1,3,1}, {3,1,4,1}, {4,1,5,1}, {5,1,6,1}, {6,1,7,1},
+  {6,1,7,2}, {7,1,8,2}, {8,1,8,1}, {0,2,0,2}, {1,2,1,2}, {2,2,2,2}, {3,2,3,2}, {3,2,4,2},
+  {4,2,5,2}, {5,2,6,2}, {6,2,6,3}, {7,2,7,3}, {8,2,8,3}, {0,3,0,3}, {0,3,1,3}, {1,3,2,3},
+  {2,3,3,3}, {3,3,4,3}, {4,3,5,3}, {5,3,6,4}, {6,3,7,4}, {6,3,7,5}, {7,3,8,5}, {8,3,8,4},
+  {0,4,0,4}, {1,4,2,4}, {2,4,3,4}, {3,4,4,4}, {3,4,5,4}, {4,4,6,5}, {5,4,6,6}, {6,4,7,6},
+  {7,4,8,7}, {8,4,8,6}, {0,5,1,4}, {0,5,1,5}, {1,5,2,5}, {2,5,3,5}, {3,5,5,5}, {0,6,0,5},
+  {1,6,1,6}, {2,6,3,6}, {2,6,5,6}, {3,6,7,7}, {0,7,0,6}, {1,7,2,6}, {2,7,3,7}, {3,7,6,7},
+  {0,8,0,7}, {0,8,1,7}, {1,8,2,7}, {2,8,5,7}, {3,8,6,8}, {0,9,0,8}, {1,9,1,8}, {2,9,3,8},
+  {2,9,5,8}, {3,9,7,8}, {0,10,0,9}, {1,10,2,8}, {2,10,3,9}, {3,10,8,8}, {0,11,1,9}, {0,11,1,10},
+  {1,11,2,9}, {2,11,5,9}, {3,11,7,9}, {0,12,0,10}, {1,12,2,11}, {2,12,2,10}, {2,12,3,10}, {3,12,6,9},
+  {0,13,0,11}, {1,13,1,11}, {2,13,3,11}, {3,13,5,10}, {0,14,0,12}, {0,14,1,12}, {1,14,2,12}, {2,14,3,12},
+  {3,14,5,11}, {4,14,6,10}, {5,14,6,11}, {6,14,7,10}, {6,14,7,11}, {7,14,8,9}, {8,14,8,10}, {0,15,0,13},
+  {1,15,1,13}, {2,15,2,13}, {3,15,5,12}, {3,15,3,13}, {4,15,5,13}, {5,15,6,12}, {6,15,7,12}, {7,15,8,12},
+  {8,15,8,11}, {0,16,0,14}, {0,16,1,14}, {1,16,2,14}, {2,16,3,14}, {3,16,4,14}, {4,16,5,14}, {5,16,6,14},
+  {6,16,6,13}, {6,16,7,13}, {7,16,8,13}, {8,16,8,14}, {0,17,0,15}, {1,17,1,15}, {2,17,2,15}, {3,17,3,15},
+  {3,17,4,16}, {4,17,4,15}, {5,17,5,15}, {6,17,6,15}, {7,17,7,14}, {8,17,8,15}, {0,18,0,16}, {0,18,1,16},
+  {1,18,2,16}, {2,18,3,16}, {3,18,4,17}, {5,18,5,16}, {6,18,6,16}, {7,18,7,15}, {7,18,7,16}, {8,18,8,16},
+  {0,19,0,17}, {1,19,1,17}, {2,19,2,17}, {3,19,3,17}, {5,19,5,17}, {5,19,6,17}, {6,19,6,18}, {7,19,7,17},
+  {8,19,8,17}, {0,20,0,18}, {1,20,1,18}, {2,20,2,18}, {2,20,3,18}, {3,20,3,19}, {5,20,5,18}, {6,20,6,19},
+  {7,20,7,18}, {8,20,8,18}, {0,21,0,19}, {0,21,1,19}, {1,21,1,20}, {2,21,2,19}, {3,21,3,20}, {5,21,5,19},
+  {6,21,6,20}, {7,21,7,19}, {7,21,7,20}, {8,21,8,19}, {0,22,0,20}, {1,22,1,21}, {2,22,2,20}, {3,22,3,21},
+  {5,22,5,20}, {5,22,5,21}, {6,22,6,21}, {7,22,7,21}, {8,22,8,20}, {0,23,0,21}, {1,23,1,22}, {2,23,2,21},
+  {2,23,2,22}, {3,23,3,22}, {5,23,5,22}, {6,23,6,22}, {7,23,7,22}, {8,23,8,21}, {0,24,0,22}, {0,24,0,23},
+  {1,24,1,23}, {2,24,2,23}, {3,24,3,23}, {5,24,5,23}, {6,24,6,23}, {7,24,7,23}, {7,24,8,23}, {8,24,8,22},
+  {0,25,0,24}, {1,25,1,24}, {2,25,2,24}, {3,25,3,24}, {5,25,5,24}, {5,25,6,24}, {6,25,7,24}, {7,25,8,24},
+  {8,25,8,25}, {0,26,0,25}, {1,26,1,25}, {2,26,2,25}, {2,26,2,26}, {3,26,3,25}, {5,26,5,25}, {6,26,6,25},
+  {7,26,7,25}, {8,26,8,26}, {0,27,0,26}, {0,27,0,27}, {1,27,1,26}, {2,27,2,27}, {3,27,3,26}, {4,27,5,26},
+  {5,27,5,27}, {6,27,6,26}, {6,27,6,27}, {7,27,7,26}, {8,27,8,27}, {0,28,0,28}, {1,28,1,27}, {2,28,2,28},
+  {3,28,3,27}, {3,28,4,27}, {4,28,4,28}, {5,28,5,28}, {6,28,6,28}, {7,28,7,27}, {8,28,8,28}, {0,29,0,29},
+  {0,29,1,29}, {1,29,1,28}, {2,29,2,29}, {3,29,3,28}, {4,29,4,29}, {5,29,5,29}, {6,29,6,29}, {6,29,7,29},
+  {7,29,7,28}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30}, {2,30,2,30}, {3,30,3,29}, {3,30,3,30}, {4,30,4,30},
+  {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 6 <-> 9: 216 pairs, total squared travel 2236
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,4,1}, {5,1,5,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,2,2}, {2,2,3,2}, {3,2,4,2}, {4,2,5,2}, {5,2,6,2}, {6,2,7,3},
+  {7,2,7,2}, {8,2,8,2}, {0,3,1,2}, {1,3,2,3}, {2,3,3,3}, {3,3,4,3}, {4,3,5,3}, {5,3,6,3},
+  {6,3,7,4}, {7,3,8,4}, {8,3,8,3}, {0,4,0,3}, {1,4,1,3}, {2,4,3,4}, {3,4,4,4}, {4,4,6,4},
+  {5,4,6,5}, {6,4,7,5}, {7,4,8,6}, {8,4,8,5}, {0,5,0,4}, {1,5,1,4}, {2,5,2,4}, {3,5,5,4},
+  {0,6,0,5}, {1,6,1,5}, {2,6,3,5}, {3,6,5,5}, {0,7,0,6}, {1,7,2,5}, {2,7,3,6}, {3,7,6,6},
+  {0,8,1,6}, {1,8,2,6}, {2,8,5,6}, {3,8,7,6}, {0,9,0,7}, {1,9,2,7}, {2,9,3,7}, {3,9,6,7},
+  {0,10,1,7}, {1,10,2,8}, {2,10,5,7}, {3,10,7,7}, {0,11,0,8}, {1,11,1,8}, {2,11,3,8}, {3,11,5,8},
+  {0,12,0,9}, {1,12,2,9}, {2,12,3,9}, {3,12,6,8}, {0,13,1,9}, {1,13,2,10}, {2,13,3,10}, {3,13,5,9},
+  {0,14,0,10}, {1,14,1,10}, {2,14,2,11}, {3,14,5,10}, {4,14,6,9}, {5,14,7,8}, {6,14,7,9}, {7,14,8,7},
+  {8,14,8,8}, {0,15,0,11}, {1,15,1,11}, {2,15,3,11}, {3,15,5,11}, {4,15,6,10}, {5,15,6,11}, {6,15,7,10},
+  {7,15,8,9}, {8,15,8,10}, {0,16,0,12}, {1,16,1,12}, {2,16,2,12}, {3,16,3,12}, {4,16,5,12}, {5,16,6,12},
+  {6,16,7,12}, {7,16,7,11}, {8,16,8,11}, {0,17,0,13}, {1,17,1,13}, {2,17,2,13}, {3,17,3,13}, {4,17,5,13},
+  {5,17,6,13}, {6,17,7,13}, {7,17,8,13}, {8,17,8,12}, {0,18,0,14}, {1,18,2,14}, {2,18,3,14}, {3,18,4,14},
+  {5,18,5,14}, {6,18,6,14}, {7,18,7,14}, {8,18,8,14}, {0,19,1,14}, {1,19,2,15}, {2,19,3,15}, {3,19,4,15},
+  {5,19,5,15}, {6,19,6,15}, {7,19,7,15}, {8,19,8,15}, {0,20,0,15}, {1,20,1,15}, {2,20,3,16}, {3,20,5,16},
+  {5,20,6,17}, {6,20,6,16}, {7,20,7,16}, {8,20,8,16}, {0,21,0,16}, {1,21,2,16}, {2,21,4,16}, {3,21,5,17},
+  {5,21,6,18}, {6,21,7,18}, {7,21,7,17}, {8,21,8,17}, {0,22,1,16}, {1,22,2,17}, {2,22,4,17}, {3,22,5,18},
+  {5,22,6,19}, {6,22,7,19}, {7,22,8,19}, {8,22,8,18}, {0,23,1,17}, {1,23,3,17}, {2,23,5,20}, {3,23,5,19},
+  {5,23,6,20}, {6,23,7,20}, {7,23,8,20}, {8,23,8,21}, {0,24,0,17}, {1,24,5,22}, {2,24,5,21}, {3,24,6,22},
+  {5,24,6,21}, {6,24,7,21}, {7,24,7,22}, {8,24,8,22}, {0,25,1,27}, {1,25,5,24}, {2,25,5,23}, {3,25,6,23},
+  {5,25,6,24}, {6,25,7,23}, {7,25,8,23}, {8,25,8,24}, {0,26,0,27}, {1,26,2,27}, {2,26,4,27}, {3,26,5,25},
+  {5,26,6,25}, {6,26,7,25}, {7,26,7,24}, {8,26,8,25}, {0,27,0,28}, {1,27,2,28}, {2,27,3,27}, {3,27,5,27},
+  {4,27,5,26}, {5,27,6,26}, {6,27,7,27}, {7,27,7,26}, {8,27,8,26}, {0,28,1,28}, {1,28,2,29}, {2,28,3,28},
+  {3,28,4,28}, {4,28,5,28}, {5,28,6,27}, {6,28,7,28}, {7,28,8,28}, {8,28,8,27}, {0,29,0,29}, {1,29,1,29},
+  {2,29,3,29}, {3,29,4,29}, {4,29,5,29}, {5,29,6,29}, {6,29,6,28}, {7,29,7,29}, {8,29,8,29}, {0,30,0,30},
+  {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,30}, {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+  // 7 <-> 8: 252 pairs, total squared travel 2801
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {1,1,1,2}, {2,1,2,1}, {2,1,2,2}, {3,1,3,1}, {3,1,3,2},
+  {4,1,4,1}, {5,1,4,2}, {5,1,5,2}, {6,1,5,1}, {6,1,6,1}, {7,1,7,1}, {7,1,6,2}, {8,1,8,1},
+  {8,1,8,2}, {0,2,0,3}, {1,2,0,4}, {1,2,1,4}, {2,2,1,3}, {2,2,1,5}, {3,2,2,3}, {3,2,2,4},
+  {4,2,3,3}, {4,2,3,4}, {5,2,4,3}, {6,2,5,3}, {6,2,5,4}, {7,2,6,3}, {7,2,7,3}, {8,2,7,2},
+  {8,2,8,3}, {0,3,0,5}, {0,3,0,6}, {1,3,0,7}, {2,3,1,6}, {2,3,1,7}, {3,3,2,5}, {3,3,2,6},
+  {4,3,3,5}, {4,3,3,6}, {5,3,4,4}, {5,3,5,5}, {6,3,6,5}, {7,3,6,4}, {7,3,7,4}, {8,3,8,4},
+  {8,3,8,5}, {0,4,0,8}, {0,4,0,9}, {1,4,0,10}, {1,4,0,11}, {2,4,1,8}, {3,4,1,9}, {3,4,1,10},
+  {4,4,2,7}, {4,4,2,8}, {5,4,3,7}, {5,4,3,8}, {6,4,5,6}, {6,4,6,6}, {7,4,7,6}, {8,4,7,5},
+  {8,4,8,6}, {5,5,2,9}, {5,5,3,9}, {6,5,5,7}, {6,5,6,7}, {7,5,7,7}, {7,5,7,8}, {8,5,8,7},
+  {5,6,2,10}, {5,6,2,11}, {6,6,5,8}, {6,6,5,9}, {7,6,6,8}, {7,6,6,9}, {8,6,8,8}, {8,6,8,9},
+  {5,7,1,11}, {6,7,3,10}, {6,7,5,10}, {7,7,6,10}, {7,7,7,10}, {8,7,7,9}, {8,7,8,10}, {5,8,0,12},
+  {5,8,1,12}, {6,8,3,11}, {7,8,5,11}, {7,8,6,11}, {8,8,7,11}, {8,8,8,11}, {5,9,2,12}, {5,9,0,13},
+  {6,9,3,12}, {6,9,5,12}, {7,9,6,12}, {8,9,7,12}, {8,9,8,12}, {5,10,1,13}, {5,10,0,14}, {6,10,2,13},
+  {6,10,3,13}, {7,10,5,13}, {7,10,6,13}, {8,10,7,13}, {5,11,1,14}, {5,11,2,14}, {6,11,3,14}, {6,11,4,14},
+  {7,11,5,14}, {7,11,6,14}, {8,11,8,13}, {8,11,8,14}, {5,12,0,15}, {6,12,3,15}, {6,12,4,15}, {7,12,5,15},
+  {7,12,6,15}, {8,12,7,14}, {8,12,8,15}, {5,13,1,15}, {5,13,0,16}, {6,13,2,15}, {7,13,5,16}, {7,13,6,16},
+  {8,13,7,15}, {8,13,8,16}, {5,14,1,16}, {5,14,0,17}, {6,14,2,16}, {6,14,3,16}, {7,14,4,16}, {8,14,7,16},
+  {8,14,8,17}, {5,15,1,17}, {5,15,2,17}, {6,15,3,17}, {6,15,4,17}, {7,15,5,17}, {7,15,6,17}, {8,15,7,17},
+  {5,16,0,18}, {5,16,1,18}, {6,16,2,18}, {6,16,3,18}, {7,16,5,18}, {7,16,6,18}, {8,16,7,18}, {8,16,8,18},
+  {5,17,1,19}, {6,17,2,19}, {6,17,3,19}, {7,17,5,19}, {7,17,6,19}, {8,17,7,19}, {8,17,8,19}, {5,18,0,19},
+  {5,18,0,20}, {6,18,3,20}, {7,18,5,20}, {7,18,6,20}, {8,18,7,20}, {8,18,8,20}, {5,19,1,20}, {5,19,1,21},
+  {6,19,2,20}, {6,19,3,21}, {7,19,6,21}, {8,19,7,21}, {8,19,8,21}, {5,20,0,21}, {5,20,1,22}, {6,20,2,21},
+  {6,20,3,22}, {7,20,5,21}, {7,20,6,22}, {8,20,8,22}, {5,21,0,22}, {5,21,0,23}, {6,21,2,22}, {6,21,2,23},
+  {7,21,5,22}, {7,21,6,23}, {8,21,7,22}, {8,21,8,23}, {5,22,1,23}, {6,22,3,23}, {6,22,2,24}, {7,22,5,23},
+  {7,22,5,24}, {8,22,7,23}, {8,22,8,24}, {5,23,0,24}, {5,23,1,24}, {6,23,3,24}, {7,23,6,24}, {7,23,5,25},
+  {8,23,7,24}, {8,23,8,25}, {5,24,0,25}, {5,24,1,25}, {6,24,2,25}, {6,24,3,25}, {7,24,6,25}, {8,24,7,25},
+  {8,24,8,26}, {5,25,0,26}, {5,25,1,26}, {6,25,2,26}, {6,25,3,26}, {7,25,5,26}, {7,25,6,26}, {8,25,7,26},
+  {5,26,0,27}, {5,26,1,27}, {6,26,2,27}, {6,26,3,27}, {7,26,4,27}, {7,26,5,27}, {8,26,7,27}, {8,26,8,27},
+  {5,27,0,28}, {6,27,2,28}, {6,27,3,28}, {7,27,4,28}, {7,27,6,28}, {8,27,6,27}, {8,27,8,28}, {5,28,1,28},
+  {5,28,0,29}, {6,28,2,29}, {7,28,5,28}, {7,28,6,29}, {8,28,7,28}, {8,28,8,29}, {5,29,1,29}, {5,29,0,30},
+  {6,29,3,29}, {6,29,4,29}, {7,29,5,29}, {8,29,7,29}, {8,29,8,30}, {5,30,1,30}, {5,30,2,30}, {6,30,3,30},
+  {6,30,4,30}, {7,30,5,30}, {7,30,6,30}, {8,30,7,30},
+  // 7 <-> 9: 216 pairs, total squared travel 1350
+  {0,1,0,1}, {0,1,0,2}, {1,1,1,1}, {1,1,1,2}, {2,1,2,1}, {3,1,3,1}, {3,1,2,2}, {4,1,3,2},
+  {5,1,4,1}, {5,1,5,2}, {6,1,5,1}, {7,1,6,1}, {7,1,7,1}, {8,1,8,1}, {0,2,0,3}, {0,2,0,4},
+  {1,2,1,3}, {2,2,2,3}, {2,2,1,4}, {3,2,3,3}, {3,2,2,4}, {4,2,4,2}, {5,2,4,3}, {5,2,5,3},
+  {6,2,6,3}, {7,2,6,2}, {7,2,7,2}, {8,2,8,2}, {0,3,0,5}, {0,3,0,6}, {1,3,0,7}, {2,3,1,5},
+  {2,3,1,6}, {3,3,2,5}, {4,3,3,4}, {4,3,3,5}, {5,3,4,4}, {5,3,5,4}, {6,3,6,4}, {7,3,7,3},
+  {7,3,7,4}, {8,3,8,3}, {0,4,0,8}, {0,4,0,10}, {1,4,0,9}, {2,4,1,7}, {2,4,1,8}, {3,4,2,6},
+  {4,4,3,6}, {4,4,2,7}, {5,4,5,5}, {6,4,6,5}, {6,4,5,6}, {7,4,7,5}, {8,4,8,4}, {8,4,8,5},
+  {5,5,3,7}, {5,5,2,8}, {6,5,5,7}, {7,5,6,6}, {7,5,7,6}, {8,5,8,6}, {5,6,3,8}, {5,6,3,9},
+  {6,6,5,8}, {7,6,6,7}, {7,6,7,7}, {8,6,8,7}, {5,7,1,9}, {5,7,2,9}, {6,7,5,9}, {7,7,6,8},
+  {7,7,7,8}, {8,7,8,8}, {8,7,8,9}, {5,8,1,10}, {6,8,3,10}, {6,8,5,10}, {7,8,6,9}, {8,8,7,9},
+  {8,8,8,10}, {5,9,1,11}, {6,9,2,10}, {6,9,2,11}, {7,9,6,10}, {8,9,7,10}, {8,9,8,11}, {5,10,0,11},
+  {6,10,3,11}, {6,10,2,12}, {7,10,5,11}, {7,10,6,11}, {8,10,7,11}, {5,11,0,12}, {5,11,1,12}, {6,11,3,12},
+  {7,11,5,12}, {7,11,6,12}, {8,11,8,12}, {5,12,0,13}, {5,12,1,13}, {6,12,3,13}, {7,12,5,13}, {7,12,6,13},
+  {8,12,7,12}, {5,13,0,14}, {5,13,2,14}, {6,13,2,13}, {7,13,5,14}, {7,13,6,14}, {8,13,7,13}, {8,13,8,13},
+  {5,14,1,14}, {6,14,3,14}, {6,14,4,14}, {7,14,6,15}, {8,14,7,14}, {8,14,8,14}, {5,15,0,15}, {6,15,3,15},
+  {6,15,4,15}, {7,15,5,15}, {8,15,7,15}, {8,15,8,15}, {5,16,1,15}, {6,16,2,15}, {6,16,4,16}, {7,16,5,16},
+  {7,16,6,16}, {8,16,7,16}, {5,17,1,16}, {5,17,2,16}, {6,17,3,16}, {7,17,6,17}, {7,17,7,17}, {8,17,8,16},
+  {5,18,0,16}, {5,18,2,17}, {6,18,4,17}, {7,18,5,17}, {7,18,7,18}, {8,18,8,17}, {5,19,0,17}, {5,19,1,17},
+  {6,19,5,18}, {6,19,5,19}, {7,19,6,18}, {8,19,8,18}, {8,19,8,19}, {5,20,3,17}, {6,20,6,19}, {6,20,6,20},
+  {7,20,7,20}, {8,20,7,19}, {8,20,8,20}, {5,21,5,21}, {6,21,5,20}, {6,21,6,21}, {7,21,7,21}, {8,21,8,21},
+  {8,21,8,22}, {5,22,5,22}, {6,22,6,22}, {6,22,6,23}, {7,22,7,22}, {7,22,7,23}, {8,22,8,23}, {5,23,5,24},
+  {5,23,5,25}, {6,23,5,23}, {7,23,6,24}, {7,23,7,24}, {8,23,8,24}, {5,24,1,27}, {5,24,2,27}, {6,24,5,26},
+  {7,24,6,25}, {7,24,7,25}, {8,24,8,25}, {5,25,0,27}, {5,25,3,27}, {6,25,4,27}, {6,25,5,27}, {7,25,6,26},
+  {8,25,7,26}, {8,25,8,26}, {5,26,0,28}, {6,26,2,28}, {6,26,4,28}, {7,26,6,27}, {8,26,7,27}, {8,26,8,27},
+  {5,27,1,28}, {6,27,3,28}, {6,27,3,29}, {7,27,6,28}, {8,27,7,28}, {8,27,8,28}, {5,28,0,29}, {5,28,2,29},
+  {6,28,4,29}, {7,28,5,28}, {7,28,6,29}, {8,28,8,29}, {5,29,1,29}, {5,29,0,30}, {6,29,3,30}, {7,29,5,29},
+  {7,29,7,30}, {8,29,7,29}, {5,30,1,30}, {5,30,2,30}, {6,30,4,30}, {7,30,5,30}, {7,30,6,30}, {8,30,8,30},
+  // 8 <-> 9: 252 pairs, total squared travel 864
+  {0,1,0,1}, {1,1,1,1}, {2,1,2,1}, {3,1,3,1}, {4,1,4,1}, {5,1,5,1}, {6,1,6,1}, {7,1,7,1},
+  {8,1,8,1}, {0,2,0,2}, {1,2,0,1}, {2,2,2,2}, {3,2,3,2}, {4,2,4,2}, {5,2,5,2}, {6,2,6,2},
+  {7,2,6,1}, {8,2,8,2}, {0,3,0,3}, {1,3,1,3}, {2,3,1,2}, {3,3,3,3}, {4,3,3,2}, {5,3,5,3},
+  {6,3,6,3}, {7,3,7,3}, {8,3,7,2}, {0,4,0,4}, {1,4,0,3}, {2,4,2,3}, {3,4,3,4}, {4,4,4,3},
+  {5,4,5,4}, {6,4,6,3}, {7,4,7,4}, {8,4,8,3}, {0,5,0,5}, {1,5,1,4}, {2,5,2,4}, {3,5,3,4},
+  {5,5,4,4}, {6,5,6,4}, {7,5,7,5}, {8,5,8,4}, {0,6,0,5}, {1,6,1,5}, {2,6,2,5}, {3,6,3,5},
+  {5,6,5,5}, {6,6,6,5}, {7,6,7,5}, {8,6,8,5}, {0,7,0,6}, {1,7,1,6}, {2,7,2,6}, {3,7,3,6},
+  {5,7,5,6}, {6,7,6,6}, {7,7,7,6}, {8,7,8,6}, {0,8,0,7}, {1,8,1,7}, {2,8,2,7}, {3,8,3,7},
+  {5,8,5,6}, {6,8,6,7}, {7,8,7,7}, {8,8,8,7}, {0,9,0,8}, {1,9,1,8}, {2,9,2,7}, {3,9,3,8},
+  {5,9,5,7}, {6,9,6,8}, {7,9,7,8}, {8,9,7,8}, {0,10,0,8}, {1,10,1,9}, {2,10,2,8}, {3,10,3,9},
+  {5,10,5,8}, {6,10,6,9}, {7,10,7,9}, {8,10,8,8}, {0,11,0,10}, {1,11,0,9}, {2,11,2,9}, {3,11,3,10},
+  {5,11,5,9}, {6,11,5,9}, {7,11,7,10}, {8,11,8,9}, {0,12,0,11}, {1,12,1,10}, {2,12,2,10}, {3,12,2,10},
+  {5,12,5,10}, {6,12,6,10}, {7,12,7,11}, {8,12,8,10}, {0,13,0,11}, {1,13,1,11}, {2,13,2,11}, {3,13,3,11},
+  {5,13,5,11}, {6,13,6,11}, {7,13,7,11}, {8,13,8,11}, {0,14,0,12}, {1,14,1,12}, {2,14,2,12}, {3,14,3,12},
+  {4,14,5,12}, {5,14,5,12}, {6,14,6,12}, {7,14,7,12}, {8,14,8,12}, {0,15,0,13}, {1,15,1,13}, {2,15,2,13},
+  {3,15,3,13}, {4,15,5,13}, {5,15,6,13}, {6,15,6,14}, {7,15,7,13}, {8,15,8,13}, {0,16,0,14}, {1,16,2,13},
+  {2,16,2,14}, {3,16,3,14}, {4,16,4,14}, {5,16,5,14}, {6,16,6,14}, {7,16,7,14}, {8,16,8,14}, {0,17,0,14},
+  {1,17,1,14}, {2,17,3,15}, {3,17,3,15}, {4,17,5,15}, {5,17,6,15}, {6,17,6,16}, {7,17,7,15}, {8,17,8,15},
+  {0,18,0,15}, {1,18,1,15}, {2,18,2,15}, {3,18,4,15}, {5,18,5,16}, {6,18,6,16}, {7,18,7,16}, {8,18,8,16},
+  {0,19,0,16}, {1,19,1,16}, {2,19,3,16}, {3,19,4,16}, {5,19,5,17}, {6,19,6,17}, {7,19,7,17}, {8,19,8,17},
+  {0,20,0,16}, {1,20,2,16}, {2,20,3,17}, {3,20,4,17}, {5,20,6,18}, {6,20,7,19}, {7,20,7,18}, {8,20,8,18},
+  {0,21,0,17}, {1,21,2,17}, {2,21,5,18}, {3,21,5,18}, {5,21,6,19}, {6,21,7,19}, {7,21,7,20}, {8,21,8,19},
+  {0,22,1,17}, {1,22,3,17}, {2,22,5,20}, {3,22,5,19}, {5,22,6,20}, {6,22,7,21}, {7,22,8,21}, {8,22,8,20},
+  {0,23,5,21}, {1,23,5,21}, {2,23,5,22}, {3,23,6,21}, {5,23,6,22}, {6,23,7,22}, {7,23,7,22}, {8,23,8,22},
+  {0,24,0,27}, {1,24,5,23}, {2,24,5,24}, {3,24,5,24}, {5,24,6,24}, {6,24,6,23}, {7,24,7,23}, {8,24,8,23},
+  {0,25,0,27}, {1,25,2,27}, {2,25,4,27}, {3,25,5,25}, {5,25,6,25}, {6,25,7,24}, {7,25,7,25}, {8,25,8,24},
+  {0,26,1,27}, {1,26,2,28}, {2,26,3,27}, {3,26,5,26}, {5,26,6,26}, {6,26,7,25}, {7,26,8,26}, {8,26,8,25},
+  {0,27,0,28}, {1,27,1,28}, {2,27,3,28}, {3,27,4,28}, {4,27,5,27}, {5,27,6,27}, {6,27,7,26}, {7,27,7,27},
+  {8,27,8,27}, {0,28,0,29}, {1,28,1,29}, {2,28,3,28}, {3,28,3,29}, {4,28,5,28}, {5,28,6,27}, {6,28,6,28},
+  {7,28,7,28}, {8,28,8,28}, {0,29,0,29}, {1,29,2,29}, {2,29,3,30}, {3,29,4,29}, {4,29,5,29}, {5,29,6,29},
+  {6,29,6,29}, {7,29,7,29}, {8,29,8,29}, {0,30,0,30}, {1,30,1,30}, {2,30,2,30}, {3,30,3,30}, {4,30,4,30},
+  {5,30,5,30}, {6,30,6,30}, {7,30,7,30}, {8,30,8,30},
+};
+
+const uint16_t MORPH_PAIR_OFFSETS[MORPH_PAIR_TABLES + 1] = {
+  0, 248, 496, 744, 992, 1240, 1488, 1736, 1988, 2236, 2416, 2596,
+  2788, 2968, 3184, 3324, 3576, 3792, 3972, 4164, 4344, 4560, 4740, 4992,
+  5208, 5400, 5580, 5796, 5976, 6228, 6444, 6636, 6852, 7044, 7296, 7512,
+  7728, 7908, 8160, 8376, 8592, 8844, 9060, 9312, 9528, 9780,
+};
@@ -0,0 +1,121 @@
+#include "PerfStats.h"
+
+static const char* const SECTION_NAMES[PERF_SECTION_COUNT] = {
+    "renderMode",
+    "renderTft",
+    "statusBar",
+    "handleClient",
+    "sensorRead",
+};
+
+static PerfStat stats[PERF_SECTION_COUNT];
+
+static uint32_t frameCount = 0;
+static uint32_t windowStartMs = 0;  // Start of the current one-second FPS window
+static uint32_t windowFrames = 0;
+static float lastFps = 0.0f;
+
+static uint32_t idleWindowStartMs = 0;  // Start of the current one-second idle window
+static uint32_t idleWindowUs = 0;
+static float lastIdlePct = 0.0f;
+
+static uint32_t ledsLast = 0;
+static uint32_t ledsMax = 0;
+static uint64_t ledsTotal = 0;
+
+namespace Perf {
+
+void record(PerfSection section, uint32_t cycles, uint32_t cpuMHz) {
+    if (section >= PERF_SECTION_COUNT) return;
+    PerfStat& s = stats[section];
+
+    // PowerScaling may have switched the clock during the sample (sections
+    // without a boost, e.g. sensor steps): the cycle count mixes two rates
+    if (cpuMHz == 0 || ESP.getCpuFreqMHz() != cpuMHz) {
+        s.skipped++;
+        return;
+    }
+    const uint32_t us = cycles / cpuMHz;
+
+    if (s.count == 0 || us < s.minUs) s.minUs = us;
+    if (us > s.maxUs) s.maxUs = us;
+    s.totalUs += us;
+    s.count++;
+
+    // log2 bucket: 0 -> 0, 1 -> 1, 2..3 -> 2, 4..7 -> 3, ...
+    uint8_t bucket = (us == 0) ? 0 : (uint8_t)(32 - __builtin_clz(us));
+    if (bucket >= PERF_HIST_BUCKETS) bucket = PERF_HIST_BUCKETS - 1;
+    s.hist[bucket]++;
+}
+
+void frame(uint32_t changedLeds) {
+    frameCount++;
+    ledsLast = changedLeds;
+    if (changedLeds > ledsMax) ledsMax = changedLeds;
+    ledsTotal += changedLeds;
+
+    const uint32_t now = millis();
+    windowFrames++;
+    if (now - windowStartMs >= 1000) {
+        lastFps = windowFrames * 1000.0f / (now - windowStartMs);
+        windowFrames = 0;
+        windowStartMs = now;
+    }
+}
+
+void idle(uint32_t us) {
+    idleWindowUs += us;
+
+    const uint32_t now = millis();
+    if (now - idleWindowStartMs >= 1000) {
+        lastIdlePct = idleWindowUs / (10.0f * (now - idleWindowStartMs));
+        if (lastIdlePct > 100.0f) lastIdlePct = 100.0f;
+        idleWindowUs = 0;
+        idleWindowStartMs = now;
+    }
+}
+
+void reset() {
+    memset(stats, 0, sizeof(stats));
+    frameCount = 0;
+    windowFrames = 0;
+    windowStartMs = millis();
+    lastFps = 0.0f;
+    idleWindowUs = 0;
+    idleWindowStartMs = millis();
+    lastIdlePct = 0.0f;
+    ledsLast = 0;
+    ledsMax = 0;
+    ledsTotal = 0;
+}
+
+const PerfStat& stat(PerfSection section) {
+    return stats[section < PERF_SECTION_COUNT ? section : 0];
+}
+
+const char* name(PerfSection section) {
+    return section < PERF_SECTION_COUNT ? SECTION_NAMES[section] : "?";
+}
+
+float fps() {
+    // A stalled renderer stops calling frame(); report 0 rather than a stale rate
+    if (millis() - windowStartMs > 2000) return 0.0f;
+    return lastFps;
+}
+
+float idlePercent() {
+    // A render task stuck in a frame stops calling idle(); report 0 rather than a stale share
+    if (millis() - idleWindowStartMs > 2000) return 0.0f;
+    return lastIdlePct;
+}
+
+uint32_t frames() { return frameCount; }
+uint32_t changedLedsLast() { return ledsLast; }
+uint32_t changedLedsMax() { return ledsMax; }
+float changedLedsMean() { return frameCount ? (float)ledsTotal / frameCount : 0.0f; }
+
+uint32_t bucketFloorUs(uint8_t bucket) {
+    return bucket == 0 ? 0 : (1UL << (bucket - 1));
+}
+
+}  // namespace Perf
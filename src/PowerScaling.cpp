@@ -0,0 +1,121 @@
+#include "PowerScaling.h"
+#include "debug.h"
+
+#include <atomic>
+#include <sdkconfig.h>
+#if ENABLE_POWER_SCALING && CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+
+static_assert(POWER_MIN_MHZ >= 80, "POWER_MIN_MHZ below 80 MHz also slows the APB clock");
+
+static const char* const CLIENT_NAMES[POWER_CLIENT_COUNT] = {
+    "render",
+    "web",
+};
+
+#if ENABLE_POWER_SCALING && CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t locks[POWER_CLIENT_COUNT];
+#endif
+static bool active = false;                         // Frequency scaling configured
+static std::atomic<bool> held[POWER_CLIENT_COUNT];  // Client holds its PM lock
+static uint32_t boostCount[POWER_CLIENT_COUNT];
+static volatile uint32_t lastWebMs = 0;
+
+// Residency: time at each CPU frequency seen, sampled by tick()
+static uint32_t slotMHz[POWER_FREQ_SLOTS];
+static uint64_t slotMs[POWER_FREQ_SLOTS];
+static uint8_t slotsUsed = 0;
+static uint32_t lastTickMs = 0;
+
+namespace Power {
+
+void begin() {
+    lastTickMs = millis();
+#if ENABLE_POWER_SCALING && CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t pm = {};
+    pm.max_freq_mhz = POWER_MAX_MHZ;
+    pm.min_freq_mhz = POWER_MIN_MHZ;
+    pm.light_sleep_enable = false;  // Needs tickless idle, which the Arduino core is built without
+
+    esp_err_t err = esp_pm_configure(&pm);
+    if (err != ESP_OK) {
+        DBG_WARN("Power: frequency scaling unavailable (%s), staying at %lu MHz\n",
+                 esp_err_to_name(err), (unsigned long)ESP.getCpuFreqMHz());
+        return;
+    }
+    for (uint8_t c = 0; c < POWER_CLIENT_COUNT; c++) {
+        if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, CLIENT_NAMES[c], &locks[c]) != ESP_OK) {
+            // Without every lock a client could be left at POWER_MIN_MHZ: go back to full speed
+            DBG_WARN("Power: failed to create PM lock '%s', scaling disabled\n", CLIENT_NAMES[c]);
+            pm.min_freq_mhz = POWER_MAX_MHZ;
+            esp_pm_configure(&pm);
+            return;
+        }
+    }
+    active = true;
+    DBG_INFO("Power: CPU scaling %d-%d MHz\n", POWER_MIN_MHZ, POWER_MAX_MHZ);
+#else
+    DBG_INFO("Power: frequency scaling disabled, CPU at %lu MHz\n", (unsigned long)ESP.getCpuFreqMHz());
+#endif
+}
+
+void boost(PowerClient client) {
+    if (client >= POWER_CLIENT_COUNT || held[client].exchange(true)) return;
+    boostCount[client]++;
+#if ENABLE_POWER_SCALING && CONFIG_PM_ENABLE
+    if (active) esp_pm_lock_acquire(locks[client]);
+#endif
+}
+
+void release(PowerClient client) {
+    if (client >= POWER_CLIENT_COUNT || !held[client].exchange(false)) return;
+#if ENABLE_POWER_SCALING && CONFIG_PM_ENABLE
+    if (active) esp_pm_lock_release(locks[client]);
+#endif
+}
+
+void webActivity() {
+    lastWebMs = millis();
+    boost(POWER_WEB);
+}
+
+void tick() {
+    const uint32_t now = millis();
+    if (held[POWER_WEB] && now - lastWebMs >= POWER_WEB_HOLD_MS) release(POWER_WEB);
+
+    // Charge the time since the last tick to the current frequency
+    const uint32_t mhz = ESP.getCpuFreqMHz();
+    const uint32_t elapsed = now - lastTickMs;
+    lastTickMs = now;
+
+    uint8_t slot = 0;
+    while (slot < slotsUsed && slotMHz[slot] != mhz) slot++;
+    if (slot == slotsUsed) {
+        if (slotsUsed == POWER_FREQ_SLOTS) return;  // More frequencies than slots: not charged
+        slotMHz[slotsUsed++] = mhz;
+    }
+    slotMs[slot] += elapsed;
+}
+
+void resetStats() {
+    memset(slotMs, 0, sizeof(slotMs));
+    memset(boostCount, 0, sizeof(boostCount));
+    lastTickMs = millis();
+}
+
+bool scaling() { return active; }
+
+uint8_t freqSlots() { return slotsUsed; }
+uint32_t freqMHz(uint8_t slot) { return slot < slotsUsed ? slotMHz[slot] : 0; }
+uint64_t freqMs(uint8_t slot) { return slot < slotsUsed ? slotMs[slot] : 0; }
+
+uint32_t boosts(PowerClient client) {
+    return client < POWER_CLIENT_COUNT ? boostCount[client] : 0;
+}
+
+const char* name(PowerClient client) {
+    return client < POWER_CLIENT_COUNT ? CLIENT_NAMES[client] : "?";
+}
+
+}  // namespace Power
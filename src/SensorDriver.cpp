@@ -0,0 +1,409 @@
+#include "SensorDriver.h"
+
+#include "debug.h"
+
+#include <Wire.h>
+#include <Adafruit_BME280.h>
+#include <Adafruit_BMP280.h>
+
+#define SENSOR_STATUS_POLL_MS 2    // Re-check interval when a conversion is not done yet
+#define SENSOR_STATUS_POLLS   20   // Give up after this many re-checks
+
+// =========================
+// Register helpers
+// =========================
+static bool writeReg(uint8_t addr, uint8_t reg, uint8_t value) {
+  Wire.beginTransmission(addr);
+  Wire.write(reg);
+  Wire.write(value);
+  return Wire.endTransmission() == 0;
+}
+
+// Send a 16-bit command (SHT3X) or an 8-bit one (HTU21D, cmd <= 0xFF)
+static bool writeCmd(uint8_t addr, uint16_t cmd) {
+  Wire.beginTransmission(addr);
+  if (cmd > 0xFF) Wire.write((uint8_t)(cmd >> 8));
+  Wire.write((uint8_t)cmd);
+  return Wire.endTransmission() == 0;
+}
+
+static bool readBytes(uint8_t addr, uint8_t* buf, uint8_t n) {
+  if (Wire.requestFrom(addr, n) != n) return false;
+  for (uint8_t i = 0; i < n; i++) buf[i] = Wire.read();
+  return true;
+}
+
+static bool readRegs(uint8_t addr, uint8_t reg, uint8_t* buf, uint8_t n) {
+  Wire.beginTransmission(addr);
+  Wire.write(reg);
+  if (Wire.endTransmission() != 0) return false;
+  return readBytes(addr, buf, n);
+}
+
+// Bosch chip ID register (BME280 0x60, BMP280 0x58, BMP180 0x55)
+static bool boschChipId(uint8_t addr, uint8_t id) {
+  uint8_t value;
+  return readRegs(addr, 0xD0, &value, 1) && value == id;
+}
+
+/**
+ * CRC-8 over data (SHT3X: poly 0x31, init 0xFF; HTU21D: poly 0x31, init 0x00)
+ */
+static uint8_t crc8(const uint8_t* data, uint8_t n, uint8_t init) {
+  uint8_t crc = init;
+  for (uint8_t i = 0; i < n; i++) {
+    crc ^= data[i];
+    for (uint8_t b = 0; b < 8; b++) crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+  }
+  return crc;
+}
+
+// =========================
+// Bosch BME280 / BMP280 (forced mode, Adafruit compensation)
+// =========================
+// ctrl_meas (0xF4) is written to start a conversion; status (0xF3) bit 3 is
+// set while it runs. The Adafruit read*() calls only read and compensate
+// the result registers.
+#define BOSCH_REG_STATUS    0xF3
+#define BOSCH_REG_CTRL_MEAS 0xF4
+
+/**
+ * Poll the status register of a Bosch sensor
+ * @return 0 when the conversion is done, SENSOR_STATUS_POLL_MS to check again, -1 on error
+ */
+static int32_t boschStatus(uint8_t addr, uint8_t& polls) {
+  uint8_t status;
+  if (!readRegs(addr, BOSCH_REG_STATUS, &status, 1)) return -1;
+  if (!(status & 0x08)) return 0;
+  return ++polls > SENSOR_STATUS_POLLS ? -1 : SENSOR_STATUS_POLL_MS;
+}
+
+class BME280Driver : public SensorDriver {
+public:
+  const char* name() const override { return "BME280"; }
+  uint8_t measures() const override { return SENSOR_TEMPERATURE | SENSOR_HUMIDITY | SENSOR_PRESSURE; }
+
+  bool begin(uint8_t addr) override {
+    // Check the ID first: the library resets the chip before checking
+    if (!boschChipId(addr, 0x60) || !_bme.begin(addr, &Wire)) return false;
+    _addr = addr;
+    _bme.setSampling(Adafruit_BME280::MODE_FORCED,
+                     Adafruit_BME280::SAMPLING_X1,
+                     Adafruit_BME280::SAMPLING_X1,
+                     Adafruit_BME280::SAMPLING_X1,
+                     Adafruit_BME280::FILTER_OFF);
+    return true;
+  }
+
+  int32_t start() override {
+    _polls = 0;
+    // osrs_t x1, osrs_p x1, forced mode (ctrl_hum was set by setSampling())
+    if (!writeReg(_addr, BOSCH_REG_CTRL_MEAS, (1 << 5) | (1 << 2) | 0x01)) return -1;
+    return 10;  // 9.3 ms max at x1/x1/x1
+  }
+
+  int32_t step(SensorReading& out) override {
+    int32_t wait = boschStatus(_addr, _polls);
+    if (wait != 0) return wait;
+    out.temp = _bme.readTemperature();
+    out.hum = _bme.readHumidity();
+    out.pres = _bme.readPressure() / 100.0F;  // Convert Pa to hPa
+    return 0;
+  }
+
+private:
+  Adafruit_BME280 _bme;
+  uint8_t _polls = 0;
+};
+
+class BMP280Driver : public SensorDriver {
+public:
+  BMP280Driver() : _bmp(&Wire) {}
+
+  const char* name() const override { return "BMP280"; }
+  uint8_t measures() const override { return SENSOR_TEMPERATURE | SENSOR_PRESSURE; }
+
+  bool begin(uint8_t addr) override {
+    if (!boschChipId(addr, 0x58) || !_bmp.begin(addr)) return false;
+    _addr = addr;
+    // Forced mode: one conversion per reading, sensor asleep in between.
+    // No IIR filter: at one reading a minute it would only add lag.
+    _bmp.setSampling(Adafruit_BMP280::MODE_FORCED,
+                     Adafruit_BMP280::SAMPLING_X2,     // Temperature oversampling
+                     Adafruit_BMP280::SAMPLING_X16,    // Pressure oversampling
+                     Adafruit_BMP280::FILTER_OFF,
+                     Adafruit_BMP280::STANDBY_MS_500);
+    return true;
+  }
+
+  int32_t start() override {
+    _polls = 0;
+    // osrs_t x2, osrs_p x16, forced mode
+    if (!writeReg(_addr, BOSCH_REG_CTRL_MEAS, (2 << 5) | (5 << 2) | 0x01)) return -1;
+    return 44;  // 43.2 ms max at x2/x16
+  }
+
+  int32_t step(SensorReading& out) override {
+    int32_t wait = boschStatus(_addr, _polls);
+    if (wait != 0) return wait;
+    out.temp = _bmp.readTemperature();
+    out.pres = _bmp.readPressure() / 100.0F;  // Convert Pa to hPa
+    return 0;
+  }
+
+private:
+  Adafruit_BMP280 _bmp;
+  uint8_t _polls = 0;
+};
+
+// =========================
+// Bosch BMP180 (raw registers, datasheet compensation)
+// =========================
+class BMP180Driver : public SensorDriver {
+public:
+  const char* name() const override { return "BMP180"; }
+  uint8_t measures() const override { return SENSOR_TEMPERATURE | SENSOR_PRESSURE; }
+
+  bool begin(uint8_t addr) override {
+    if (!boschChipId(addr, 0x55)) return false;
+    _addr = addr;
+
+    // Calibration EEPROM: AC1..AC6, B1, B2, MB, MC, MD (big-endian)
+    uint8_t c[22];
+    if (!readRegs(_addr, 0xAA, c, sizeof(c))) return false;
+    auto word = [&](int i) { return (uint16_t)((c[i] << 8) | c[i + 1]); };
+    _ac1 = (int16_t)word(0);  _ac2 = (int16_t)word(2);  _ac3 = (int16_t)word(4);
+    _ac4 = word(6);           _ac5 = word(8);           _ac6 = word(10);
+    _b1 = (int16_t)word(12);  _b2 = (int16_t)word(14);
+    _mc = (int16_t)word(18);  _md = (int16_t)word(20);  // MB (16) is unused
+    return true;
+  }
+
+  int32_t start() override {
+    _stage = 0;
+    if (!writeReg(_addr, 0xF4, 0x2E)) return -1;  // Temperature conversion
+    return 5;                                     // 4.5 ms max
+  }
+
+  int32_t step(SensorReading& out) override {
+    uint8_t b[3];
+    if (_stage == 0) {
+      if (!readRegs(_addr, 0xF6, b, 2)) return -1;
+      _ut = (b[0] << 8) | b[1];
+      // Pressure conversion, ultra high resolution
+      if (!writeReg(_addr, 0xF4, 0x34 + (OSS << 6))) return -1;
+      _stage = 1;
+      return 26;  // 25.5 ms max at OSS 3
+    }
+
+    if (!readRegs(_addr, 0xF6, b, 3)) return -1;
+    const int32_t up = (((int32_t)b[0] << 16) | ((int32_t)b[1] << 8) | b[2]) >> (8 - OSS);
+
+    // Datasheet integer compensation
+    int32_t x1 = ((_ut - (int32_t)_ac6) * (int32_t)_ac5) >> 15;
+    int32_t x2 = ((int32_t)_mc << 11) / (x1 + _md);
+    const int32_t b5 = x1 + x2;
+    out.temp = ((b5 + 8) >> 4) / 10.0f;
+
+    const int32_t b6 = b5 - 4000;
+    x1 = (_b2 * ((b6 * b6) >> 12)) >> 11;
+    x2 = (_ac2 * b6) >> 11;
+    int32_t x3 = x1 + x2;
+    const int32_t b3 = ((((int32_t)_ac1 * 4 + x3) << OSS) + 2) / 4;
+    x1 = (_ac3 * b6) >> 13;
+    x2 = (_b1 * ((b6 * b6) >> 12)) >> 16;
+    x3 = ((x1 + x2) + 2) >> 2;
+    const uint32_t b4 = ((uint32_t)_ac4 * (uint32_t)(x3 + 32768)) >> 15;
+    const uint32_t b7 = ((uint32_t)up - b3) * (uint32_t)(50000UL >> OSS);
+    int32_t p = b7 < 0x80000000 ? (int32_t)((b7 * 2) / b4) : (int32_t)((b7 / b4) * 2);
+    x1 = (p >> 8) * (p >> 8);
+    x1 = (x1 * 3038) >> 16;
+    x2 = (-7357 * p) >> 16;
+    p += (x1 + x2 + 3791) >> 4;
+    out.pres = p / 100.0f;  // Convert Pa to hPa
+    return 0;
+  }
+
+private:
+  static const uint8_t OSS = 3;  // Oversampling setting (ultra high resolution)
+  int16_t _ac1 = 0, _ac2 = 0, _ac3 = 0, _b1 = 0, _b2 = 0, _mc = 0, _md = 0;
+  uint16_t _ac4 = 0, _ac5 = 0, _ac6 = 0;
+  int32_t _ut = 0;
+  uint8_t _stage = 0;
+};
+
+// =========================
+// Sensirion SHT3X (single shot, no clock stretching)
+// =========================
+class SHT3XDriver : public SensorDriver {
+public:
+  const char* name() const override { return "SHT3X"; }
+  uint8_t measures() const override { return SENSOR_TEMPERATURE | SENSOR_HUMIDITY; }
+
+  bool begin(uint8_t addr) override {
+    if (!writeCmd(addr, 0x30A2)) return false;  // Soft reset
+    delay(2);                                   // 1.5 ms max
+
+    // Identify by the status register and its CRC
+    uint8_t b[3];
+    if (!writeCmd(addr, 0xF32D) || !readBytes(addr, b, 3) || crc8(b, 2, 0xFF) != b[2]) return false;
+    _addr = addr;
+    return true;
+  }
+
+  int32_t start() override {
+    if (!writeCmd(_addr, 0x2400)) return -1;  // High repeatability
+    return 16;                                // 15.5 ms max
+  }
+
+  int32_t step(SensorReading& out) override {
+    uint8_t b[6];
+    if (!readBytes(_addr, b, 6)) return -1;
+    if (crc8(b, 2, 0xFF) != b[2] || crc8(b + 3, 2, 0xFF) != b[5]) return -1;
+    out.temp = -45.0f + 175.0f * (uint16_t)((b[0] << 8) | b[1]) / 65535.0f;
+    out.hum = 100.0f * (uint16_t)((b[3] << 8) | b[4]) / 65535.0f;
+    return 0;
+  }
+};
+
+// =========================
+// TE HTU21D (no-hold master mode)
+// =========================
+class HTU21DDriver : public SensorDriver {
+public:
+  const char* name() const override { return "HTU21D"; }
+  uint8_t measures() const override { return SENSOR_TEMPERATURE | SENSOR_HUMIDITY; }
+
+  bool begin(uint8_t addr) override {
+    if (!writeCmd(addr, 0xFE)) return false;  // Soft reset
+    delay(15);
+    uint8_t user;
+    if (!writeCmd(addr, 0xE7) || !readBytes(addr, &user, 1) || user != 0x02) return false;  // Default user register
+    _addr = addr;
+    return true;
+  }
+
+  int32_t start() override {
+    _stage = 0;
+    if (!writeCmd(_addr, 0xF3)) return -1;  // Temperature, no hold
+    return 50;                              // 50 ms max at 14 bit
+  }
+
+  int32_t step(SensorReading& out) override {
+    uint16_t raw;
+    if (!readRaw(raw)) return -1;
+    if (_stage == 0) {
+      out.temp = -46.85f + 175.72f * raw / 65536.0f;
+      if (!writeCmd(_addr, 0xF5)) return -1;  // Humidity, no hold
+      _stage = 1;
+      return 16;                              // 16 ms max at 12 bit
+    }
+    out.hum = -6.0f + 125.0f * raw / 65536.0f;
+    return 0;
+  }
+
+private:
+  uint8_t _stage = 0;
+
+  // Read a 16-bit result and its CRC (status bits cleared)
+  bool readRaw(uint16_t& raw) {
+    uint8_t b[3];
+    if (!readBytes(_addr, b, 3) || crc8(b, 2, 0x00) != b[2]) return false;
+    raw = ((b[0] << 8) | b[1]) & 0xFFFC;
+    return true;
+  }
+};
+
+// =========================
+// Registry
+// =========================
+// Supported sensors, most accurate first (merge() prefers earlier entries).
+// Each address is bound to the first type whose begin() accepts it.
+struct SensorType {
+  uint8_t addrs[2];               // Possible addresses (0 = unused)
+  SensorDriver* (*create)();
+};
+
+template <class T>
+static SensorDriver* createDriver() { return new T(); }
+
+static const SensorType SENSOR_TYPES[] = {
+  {{0x44, 0x45}, createDriver<SHT3XDriver>},    // ±0.2 °C, ±2 %RH
+  {{0x40, 0},    createDriver<HTU21DDriver>},   // ±0.3 °C, ±2 %RH
+  {{0x76, 0x77}, createDriver<BME280Driver>},   // ±1 °C, ±3 %RH, ±1 hPa
+  {{0x76, 0x77}, createDriver<BMP280Driver>},   // ±1 °C, ±1 hPa
+  {{0x77, 0},    createDriver<BMP180Driver>},   // ±2 °C, ±1 hPa
+};
+
+static SensorDriver* drivers[SENSOR_MAX_DEVICES];
+static uint8_t driverCount = 0;
+
+// An empty write: the device ACKs its address or the bus NACKs within ~0.1 ms
+static bool probe(uint8_t addr) {
+  Wire.beginTransmission(addr);
+  return Wire.endTransmission() == 0;
+}
+
+namespace Sensors {
+
+uint8_t scan() {
+  if (driverCount) return driverCount;
+  const uint32_t startMs = millis();
+
+  // Addresses that answer (bit map over the 7-bit address space)
+  uint8_t present[16] = {};
+  for (const SensorType& type : SENSOR_TYPES) {
+    for (uint8_t addr : type.addrs) {
+      if (addr && !(present[addr >> 3] & (1 << (addr & 7))) && probe(addr)) {
+        present[addr >> 3] |= 1 << (addr & 7);
+      }
+    }
+  }
+
+  // Offer each answering address to the types that may live there
+  SensorDriver* spare = nullptr;
+  for (const SensorType& type : SENSOR_TYPES) {
+    for (uint8_t addr : type.addrs) {
+      if (!addr || !(present[addr >> 3] & (1 << (addr & 7)))) continue;
+      if (driverCount == SENSOR_MAX_DEVICES) break;
+      if (!spare) spare = type.create();
+      if (spare->begin(addr)) {
+        DBG_INFO("Sensor: %s at 0x%02X\n", spare->name(), addr);
+        drivers[driverCount++] = spare;
+        spare = nullptr;
+        present[addr >> 3] &= ~(1 << (addr & 7));  // Bound
+      }
+    }
+    delete spare;  // Driver of this type left unbound
+    spare = nullptr;
+  }
+
+  DBG_INFO("Sensor scan: %u found in %lu ms\n", driverCount, (unsigned long)(millis() - startMs));
+  return driverCount;
+}
+
+uint8_t count() { return driverCount; }
+
+SensorDriver* get(uint8_t index) {
+  return index < driverCount ? drivers[index] : nullptr;
+}
+
+uint8_t measures() {
+  uint8_t flags = 0;
+  for (uint8_t i = 0; i < driverCount; i++) flags |= drivers[i]->measures();
+  return flags;
+}
+
+SensorReading merge(const SensorReading* readings, const bool* valid) {
+  SensorReading merged = {NAN, NAN, NAN};
+  for (uint8_t i = 0; i < driverCount; i++) {
+    if (!valid[i]) continue;
+    const SensorReading& r = readings[i];
+    if (isnan(merged.temp)) merged.temp = r.temp;
+    if (isnan(merged.hum)) merged.hum = r.hum;
+    if (isnan(merged.pres)) merged.pres = r.pres;
+  }
+  return merged;
+}
+
+}  // namespace Sensors
@@ -0,0 +1,569 @@
+#include "SensorHistory.h"
+#include "debug.h"
+
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+
+#define DELTA_GAP      INT8_MIN       // No value for this channel in this sample
+#define DELTA_MAX      127            // Larger changes are clamped and carried
+#define MIN_UNIX_TIME  1577836800UL   // 2020-01-01: earlier means NTP has not set the clock
+#define BLOCK_MAGIC    0x48           // 'H'
+#define BLOCK_VERSION  1
+#define BLOCK_CHUNK    64             // Samples buffered per log read/write
+
+// Log block: this header, then count samples of HISTORY_CHANNELS deltas. The
+// first sample's deltas are 0 (or gaps): its values are base.
+struct __attribute__((packed)) BlockHeader {
+  uint8_t magic;
+  uint8_t version;
+  uint16_t count;
+  uint32_t start;                       // Time of the first sample
+  int16_t base[HISTORY_CHANNELS];
+};
+
+struct Tier {
+  const char* name;
+  uint32_t period;                      // Seconds per sample
+  uint16_t limit;                       // Configured samples (config.h)
+  uint16_t capacity;                    // Samples allocated (begin()), 0 = not kept
+  int8_t* delta;                        // Change from the previous sample: capacity x stride
+  uint16_t head;                        // Slot of the newest sample
+  uint16_t count;
+  uint32_t end;                         // Time of the newest sample
+  int16_t first[HISTORY_CHANNELS];      // Value of the oldest sample
+  int16_t last[HISTORY_CHANNELS];       // Value of the newest sample (what deltas encode against)
+  uint8_t primed;                       // Channels that have had a value
+  uint32_t generation;                  // Bumped when stored values change (cursors resync)
+  uint16_t unsaved;                     // Newest samples not yet in the log
+  bool rewrite;                         // Log no longer matches the ring (re-stamped)
+
+  // Average of the period being filled
+  uint32_t accStart;
+  int32_t accSum[HISTORY_CHANNELS];
+  uint16_t accN[HISTORY_CHANNELS];
+};
+
+static Tier tiers[HISTORY_TIER_COUNT] = {
+  {"1m",  60,      HISTORY_1M_SAMPLES},
+  {"15m", 15 * 60, HISTORY_15M_SAMPLES},
+  {"1h",  60 * 60, HISTORY_1H_SAMPLES},
+};
+
+// Only the channels the detected sensors measure are stored: a slot holds
+// `stride` deltas, channel c at offset[c] (-1 = not stored, reads as a gap)
+static uint8_t stride = 0;
+static int8_t offset[HISTORY_CHANNELS];
+static uint8_t storedChannels = 0;
+static size_t ringBytes = 0;
+static bool ringsInPsram = false;
+
+static SemaphoreHandle_t ringMutex = nullptr;  // Network task writes, web handlers read
+static bool started = false;
+static uint32_t lastPersistMs = 0;
+
+// Latest reading, held over a minute that got none
+static int16_t latest[HISTORY_CHANNELS];
+static uint8_t latestValid = 0;
+static uint32_t latestMs = 0;
+
+// =========================
+// Ring buffers
+// =========================
+static uint32_t oldestTime(const Tier& r) {
+  return r.count ? r.end - (uint32_t)(r.count - 1) * r.period : 0;
+}
+
+// Slot of the sample `index` places after the oldest
+static uint16_t slotAt(const Tier& r, uint16_t index) {
+  return (r.head + 1 + r.capacity - r.count + index) % r.capacity;
+}
+
+// Delta of one channel in a slot
+static int8_t deltaAt(const Tier& r, uint16_t slot, uint8_t c) {
+  return offset[c] < 0 ? DELTA_GAP : r.delta[slot * stride + offset[c]];
+}
+
+// Decode the values of the sample `index` places after the oldest
+static void valueAt(const Tier& r, uint16_t index, int16_t* v) {
+  memcpy(v, r.first, sizeof(r.first));
+  for (uint16_t i = 1; i <= index; i++) {
+    const uint16_t slot = slotAt(r, i);
+    for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+      const int8_t d = deltaAt(r, slot, c);
+      if (d != DELTA_GAP) v[c] += d;
+    }
+  }
+}
+
+// Store one sample after the newest (ring locked)
+static void append(Tier& r, const int16_t* v, uint8_t valid) {
+  uint16_t slot = 0;
+  if (r.count == r.capacity) {
+    // Overwrite the oldest; the next one becomes the base
+    slot = (r.head + 1) % r.capacity;
+    const uint16_t next = (slot + 1) % r.capacity;
+    for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+      const int8_t d = deltaAt(r, next, c);
+      if (d != DELTA_GAP) r.first[c] += d;
+    }
+  } else if (r.count++) {
+    slot = (r.head + 1) % r.capacity;
+  }
+  r.head = slot;
+
+  for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+    if (offset[c] < 0) continue;
+    const uint8_t bit = 1 << c;
+    int8_t d;
+    if (!(valid & bit)) {
+      d = DELTA_GAP;
+    } else if (!(r.primed & bit)) {
+      // First value: every earlier sample is a gap, so they all take it
+      r.first[c] = r.last[c] = v[c];
+      r.primed |= bit;
+      r.generation++;
+      d = 0;
+    } else {
+      d = (int8_t)constrain((int32_t)v[c] - r.last[c], -DELTA_MAX, DELTA_MAX);
+      r.last[c] += d;
+    }
+    r.delta[slot * stride + offset[c]] = d;
+  }
+  if (r.unsaved < r.capacity) r.unsaved++;
+}
+
+/**
+ * Store the sample for time t (a multiple of the period), after gaps for
+ * any periods skipped since the newest
+ */
+static void push(Tier& r, uint32_t t, const int16_t* v, uint8_t valid) {
+  if (!r.capacity) return;
+  xSemaphoreTake(ringMutex, portMAX_DELAY);
+  if (r.count && t <= r.end) {
+    xSemaphoreGive(ringMutex);  // Not newer (clock stepped back)
+    return;
+  }
+  if (r.count) {
+    const uint32_t skipped = (t - r.end) / r.period - 1;
+    if (skipped >= r.capacity) {
+      // Everything kept is older than a ring: start over
+      r.count = 0;
+      r.primed = 0;
+      r.unsaved = 0;
+      r.generation++;
+    } else {
+      for (uint32_t i = 0; i < skipped; i++) append(r, nullptr, 0);
+    }
+  }
+  append(r, v, valid);
+  r.end = t;
+  xSemaphoreGive(ringMutex);
+}
+
+// Push the average of the period being filled and start the next
+static void closePeriod(Tier& r, int16_t* v, uint8_t& valid) {
+  valid = 0;
+  for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+    if (r.accN[c]) {
+      v[c] = (int16_t)lroundf((float)r.accSum[c] / r.accN[c]);
+      valid |= 1 << c;
+    }
+  }
+  push(r, r.accStart, v, valid);
+  memset(r.accSum, 0, sizeof(r.accSum));
+  memset(r.accN, 0, sizeof(r.accN));
+}
+
+// Feed a minute sample into a coarser tier
+static void accumulate(Tier& r, uint32_t t, const int16_t* v, uint8_t valid) {
+  const uint32_t start = t - t % r.period;
+  if (r.accStart != start) {
+    if (r.accStart) {
+      int16_t avg[HISTORY_CHANNELS];
+      uint8_t avgValid;
+      closePeriod(r, avg, avgValid);
+    }
+    r.accStart = start;
+  }
+  for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+    if (valid & (1 << c)) {
+      r.accSum[c] += v[c];
+      r.accN[c]++;
+    }
+  }
+}
+
+/**
+ * The clock stepped back (NTP correction): move the time stamps back so the
+ * newest samples end before now. Otherwise every new sample would be dropped
+ * as not newer until the clock caught up with the old ones.
+ */
+static void restamp(uint32_t unixTime) {
+  xSemaphoreTake(ringMutex, portMAX_DELAY);
+  for (Tier& r : tiers) {
+    const uint32_t start = unixTime - unixTime % r.period;
+    if (r.accStart > start) r.accStart = start;
+    if (r.count && r.end >= start) {
+      r.end = start - r.period;
+      r.generation++;     // Cursors re-find their position
+      r.rewrite = true;   // The log holds the old stamps
+    }
+  }
+  xSemaphoreGive(ringMutex);
+}
+
+// Close the minute being filled and feed it to the coarser tiers
+static void closeMinute() {
+  Tier& m = tiers[HISTORY_1M];
+
+  // A minute without a reading (the sensor interval drifting across a minute
+  // boundary) repeats the latest one if it is recent
+  const bool fresh = millis() - latestMs <= 2 * SENSOR_UPDATE_INTERVAL;
+  for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+    if (!m.accN[c] && fresh && (latestValid & (1 << c))) {
+      m.accSum[c] = latest[c];
+      m.accN[c] = 1;
+    }
+  }
+
+  int16_t v[HISTORY_CHANNELS];
+  uint8_t valid;
+  const uint32_t t = m.accStart;
+  closePeriod(m, v, valid);
+  for (uint8_t k = HISTORY_15M; k < HISTORY_TIER_COUNT; k++) {
+    accumulate(tiers[k], t, v, valid);
+  }
+}
+
+// =========================
+// Log files
+// =========================
+static void logPath(const Tier& r, const char* ext, char* path, size_t len) {
+  snprintf(path, len, "%s/%s.%s", HISTORY_DIR, r.name, ext);
+}
+
+// Write samples [index, count) as one block (network task: the only writer)
+static bool writeBlock(File& f, const Tier& r, uint16_t index) {
+  BlockHeader h;
+  h.magic = BLOCK_MAGIC;
+  h.version = BLOCK_VERSION;
+  h.count = r.count - index;
+  h.start = oldestTime(r) + (uint32_t)index * r.period;
+  int16_t base[HISTORY_CHANNELS];
+  valueAt(r, index, base);
+  memcpy(h.base, base, sizeof(base));
+  if (f.write((const uint8_t*)&h, sizeof(h)) != sizeof(h)) return false;
+
+  int8_t buf[BLOCK_CHUNK][HISTORY_CHANNELS];
+  uint16_t n = 0;
+  for (uint16_t i = index; i < r.count; i++) {
+    const uint16_t slot = slotAt(r, i);
+    for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+      const int8_t d = deltaAt(r, slot, c);
+      buf[n][c] = (i == index && d != DELTA_GAP) ? 0 : d;
+    }
+    if (++n == BLOCK_CHUNK || i + 1 == r.count) {
+      if (f.write((const uint8_t*)buf, n * sizeof(buf[0])) != n * sizeof(buf[0])) return false;
+      n = 0;
+    }
+  }
+  return true;
+}
+
+// Replace a log with the whole ring as one block
+static bool compact(Tier& r) {
+  char path[32], tmp[32];
+  logPath(r, "log", path, sizeof(path));
+  logPath(r, "tmp", tmp, sizeof(tmp));
+
+  File f = LittleFS.open(tmp, "w");
+  if (!f) return false;
+  const bool ok = !r.count || writeBlock(f, r, 0);
+  f.close();
+  if (!ok) {
+    LittleFS.remove(tmp);
+    return false;
+  }
+  LittleFS.remove(path);
+  if (!LittleFS.rename(tmp, path)) return false;
+  r.unsaved = 0;
+  r.rewrite = false;
+  return true;
+}
+
+// Append the samples not yet in the log
+static void persist(Tier& r) {
+  if (r.rewrite) {
+    // Samples were re-stamped: appending would put them out of order
+    if (!compact(r)) DBG_WARN("History: cannot rewrite %s log\n", r.name);
+    return;
+  }
+  if (!r.unsaved || !r.count) return;
+  char path[32];
+  logPath(r, "log", path, sizeof(path));
+
+  File f = LittleFS.open(path, "a");
+  if (!f) {
+    DBG_WARN("History: cannot open %s\n", path);
+    return;
+  }
+  const bool ok = writeBlock(f, r, r.count - r.unsaved);
+  const size_t size = f.size();
+  f.close();
+
+  // A failed append may have left a partial block: rewrite the log
+  if (!ok || size > 2 * (size_t)r.capacity * HISTORY_CHANNELS) {
+    if (!compact(r)) DBG_WARN("History: cannot rewrite %s\n", path);
+    return;
+  }
+  r.unsaved = 0;
+}
+
+// Replay a log into its ring (setup)
+static void restore(Tier& r) {
+  char path[32];
+  logPath(r, "log", path, sizeof(path));
+  File f = LittleFS.open(path, "r");
+  if (!f) return;
+
+  BlockHeader h;
+  bool damaged = false;
+  size_t got;
+  while ((got = f.read((uint8_t*)&h, sizeof(h))) == sizeof(h)) {
+    if (h.magic != BLOCK_MAGIC || h.version != BLOCK_VERSION || h.count == 0 || h.count > r.limit) {
+      damaged = true;
+      break;
+    }
+
+    int16_t v[HISTORY_CHANNELS];
+    memcpy(v, h.base, sizeof(v));  // Packed: copy out before use
+    int8_t buf[BLOCK_CHUNK][HISTORY_CHANNELS];
+    for (uint16_t i = 0; i < h.count && !damaged; i += BLOCK_CHUNK) {
+      const uint16_t n = (h.count - i < BLOCK_CHUNK) ? h.count - i : BLOCK_CHUNK;
+      if (f.read((uint8_t*)buf, n * sizeof(buf[0])) != n * sizeof(buf[0])) {
+        damaged = true;
+        break;
+      }
+      for (uint16_t j = 0; j < n; j++) {
+        uint8_t valid = 0;
+        for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+          if (buf[j][c] == DELTA_GAP) continue;
+          v[c] += buf[j][c];
+          valid |= 1 << c;
+        }
+        push(r, h.start + (uint32_t)(i + j) * r.period, v, valid);
+      }
+    }
+    if (damaged) break;
+  }
+  if (got != 0 && got != sizeof(h)) damaged = true;  // Partial header at the end
+  f.close();
+
+  r.unsaved = 0;
+  DBG_INFO("History %s: %u samples restored\n", r.name, r.count);
+  if (damaged) {
+    DBG_WARN("History: %s damaged, rewriting\n", path);
+    compact(r);
+  }
+}
+
+/**
+ * Allocate the rings for the channels the detected sensors measure (setup)
+ * With PSRAM every tier gets its configured size. Otherwise the rings share
+ * HISTORY_RAM_BUDGET bytes of internal RAM, finest tier first, so the hourly
+ * tier keeps less than its configured year.
+ */
+static void allocate() {
+  static const uint8_t measured[HISTORY_CHANNELS] = {SENSOR_TEMPERATURE, SENSOR_HUMIDITY, SENSOR_PRESSURE};
+  const uint8_t measures = Sensors::measures();
+  stride = 0;
+  for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+    offset[c] = (measures & measured[c]) ? (int8_t)stride++ : -1;
+    if (offset[c] >= 0) storedChannels |= 1 << c;
+  }
+  if (!stride) return;
+
+  size_t total = 0;
+  for (Tier& r : tiers) {
+    r.capacity = r.limit;
+    total += (size_t)r.capacity * stride;
+  }
+  int8_t* block = (int8_t*)heap_caps_malloc(total, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  ringsInPsram = block != nullptr;
+
+  if (!block) {
+    size_t left = HISTORY_RAM_BUDGET;
+    total = 0;
+    for (Tier& r : tiers) {
+      r.capacity = (uint16_t)min((size_t)r.limit, left / stride);
+      left -= (size_t)r.capacity * stride;
+      total += (size_t)r.capacity * stride;
+    }
+    block = (int8_t*)heap_caps_malloc(total, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!block) {
+      DBG_WARN("History: cannot allocate %u bytes, not recording\n", (unsigned)total);
+      for (Tier& r : tiers) r.capacity = 0;
+      return;
+    }
+  }
+
+  for (Tier& r : tiers) {
+    r.delta = block;
+    block += (size_t)r.capacity * stride;
+  }
+  ringBytes = total;
+}
+
+namespace History {
+
+void begin() {
+  if (started) return;
+  ringMutex = xSemaphoreCreateMutex();
+  if (!LittleFS.exists(HISTORY_DIR)) LittleFS.mkdir(HISTORY_DIR);
+
+  allocate();
+  const uint32_t startMs = millis();
+  for (Tier& r : tiers) {
+    if (r.capacity) restore(r);  // A tier not kept leaves its log alone
+  }
+  DBG_INFO("History: %u bytes of samples in %s (%u/%u/%u), logs replayed in %lu ms\n",
+           (unsigned)ringBytes, ringsInPsram ? "PSRAM" : "internal RAM",
+           tiers[HISTORY_1M].capacity, tiers[HISTORY_15M].capacity, tiers[HISTORY_1H].capacity,
+           (unsigned long)(millis() - startMs));
+
+  lastPersistMs = millis();
+  started = true;
+}
+
+void add(const SensorReading& reading) {
+  if (!started) return;
+  const float values[HISTORY_CHANNELS] = {reading.temp, reading.hum, reading.pres};
+  Tier& m = tiers[HISTORY_1M];
+
+  latestValid = 0;
+  for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+    if (isnan(values[c])) continue;
+    latest[c] = (int16_t)lroundf(values[c] * 10);
+    latestValid |= 1 << c;
+    m.accSum[c] += latest[c];
+    m.accN[c]++;
+  }
+  latestMs = millis();
+}
+
+void tick(uint32_t unixTime) {
+  if (!started || unixTime < MIN_UNIX_TIME) return;
+
+  Tier& m = tiers[HISTORY_1M];
+  const uint32_t minute = unixTime - unixTime % m.period;
+  if (!m.accStart) {
+    m.accStart = minute;  // First tick with the clock set
+  } else if (minute > m.accStart) {
+    closeMinute();
+    m.accStart = minute;
+  } else if (minute < m.accStart) {
+    DBG_INFO("History: clock stepped back %lu s, re-stamping\n", (unsigned long)(m.accStart - minute));
+    restamp(unixTime);
+  }
+
+  if (millis() - lastPersistMs >= HISTORY_PERSIST_MS) {
+    lastPersistMs = millis();
+    for (Tier& r : tiers) persist(r);
+  }
+}
+
+uint16_t capacity(HistoryTier tier) {
+  return tier < HISTORY_TIER_COUNT ? tiers[tier].capacity : 0;
+}
+
+size_t ramBytes() { return ringBytes; }
+bool inPsram() { return ringsInPsram; }
+
+uint32_t period(HistoryTier tier) {
+  return tier < HISTORY_TIER_COUNT ? tiers[tier].period : 0;
+}
+
+const char* name(HistoryTier tier) {
+  return tier < HISTORY_TIER_COUNT ? tiers[tier].name : "?";
+}
+
+uint32_t oldest(HistoryTier tier) {
+  if (!started || tier >= HISTORY_TIER_COUNT) return 0;
+  xSemaphoreTake(ringMutex, portMAX_DELAY);
+  const uint32_t t = oldestTime(tiers[tier]);
+  xSemaphoreGive(ringMutex);
+  return t;
+}
+
+uint32_t newest(HistoryTier tier) {
+  if (!started || tier >= HISTORY_TIER_COUNT) return 0;
+  xSemaphoreTake(ringMutex, portMAX_DELAY);
+  const uint32_t t = tiers[tier].count ? tiers[tier].end : 0;
+  xSemaphoreGive(ringMutex);
+  return t;
+}
+
+bool open(HistoryCursor& cursor, HistoryTier tier, uint32_t from, uint32_t to) {
+  cursor.tier = tier;
+  cursor.to = to;
+  cursor.synced = false;
+  cursor.next = UINT32_MAX;  // Nothing to read unless set below
+
+  const uint32_t first = oldest(tier);
+  if (!first || from > to || to < first) return false;
+
+  // First sample at or after from
+  const uint32_t p = tiers[tier].period;
+  cursor.next = from <= first ? first : first + (from - first + p - 1) / p * p;
+  return cursor.next <= to;
+}
+
+uint16_t read(HistoryCursor& cursor, HistorySample* out, uint16_t max) {
+  if (!started || cursor.tier >= HISTORY_TIER_COUNT) return 0;
+  const Tier& r = tiers[cursor.tier];
+  uint16_t n = 0;
+
+  xSemaphoreTake(ringMutex, portMAX_DELAY);
+  if (r.count && cursor.next <= r.end) {
+    const uint32_t first = oldestTime(r);
+    if (cursor.next < first) {
+      cursor.next = first;  // Overwritten since the last read
+      cursor.synced = false;
+    }
+    uint16_t index = (cursor.next - first) / r.period;
+    if (!cursor.synced || cursor.generation != r.generation) {
+      valueAt(r, index, cursor.value);
+      cursor.generation = r.generation;
+      cursor.synced = true;
+    }
+
+    while (n < max && cursor.next <= cursor.to) {
+      const uint16_t slot = slotAt(r, index);
+      uint8_t valid = 0;
+      for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+        if (deltaAt(r, slot, c) != DELTA_GAP) valid |= 1 << c;
+      }
+      if (valid) {
+        HistorySample& s = out[n++];
+        s.time = cursor.next;
+        memcpy(s.value, cursor.value, sizeof(s.value));
+        s.valid = valid;
+      }
+
+      cursor.next += r.period;
+      if (++index >= r.count) {
+        cursor.synced = false;  // Past the newest: resync when more arrive
+        break;
+      }
+      const uint16_t next = slotAt(r, index);
+      for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+        const int8_t d = deltaAt(r, next, c);
+        if (d != DELTA_GAP) cursor.value[c] += d;
+      }
+    }
+  }
+  xSemaphoreGive(ringMutex);
+  return n;
+}
+
+}  // namespace History
@@ -0,0 +1,119 @@
+#include "Tween.h"
+
+// Curves sampled at EASE_TABLE_STEPS + 1 evenly spaced times, Q16.
+// Generated offline in double precision so every build uses the same values.
+static const int32_t EASE_TABLES[EASE_CURVES - 1][EASE_TABLE_STEPS + 1] = {
+  // EASE_OUT_QUAD: 1 - (1 - t)^2
+  {
+         0,   1020,   2032,   3036,   4032,   5020,   6000,   6972,
+      7936,   8892,   9840,  10780,  11712,  12636,  13552,  14460,
+     15360,  16252,  17136,  18012,  18880,  19740,  20592,  21436,
+     22272,  23100,  23920,  24732,  25536,  26332,  27120,  27900,
+     28672,  29436,  30192,  30940,  31680,  32412,  33136,  33852,
+     34560,  35260,  35952,  36636,  37312,  37980,  38640,  39292,
+     39936,  40572,  41200,  41820,  42432,  43036,  43632,  44220,
+     44800,  45372,  45936,  46492,  47040,  47580,  48112,  48636,
+     49152,  49660,  50160,  50652,  51136,  51612,  52080,  52540,
+     52992,  53436,  53872,  54300,  54720,  55132,  55536,  55932,
+     56320,  56700,  57072,  57436,  57792,  58140,  58480,  58812,
+     59136,  59452,  59760,  60060,  60352,  60636,  60912,  61180,
+     61440,  61692,  61936,  62172,  62400,  62620,  62832,  63036,
+     63232,  63420,  63600,  63772,  63936,  64092,  64240,  64380,
+     64512,  64636,  64752,  64860,  64960,  65052,  65136,  65212,
+     65280,  65340,  65392,  65436,  65472,  65500,  65520,  65532,
+     65536,
+  },
+  // EASE_IN_OUT_QUAD: 2t^2, mirrored
+  {
+         0,      8,     32,     72,    128,    200,    288,    392,
+       512,    648,    800,    968,   1152,   1352,   1568,   1800,
+      2048,   2312,   2592,   2888,   3200,   3528,   3872,   4232,
+      4608,   5000,   5408,   5832,   6272,   6728,   7200,   7688,
+      8192,   8712,   9248,   9800,  10368,  10952,  11552,  12168,
+     12800,  13448,  14112,  14792,  15488,  16200,  16928,  17672,
+     18432,  19208,  20000,  20808,  21632,  22472,  23328,  24200,
+     25088,  25992,  26912,  27848,  28800,  29768,  30752,  31752,
+     32768,  33784,  34784,  35768,  36736,  37688,  38624,  39544,
+     40448,  41336,  42208,  43064,  43904,  44728,  45536,  46328,
+     47104,  47864,  48608,  49336,  50048,  50744,  51424,  52088,
+     52736,  53368,  53984,  54584,  55168,  55736,  56288,  56824,
+     57344,  57848,  58336,  58808,  59264,  59704,  60128,  60536,
+     60928,  61304,  61664,  62008,  62336,  62648,  62944,  63224,
+     63488,  63736,  63968,  64184,  64384,  64568,  64736,  64888,
+     65024,  65144,  65248,  65336,  65408,  65464,  65504,  65528,
+     65536,
+  },
+  // EASE_IN_OUT_CUBIC: 4t^3, mirrored
+  {
+         0,      0,      1,      3,      8,     16,     27,     43,
+        64,     91,    125,    166,    216,    275,    343,    422,
+       512,    614,    729,    857,   1000,   1158,   1331,   1521,
+      1728,   1953,   2197,   2460,   2744,   3049,   3375,   3724,
+      4096,   4492,   4913,   5359,   5832,   6332,   6859,   7415,
+      8000,   8615,   9261,   9938,  10648,  11391,  12167,  12978,
+     13824,  14706,  15625,  16581,  17576,  18610,  19683,  20797,
+     21952,  23149,  24389,  25672,  27000,  28373,  29791,  31256,
+     32768,  34280,  35745,  37163,  38536,  39864,  41147,  42387,
+     43584,  44739,  45853,  46926,  47960,  48955,  49911,  50830,
+     51712,  52558,  53369,  54145,  54888,  55598,  56275,  56921,
+     57536,  58121,  58677,  59204,  59704,  60177,  60623,  61044,
+     61440,  61812,  62161,  62487,  62792,  63076,  63339,  63583,
+     63808,  64015,  64205,  64378,  64536,  64679,  64807,  64922,
+     65024,  65114,  65193,  65261,  65320,  65370,  65411,  65445,
+     65472,  65493,  65509,  65520,  65528,  65533,  65535,  65536,
+     65536,
+  },
+  // EASE_OUT_ELASTIC: 2^(-10t) * sin((10t - 0.75) * 2pi/3) + 1
+  {
+         0,   4284,   9848,  16405,  23669,  31363,  39227,  47022,
+     54538,  61590,  68030,  73739,  78631,  82653,  85782,  88021,
+     89399,  89965,  89787,  88946,  87534,  85649,  83393,  80867,
+     78170,  75394,  72627,  69945,  67414,  65090,  63017,  61228,
+     59743,  58574,  57720,  57173,  56917,  56930,  57183,  57644,
+     58280,  59054,  59931,  60875,  61854,  62835,  63791,  64698,
+     65536,  66288,  66941,  67488,  67924,  68248,  68463,  68573,
+     68587,  68514,  68364,  68151,  67886,  67582,  67252,  66908,
+     66560,  66219,  65895,  65593,  65321,  65083,  64881,  64719,
+     64597,  64513,  64467,  64456,  64476,  64524,  64595,  64685,
+     64790,  64905,  65027,  65149,  65271,  65387,  65495,  65594,
+     65681,  65754,  65814,  65860,  65893,  65912,  65918,  65913,
+     65898,  65874,  65844,  65807,  65767,  65725,  65681,  65638,
+     65597,  65558,  65522,  65491,  65464,  65441,  65424,  65412,
+     65404,  65401,  65402,  65407,  65414,  65425,  65437,  65451,
+     65466,  65482,  65497,  65512,  65526,  65538,  65550,  65560,
+     65536,
+  },
+  // EASE_OUT_BOUNCE: Penner's bounce
+  {
+         0,     30,    121,    272,    484,    756,   1089,   1482,
+      1936,   2450,   3025,   3660,   4356,   5112,   5929,   6806,
+      7744,   8742,   9801,  10920,  12100,  13340,  14641,  16002,
+     17424,  18906,  20449,  22052,  23716,  25440,  27225,  29070,
+     30976,  32942,  34969,  37056,  39204,  41412,  43681,  46010,
+     48400,  50850,  53361,  55932,  58564,  61256,  64009,  64902,
+     63552,  62262,  61033,  59864,  58756,  57708,  56721,  55794,
+     54928,  54122,  53377,  52692,  52068,  51504,  51001,  50558,
+     50176,  49854,  49593,  49392,  49252,  49172,  49153,  49194,
+     49296,  49458,  49681,  49964,  50308,  50712,  51177,  51702,
+     52288,  52934,  53641,  54408,  55236,  56124,  57073,  58082,
+     59152,  60282,  61473,  62724,  64036,  65408,  64921,  64302,
+     63744,  63246,  62809,  62432,  62116,  61860,  61665,  61530,
+     61456,  61442,  61489,  61596,  61764,  61992,  62281,  62630,
+     63040,  63510,  64041,  64632,  65284,  65324,  65041,  64818,
+     64656,  64554,  64513,  64532,  64612,  64752,  64953,  65214,
+     65536,
+  },
+};
+
+q16_t ease(uint8_t curve, q16_t t) {
+  if (t <= 0) return 0;
+  if (t >= Q16_ONE) return Q16_ONE;
+  if (curve == EASE_LINEAR || curve >= EASE_CURVES) return t;
+
+  // Table segment and position within it (Q16 / 128 steps = 512 per step)
+  const int32_t* table = EASE_TABLES[curve - 1];
+  const int32_t pos = t * EASE_TABLE_STEPS;
+  const int32_t i = pos >> 16;
+  const int32_t frac = pos & 0xFFFF;
+  return lerpQ16(table[i], table[i + 1], frac);
+}
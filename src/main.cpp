@@ -105,7 +105,8 @@
 #include <Arduino.h>
 
 #include <WiFi.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
+#include <AsyncJson.h>
 #include <WiFiManager.h>
 
 #include <ArduinoJson.h>
@@ -116,128 +117,108 @@
 
 #include <ArduinoOTA.h>
 #include <time.h>
+#include <sys/time.h>
+#include <atomic>
+#include <memory>
 #include <Wire.h>
 
 #include "config.h"
+#include "debug.h"
+#include "AppConfig.h"
+#include "ClockFace.h"
 #include "timezones.h"
 #include "TetrisClock.h"
 #include "MorphingDigit.h"
+#include "DotTileCache.h"
+#include "Color565.h"
+#include "MorphPairs.h"
+#include "DirtyRects.h"
+#include "MirrorStream.h"
+#include "TripleBuffer.h"
+#include "PerfStats.h"
+#include "PowerScaling.h"
+#include "I2CBus.h"
 
 // Touch controller library
 #if ENABLE_TOUCH
   #include <Adafruit_FT6206.h>
 #endif
 
-// Sensor libraries (only one will be used based on config.h)
-#ifdef USE_BME280
-  #include <Adafruit_BME280.h>
-#endif
-#ifdef USE_BMP280
-  #include <Adafruit_BMP280.h>
-#endif
-#ifdef USE_BMP180
-  #include <Adafruit_BMP085.h>
-#endif
-#ifdef USE_SHT3X
-  #include <Adafruit_SHT31.h>
-#endif
-#ifdef USE_HTU21D
-  #include <Adafruit_HTU21DF.h>
-#endif
-
-
-// =========================
-// Debug System
-// =========================
-/**
- * Leveled debug logging system with runtime control
- *
- * DEBUG LEVELS:
- *   0 = Off      - No debug output
- *   1 = Error    - Critical errors only
- *   2 = Warn     - Warnings + Errors
- *   3 = Info     - General info + Warnings + Errors (default)
- *   4 = Verbose  - All debug output including frequent events
- *
- * USAGE:
- *   DBG_ERROR(...)   - Critical errors (level 1+)
- *   DBG_WARN(...)    - Warnings (level 2+)
- *   DBG_INFO(...)    - General information (level 3+)
- *   DBG_VERBOSE(...) - Verbose/frequent output (level 4)
- *
- * RUNTIME CONTROL:
- *   Set debugLevel variable (0-4) to change verbosity at runtime
- *   Can be controlled via web API or serial commands
- *
- * EXAMPLES:
- *   DBG_ERROR("Failed to mount filesystem\n");
- *   DBG_INFO("WiFi connected: %s\n", WiFi.SSID().c_str());
- *   DBG_VERBOSE("Render frame: %d ms\n", elapsed);
- */
-#ifndef DEBUG_LEVEL
-#define DEBUG_LEVEL 3  // Default: Info level
-#endif
+// Sensor drivers (detected on the I2C bus at boot, see Sensors::scan())
+#include "SensorDriver.h"
+#include "SensorHistory.h"
 
-#define DBG_LEVEL_OFF     0
-#define DBG_LEVEL_ERROR   1
-#define DBG_LEVEL_WARN    2
-#define DBG_LEVEL_INFO    3
-#define DBG_LEVEL_VERBOSE 4
-
-// Runtime debug level control (can be changed via web API)
-static uint8_t debugLevel = DEBUG_LEVEL;
-
-// Conditional debug macros based on debug level
-#define DBG_ERROR(...)   do { if (debugLevel >= DBG_LEVEL_ERROR) { Serial.print("[ERR ] "); Serial.printf(__VA_ARGS__); } } while(0)
-#define DBG_WARN(...)    do { if (debugLevel >= DBG_LEVEL_WARN) { Serial.print("[WARN] "); Serial.printf(__VA_ARGS__); } } while(0)
-#define DBG_INFO(...)    do { if (debugLevel >= DBG_LEVEL_INFO) { Serial.print("[INFO] "); Serial.printf(__VA_ARGS__); } } while(0)
-#define DBG_VERBOSE(...) do { if (debugLevel >= DBG_LEVEL_VERBOSE) { Serial.print("[VERB] "); Serial.printf(__VA_ARGS__); } } while(0)
-
-// Legacy compatibility macros
-#define DBG(...)      DBG_INFO(__VA_ARGS__)
-#define DBGLN(s)      DBG_INFO("%s\n", s)
-#define DBG_STEP(s)   DBG_INFO("%s\n", s)
-#define DBG_OK(s)     DBG_INFO("✓ %s\n", s)
-#define DBG_ERR(s)    DBG_ERROR("%s\n", s)
 
 // =========================
 // Global Objects & Application State
 // =========================
+uint8_t debugLevel = DEBUG_LEVEL;  // Runtime debug level (see debug.h)
+
 TFT_eSPI tft = TFT_eSPI();
 
-WebServer server(HTTP_PORT);
+AsyncWebServer server(HTTP_PORT);  // Event-driven: handlers run in the AsyncTCP task, never in the render loop
+AsyncWebSocket mirrorSocket(MIRROR_WS_PATH);  // Live mirror stream on the same server (see MirrorStream.h)
 Preferences prefs;
 
 // Touch controller object
 #if ENABLE_TOUCH
   Adafruit_FT6206 touch = Adafruit_FT6206();
   unsigned long lastTouchTime = 0;      // For touch debouncing
-  unsigned long touchStartTime = 0;     // When touch began
   unsigned long infoPageStartTime = 0;  // When info page was activated
-  bool touchHeld = false;               // Is touch being held down
   bool infoPageActive = false;          // Is info page currently displayed
   uint8_t infoPageNum = 0;              // Current info page (0=settings, 1=diagnostics)
-  TS_Point lastTouchPoint;              // Store touch point while finger is down
+
+  // Gestures recognized by the touch task (see touchTask())
+  enum TouchGesture : uint8_t {
+    TOUCH_TAP = 0,
+    TOUCH_LONG_PRESS,   // Sent while the finger is still down
+    TOUCH_SWIPE_LEFT,
+    TOUCH_SWIPE_RIGHT,
+    TOUCH_SWIPE_UP,
+    TOUCH_SWIPE_DOWN
+  };
+
+  struct TouchEvent {
+    TouchGesture gesture;
+    int16_t x, y;       // Screen coordinates where the finger went down
+    uint32_t ms;        // millis() when the gesture was recognized
+  };
+
+  static QueueHandle_t touchEvents = nullptr;      // Touch task -> render task
+  static TaskHandle_t touchTaskHandle = nullptr;   // Woken by the IRQ line
 
   #define INFO_PAGE_TIMEOUT_MS 30000    // Auto-exit info pages after 30s of inactivity
 #endif
 
-// Sensor objects (only one will be initialized based on configuration)
-#ifdef USE_BME280
-  Adafruit_BME280 bme280;
-#endif
-#ifdef USE_BMP280
-  Adafruit_BMP280 bmp280(&Wire);
-#endif
-#ifdef USE_BMP180
-  Adafruit_BMP085 bmp180;
-#endif
-#ifdef USE_SHT3X
-  Adafruit_SHT31 sht3x = Adafruit_SHT31();
-#endif
-#ifdef USE_HTU21D
-  Adafruit_HTU21DF htu21d = Adafruit_HTU21DF();
-#endif
+// Periodic measurement state, advanced by sensorPoll() on the network task.
+// The sensors found by Sensors::scan() are measured one after another:
+// IDLE -> STARTING (start() queued) -> CONVERTING (until readyMs)
+//      -> STEPPING (step() queued) -> CONVERTING again, or done -> next sensor
+// and once the last one is done their readings are merged and applied.
+enum SensorPhase : uint8_t {
+  SENSOR_IDLE = 0,
+  SENSOR_STARTING,
+  SENSOR_CONVERTING,
+  SENSOR_STEPPING
+};
+
+static SensorPhase sensorPhase = SENSOR_IDLE;
+static uint8_t sensorIndex = 0;         // Sensor being measured
+static I2CRequest sensorRequest;        // Completion of the queued start()/step() job
+static volatile int32_t sensorJobResult = 0;  // Its return value (ms to wait, 0 done, -1 error)
+static SensorReading sensorReadings[SENSOR_MAX_DEVICES];  // Values collected by step(), per sensor
+static bool sensorValid[SENSOR_MAX_DEVICES];              // Reading complete and plausible
+static uint32_t sensorStartMs = 0;      // When the current sensor's measurement was queued
+static uint32_t sensorReadyMs = 0;      // When to queue the next step()
+
+// Measurement statistics per sensor (diagnostics page, /api/perf)
+struct SensorStats {
+  uint32_t measurements;
+  uint32_t errors;
+  uint32_t lastConversionMs;  // Trigger to result, including queue and poll latency
+  uint32_t maxConversionMs;
+};
+static SensorStats sensorStats[SENSOR_MAX_DEVICES];
 
 // Helper macro to get effective status bar height based on clock mode
 // Morphing Remix mode (CLOCK_MODE_MORPH) automatically hides status bar for full display height
@@ -245,43 +226,6 @@ Preferences prefs;
   (cfg.clockMode == CLOCK_MODE_MORPH) ? 0 : STATUS_BAR_H \
 )
 
-struct AppConfig {
-  char tz[48]   = DEFAULT_TZ;
-  char ntp[64]  = DEFAULT_NTP;
-  bool use24h   = DEFAULT_24H;
-  uint8_t dateFormat = 0;  // 0=YYYY-MM-DD, 1=DD/MM/YYYY, 2=MM/DD/YYYY, 3=DD.MM.YYYY, 4=Mon DD YYYY
-
-  uint8_t ledDiameter = DEFAULT_LED_DIAMETER;
-  uint8_t ledGap      = DEFAULT_LED_GAP;
-
-  // LED color in 24-bit for web + convert to 565 for TFT
-  uint32_t ledColor = 0xFF0000; // red
-  uint8_t brightness = 255;     // 0..255
-
-  bool flipDisplay = false;    // false=rotation 1 (IO ports top, USB left), true=rotation 3 (180° flip)
-
-  // Morphing animation speed (multiplier: 1=fast, 10=very slow)
-  uint8_t morphSpeed = 1;      // 1-10, controls digit morphing duration
-
-  // Clock display mode settings
-  uint8_t clockMode = DEFAULT_CLOCK_MODE;           // 0=7-seg, 1=Tetris, 2=Morph Remix
-  bool autoRotate = DEFAULT_AUTO_ROTATE;            // Auto-rotate through modes
-  uint8_t rotateInterval = DEFAULT_ROTATE_INTERVAL; // Minutes between rotations
-
-  // Sensor settings
-  bool useFahrenheit = false;   // false=Celsius, true=Fahrenheit
-
-  // Morphing (Remix) mode display options
-  bool morphShowSensor = true;  // Show sensor data at top in Morph Remix mode
-  bool morphShowDate = true;    // Show date at bottom in Morph Remix mode
-  uint32_t morphSensorColor = 0xFFFF00;  // Sensor text color (default: yellow)
-  uint32_t morphDateColor = 0xFFFF00;    // Date text color (default: yellow)
-
-  // Touch calibration offsets (for fine-tuning touch coordinate mapping)
-  int16_t touchOffsetX = 0;     // X offset adjustment (-50 to +50)
-  int16_t touchOffsetY = 0;     // Y offset adjustment (-50 to +50)
-};
-
 AppConfig cfg;
 
 // Sensor state variables
@@ -289,352 +233,76 @@ bool sensorAvailable = false;
 int temperature = 0;
 int humidity = 0;
 int pressure = 0;
-const char* sensorType = "NONE";  // Will be set based on detected sensor
+uint8_t sensorMeasures = 0;       // SENSOR_* flags of the detected sensors
+static char sensorNames[48] = "NONE";
+const char* sensorType = sensorNames;  // Detected sensors, e.g. "SHT3X + BMP280"
 unsigned long lastSensorUpdate = 0;
 
-// Logical RGB LED Matrix (HUB75) framebuffer: RGB565 color
-static uint16_t fb[LED_MATRIX_H][LED_MATRIX_W];
-static uint16_t fbPrev[LED_MATRIX_H][LED_MATRIX_W];  // Previous frame for delta rendering
+alignas(4) static uint16_t fbPrev[LED_MATRIX_H][LED_MATRIX_W];  // Previous frame for delta rendering (aligned for diffFrames())
 
-// =========================
-// Small 3x5 Bitmap Font for LED Matrix
-// =========================
-// Simple 3-pixel wide, 5-pixel tall font for displaying text on matrix
-// Each character is represented as 5 bytes (one per row)
-// Bit layout: bits 0-2 are the 3 columns (LSB = left column)
-
-const uint8_t font3x5[][5] = {
-  {0b111, 0b101, 0b101, 0b101, 0b111}, // 0
-  {0b010, 0b110, 0b010, 0b010, 0b111}, // 1
-  {0b111, 0b001, 0b111, 0b100, 0b111}, // 2
-  {0b111, 0b001, 0b111, 0b001, 0b111}, // 3
-  {0b101, 0b101, 0b111, 0b001, 0b001}, // 4
-  {0b111, 0b100, 0b111, 0b001, 0b111}, // 5
-  {0b111, 0b100, 0b111, 0b101, 0b111}, // 6
-  {0b111, 0b001, 0b001, 0b001, 0b001}, // 7
-  {0b111, 0b101, 0b111, 0b101, 0b111}, // 8
-  {0b111, 0b101, 0b111, 0b001, 0b111}, // 9
-  {0b000, 0b000, 0b000, 0b000, 0b000}, // : (space)
-  {0b000, 0b000, 0b000, 0b000, 0b000}, // ; (space)
-  {0b000, 0b000, 0b000, 0b000, 0b000}, // < (space)
-  {0b000, 0b000, 0b000, 0b000, 0b000}, // = (space)
-  {0b000, 0b000, 0b000, 0b000, 0b000}, // > (space)
-  {0b000, 0b000, 0b000, 0b000, 0b000}, // ? (space)
-  {0b000, 0b000, 0b000, 0b000, 0b000}, // @ (space)
-  {0b111, 0b101, 0b111, 0b101, 0b101}, // A
-  {0b110, 0b101, 0b110, 0b101, 0b110}, // B
-  {0b111, 0b100, 0b100, 0b100, 0b111}, // C
-  {0b110, 0b101, 0b101, 0b101, 0b110}, // D
-  {0b111, 0b100, 0b111, 0b100, 0b111}, // E
-  {0b111, 0b100, 0b111, 0b100, 0b100}, // F
-  {0b111, 0b100, 0b101, 0b101, 0b111}, // G
-  {0b101, 0b101, 0b111, 0b101, 0b101}, // H
-  {0b111, 0b010, 0b010, 0b010, 0b111}, // I
-  {0b111, 0b001, 0b001, 0b101, 0b111}, // J
-  {0b101, 0b101, 0b110, 0b101, 0b101}, // K
-  {0b100, 0b100, 0b100, 0b100, 0b111}, // L
-  {0b101, 0b111, 0b111, 0b101, 0b101}, // M
-  {0b101, 0b111, 0b111, 0b111, 0b101}, // N
-  {0b111, 0b101, 0b101, 0b101, 0b111}, // O
-  {0b111, 0b101, 0b111, 0b100, 0b100}, // P
-  {0b111, 0b101, 0b101, 0b111, 0b001}, // Q
-  {0b111, 0b101, 0b110, 0b101, 0b101}, // R
-  {0b111, 0b100, 0b111, 0b001, 0b111}, // S (same as 5)
-  {0b111, 0b010, 0b010, 0b010, 0b010}, // T
-  {0b101, 0b101, 0b101, 0b101, 0b111}, // U
-  {0b101, 0b101, 0b101, 0b101, 0b010}, // V
-  {0b101, 0b101, 0b111, 0b111, 0b101}, // W
-  {0b101, 0b101, 0b010, 0b101, 0b101}, // X
-  {0b101, 0b101, 0b010, 0b010, 0b010}, // Y
-  {0b111, 0b001, 0b010, 0b100, 0b111}, // Z
+// Completed frames handed from the render task to the web mirror (lock-free)
+struct FrameBuffer {
+  uint16_t px[LED_MATRIX_H][LED_MATRIX_W];
 };
-
-// Character offset: '0' = index 0, 'A' = index 17
-static int getFont3x5Index(char c) {
-  if (c >= '0' && c <= '9') return c - '0';
-  if (c >= 'A' && c <= 'Z') return c - 'A' + 17;
-  if (c >= 'a' && c <= 'z') return c - 'a' + 17; // lowercase -> uppercase
-  return 10; // space for unknown chars
-}
-
-// Draw a single character using the 3x5 font
-// Fixed: Draw correctly without horizontal flip
-static void drawChar3x5(char c, int x, int y, uint16_t color) {
-  int idx = getFont3x5Index(c);
-  const uint8_t* glyph = font3x5[idx];
-
-  for (int row = 0; row < 5; row++) {
-    for (int col = 0; col < 3; col++) {
-      // Font bits: bit 0 is rightmost, bit 2 is leftmost
-      // We need to draw col 0 at x, col 2 at x+2 (not flipped)
-      // So check bit (2-col) instead of col
-      if (glyph[row] & (1 << (2 - col))) {
-        int px = x + col;
-        int py = y + row;
-        if (px >= 0 && px < LED_MATRIX_W && py >= 0 && py < LED_MATRIX_H) {
-          fb[py][px] = color;
-        }
-      }
-    }
-  }
-}
-
-// Calculate the width of a string using the 3x5 font
-static int getTextWidth3x5(const char* text) {
-  int width = 0;
-  while (*text) {
-    if (*text == ' ') {
-      width += 3;
-    } else if (*text == '.') {
-      width += 2;
-    } else if (*text == '/') {
-      width += 3;
-    } else if (*text == '-') {
-      width += 4;
-    } else if (*text == '%') {
-      width += 4;
-    } else {
-      width += 4;  // 3 pixels + 1 pixel spacing
-    }
-    text++;
-  }
-  return width;
-}
-
-// Draw a string using the 3x5 font
-static void drawText3x5(const char* text, int x, int y, uint16_t color) {
-  int cursorX = x;
-  while (*text) {
-    if (*text == ' ') {
-      cursorX += 3; // space width (reduced from 4)
-    } else if (*text == '.') {
-      // Draw a dot (period) - single pixel at bottom
-      if (cursorX >= 0 && cursorX < LED_MATRIX_W && y + 4 >= 0 && y + 4 < LED_MATRIX_H) {
-        fb[y + 4][cursorX] = color;
-      }
-      cursorX += 2;
-    } else if (*text == '/') {
-      // Draw a forward slash - diagonal line from bottom-left to top-right
-      // Row 0: x+2, Row 1: x+2, Row 2: x+1, Row 3: x+1, Row 4: x+0
-      for (int row = 0; row < 5; row++) {
-        int px = cursorX + (2 - row / 2);  // Creates pattern: 2,2,1,1,0
-        int py = y + row;
-        if (px >= 0 && px < LED_MATRIX_W && py >= 0 && py < LED_MATRIX_H) {
-          fb[py][px] = color;
-        }
-      }
-      cursorX += 3;
-    } else if (*text == '-') {
-      // Draw a dash/minus - horizontal line in middle
-      for (int px = cursorX; px < cursorX + 3; px++) {
-        if (px >= 0 && px < LED_MATRIX_W && y + 2 >= 0 && y + 2 < LED_MATRIX_H) {
-          fb[y + 2][px] = color;
-        }
-      }
-      cursorX += 4;
-    } else if (*text == '%') {
-      // Draw percent sign - dot, slash, dot pattern
-      // Top dot at (0,0)
-      if (y >= 0 && y < LED_MATRIX_H && cursorX >= 0 && cursorX < LED_MATRIX_W) {
-        fb[y][cursorX] = color;
-      }
-      // Diagonal slash
-      if (y + 1 >= 0 && y + 1 < LED_MATRIX_H && cursorX + 1 >= 0 && cursorX + 1 < LED_MATRIX_W) {
-        fb[y + 1][cursorX + 1] = color;
-      }
-      if (y + 2 >= 0 && y + 2 < LED_MATRIX_H && cursorX + 1 >= 0 && cursorX + 1 < LED_MATRIX_W) {
-        fb[y + 2][cursorX + 1] = color;
-      }
-      if (y + 3 >= 0 && y + 3 < LED_MATRIX_H && cursorX + 2 >= 0 && cursorX + 2 < LED_MATRIX_W) {
-        fb[y + 3][cursorX + 2] = color;
-      }
-      // Bottom dot at (2,4)
-      if (y + 4 >= 0 && y + 4 < LED_MATRIX_H && cursorX + 2 >= 0 && cursorX + 2 < LED_MATRIX_W) {
-        fb[y + 4][cursorX + 2] = color;
-      }
-      cursorX += 4;  // Reduced from 6 for tighter spacing
-    } else {
-      drawChar3x5(*text, cursorX, y, color);
-      cursorX += 4; // 3 pixels + 1 pixel spacing
-    }
-    text++;
-  }
-}
-
-// Cached date string for status bar (13 chars for "Mon DD, YYYY" format + null)
-static char currDate[14] = "----/--/--";
+static TripleBuffer<FrameBuffer> frames;
+static MirrorStream mirrorStream;  // Per-client delta state for the WebSocket mirror
+
+// Latest frame on the network side. The network task is the only consumer of
+// `frames`; async HTTP handlers copy from this snapshot under its mutex.
+static FrameBuffer mirrorFrame;
+static uint32_t mirrorFrameId = 0;
+static SemaphoreHandle_t mirrorFrameMutex = nullptr;
+
+// Display ownership: only the render task touches the TFT, fb and render
+// state. Web config changes are posted to it (applyPendingConfig()); OTA
+// takes the display over with takeDisplay() for the rest of the update.
+static volatile bool otaActive = false;    // OTA screen owns the TFT; render task idles
+static volatile bool renderParked = false;  // Render task has seen otaActive and stopped drawing
+static SemaphoreHandle_t displayHandoff = nullptr;  // Given by the render task when it parks
 
 // Rendering pitch (logical LED -> TFT pixels, computed from TFT size + config)
 static int fbPitch = 2;
 
+// Pre-rendered round/glow LED tiles (square LEDs are drawn without tiles)
+static DotTileCache dotTiles(DOT_TILE_CACHE_BYTES);
+
 // Clock mode management
-TetrisClock* tetrisClock = nullptr;  // Tetris clock instance (created in setup)
 unsigned long lastModeRotation = 0;  // Last time clock mode was rotated
 const uint8_t TOTAL_CLOCK_MODES = 3; // 0=7-seg, 1=Tetris, 2=Morph
 
-// Morphing clock digits (for CLOCK_MODE_MORPH)
-MorphingDigit morphHourTens, morphHourUnits;
-MorphingDigit morphMinuteTens, morphMinuteUnits;
-MorphingDigit morphSecondTens, morphSecondUnits;
-unsigned long lastMorphUpdate = 0;  // Last morphing animation update time
-bool clockColon = true;              // Colon blink state
+// Render loop timing
 unsigned long lastColonToggle = 0;   // Last colon toggle time
 unsigned long lastTetrisUpdate = 0;  // Last Tetris animation update time
 bool firstRender = true;             // Force initial render after boot
 
-// Forward declarations
-static void switchClockMode(uint8_t newMode);
-
-// =========================
-// Status LED (not available on ESP32 Touchdown)
-// Consider using GPIO breakout pins if status indication is needed
-// =========================
-// Utility Functions
-// =========================
-
-/**
- * Convert 24-bit RGB (0xRRGGBB) to 16-bit RGB565 format for TFT display
- * @param rgb 24-bit RGB color value
- * @return 16-bit RGB565 color value
- */
-static uint16_t rgb888_to_565(uint32_t rgb) {
-  uint8_t r = (rgb >> 16) & 0xFF;
-  uint8_t g = (rgb >> 8) & 0xFF;
-  uint8_t b = (rgb >> 0) & 0xFF;
-  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-}
+// Frame scheduler: the render task sleeps until its next deadline (see
+// renderSleepMs()); requestRender() wakes it early for a redraw
+static TaskHandle_t renderTaskHandle = nullptr;
+static volatile bool renderRequested = false;
 
 /**
- * Clear the entire framebuffer to a specific color
- * @param color RGB565 color value, default 0 (black/off)
+ * Wake the render task before its next deadline (touch events, redraws)
  */
-static void fbClear(uint16_t color = 0) {
-  for (int y = 0; y < LED_MATRIX_H; y++) {
-    for (int x = 0; x < LED_MATRIX_W; x++) {
-      fb[y][x] = color;
-    }
-  }
+static void wakeRenderTask() {
+  if (renderTaskHandle) xTaskNotifyGive(renderTaskHandle);
 }
 
 /**
- * Set a single pixel in the framebuffer with bounds checking
- * @param x X coordinate (0 to LED_MATRIX_W-1)
- * @param y Y coordinate (0 to LED_MATRIX_H-1)
- * @param color RGB565 color value
+ * Redraw the clock on the next render step and wake the render task
+ * Call after anything that changes what the clock shows outside the render task.
  */
-static inline void fbSet(int x, int y, uint16_t color) {
-  if (x < 0 || y < 0 || x >= LED_MATRIX_W || y >= LED_MATRIX_H) return;
-  fb[y][x] = color;
-}
-
-// =========================
-// 7-Segment Digit Bitmaps & Layout Constants
-// =========================
-static const int DIGIT_W = 9;       // Width of each digit in pixels (9px fits HH:MM:SS with gaps in 64px)
-static const int DIGIT_H = LED_MATRIX_H;  // Height matches full matrix height (32px)
-static const int COLON_W = 2;       // Width of colon separator
-static const int DIGIT_GAP = 1;     // 1px gap between digits for improved readability
-
-struct Bitmap {
-  uint16_t rows[DIGIT_H];  // each row is 16 bits, MSB left
-};
-
-static Bitmap DIGITS[10];  // Array of digit bitmaps (0-9)
-static Bitmap COLON;       // Colon separator bitmap
-
-/**
- * Generate a 7-segment style digit bitmap
- * Segments are labeled a-g in standard 7-segment notation:
- *     aaa
- *    f   b
- *     ggg
- *    e   c
- *     ddd
- * @param d Digit value (0-9)
- * @return Bitmap structure containing the rendered digit
- */
-static Bitmap makeDigit7Seg(uint8_t d) {
-  bool seg[7] = {0};
-  switch (d) {
-    case 0: seg[0]=seg[1]=seg[2]=seg[3]=seg[4]=seg[5]=1; break;
-    case 1: seg[1]=seg[2]=1; break;
-    case 2: seg[0]=seg[1]=seg[6]=seg[4]=seg[3]=1; break;
-    case 3: seg[0]=seg[1]=seg[6]=seg[2]=seg[3]=1; break;
-    case 4: seg[5]=seg[6]=seg[1]=seg[2]=1; break;
-    case 5: seg[0]=seg[5]=seg[6]=seg[2]=seg[3]=1; break;
-    case 6: seg[0]=seg[5]=seg[6]=seg[4]=seg[2]=seg[3]=1; break;
-    case 7: seg[0]=seg[1]=seg[2]=1; break;
-    case 8: seg[0]=seg[1]=seg[2]=seg[3]=seg[4]=seg[5]=seg[6]=1; break;
-    case 9: seg[0]=seg[1]=seg[2]=seg[3]=seg[5]=seg[6]=1; break;
-    default: break;
-  }
-
-  Bitmap bm{};
-  for (int y=0; y<DIGIT_H; y++) bm.rows[y]=0;
-
-  auto setPx = [&](int x, int y){
-    if (x<0||y<0||x>=DIGIT_W||y>=DIGIT_H) return;
-    bm.rows[y] |= (1u << (15-x));
-  };
-
-  const int padX = 0;
-  const int padY = 1;
-  const int th = 4;
-  const int w = DIGIT_W;
-  const int h = DIGIT_H;
-  const int midY = h/2;
-
-  if (seg[0]) for(int y=padY; y<padY+th; y++) for(int x=padX; x<w-padX; x++) setPx(x,y);            // a
-  if (seg[3]) for(int y=h-padY-th; y<h-padY; y++) for(int x=padX; x<w-padX; x++) setPx(x,y);          // d
-  if (seg[6]) for(int y=midY - th/2; y<midY - th/2 + th; y++) for(int x=padX; x<w-padX; x++) setPx(x,y); // g
-
-  if (seg[5]) for(int x=padX; x<padX+th; x++) for(int y=padY; y<midY; y++) setPx(x,y);               // f
-  if (seg[1]) for(int x=w-padX-th; x<w-padX; x++) for(int y=padY; y<midY; y++) setPx(x,y);           // b
-  if (seg[4]) for(int x=padX; x<padX+th; x++) for(int y=midY; y<h-padY; y++) setPx(x,y);             // e
-  if (seg[2]) for(int x=w-padX-th; x<w-padX; x++) for(int y=midY; y<h-padY; y++) setPx(x,y);         // c
-
-  return bm;
+static void requestRender() {
+  renderRequested = true;
+  wakeRenderTask();
 }
 
-/**
- * Initialize all digit and colon bitmaps
- * Called once during setup to pre-render all characters
- */
-static void initBitmaps() {
-  DBG_STEP("Building digit bitmaps...");
-  for (int i=0;i<10;i++) DIGITS[i] = makeDigit7Seg(i);
-
-  for (int y=0;y<DIGIT_H;y++) COLON.rows[y]=0;
-  auto setPx = [&](int x, int y){
-    if (x<0||y<0||x>=COLON_W||y>=DIGIT_H) return;
-    COLON.rows[y] |= (1u << (15-x));
-  };
-  for(int yy=10; yy<13; yy++) for(int xx=0; xx<COLON_W; xx++) setPx(xx,yy);
-  for(int yy=19; yy<22; yy++) for(int xx=0; xx<COLON_W; xx++) setPx(xx,yy);
-
-  DBG_OK("Digit bitmaps ready.");
-}
+// Forward declarations
+static void switchClockMode(uint8_t newMode);
+static void invalidateStateCache();
 
 // =========================
-// Morphing Helper Functions
-// =========================
-
-struct Pt { int8_t x, y; };
-
-static int buildPixelsFromBitmap(const Bitmap& bm, int w, Pt* out, int maxOut) {
-  int n = 0;
-  for (int y = 0; y < DIGIT_H; y++) {
-    uint16_t row = bm.rows[y];
-    for (int x = 0; x < w; x++) {
-      bool on = (row >> (15 - x)) & 0x1;
-      if (!on) continue;
-      if (n < maxOut) out[n] = Pt{(int8_t)x, (int8_t)y};
-      n++;
-    }
-  }
-  return n;
-}
-
+// Status LED (not available on ESP32 Touchdown)
+// Consider using GPIO breakout pins if status indication is needed
 // =========================
 // Backlight (PWM if TFT_BL exists)
 // =========================
@@ -681,6 +349,7 @@ static void updateRenderPitch(bool force = false) {
   int pitch = computeRenderPitch();
   if (!force && pitch == fbPitch) return;
   fbPitch = pitch;
+  dotTiles.invalidate();  // Tiles are cell-sized, so every cached tile is now the wrong size
 }
 
 // Forward declaration
@@ -696,6 +365,27 @@ static void resetStatusBar() {
   g_forceStatusBarRedraw = true;
 }
 
+/**
+ * Format the sensor line of the status bar: temperature, then humidity and
+ * pressure if a detected sensor measures them
+ */
+static void formatSensorLine(char* buf, size_t len, int displayTemp, const char* tempUnit) {
+  char tempStr[32];
+  snprintf(tempStr, sizeof(tempStr), "Temp: %d%s", displayTemp, tempUnit);
+
+  const bool hasHum = sensorMeasures & SENSOR_HUMIDITY;
+  const bool hasPres = sensorMeasures & SENSOR_PRESSURE;
+  if (hasHum && hasPres) {
+    snprintf(buf, len, "%s  Humid: %d%%  Press: %dhPa", tempStr, humidity, pressure);
+  } else if (hasPres) {
+    snprintf(buf, len, "%s  Pressure: %d hPa", tempStr, pressure);
+  } else if (hasHum) {
+    snprintf(buf, len, "%s  Humidity: %d%%", tempStr, humidity);
+  } else {
+    snprintf(buf, len, "%s", tempStr);
+  }
+}
+
 static void drawStatusBar() {
 #if STATUS_BAR_H > 0
   // Get mode-specific status bar height (0 for Morph Remix when enabled)
@@ -714,24 +404,7 @@ static void drawStatusBar() {
   if (sensorAvailable) {
     int displayTemp = cfg.useFahrenheit ? (temperature * 9 / 5 + 32) : temperature;
     const char* tempUnit = cfg.useFahrenheit ? "oF" : "oC";  // Using 'o' as degree symbol
-
-    // Build status string based on sensor capabilities
-    char tempStr[32];
-    snprintf(tempStr, sizeof(tempStr), "Temp: %d%s", displayTemp, tempUnit);
-
-#if defined(USE_BME280)
-    // BME280 has all three: temp, humidity, pressure
-    snprintf(line1, sizeof(line1), "%s  Humid: %d%%  Press: %dhPa", tempStr, humidity, pressure);
-#elif defined(USE_BMP280) || defined(USE_BMP180)
-    // BMP280/BMP180 have temp and pressure only
-    snprintf(line1, sizeof(line1), "%s  Pressure: %d hPa", tempStr, pressure);
-#elif defined(USE_SHT3X) || defined(USE_HTU21D)
-    // SHT3X/HTU21D have temp and humidity only
-    snprintf(line1, sizeof(line1), "%s  Humidity: %d%%", tempStr, humidity);
-#else
-    // Unknown sensor, just show temp
-    snprintf(line1, sizeof(line1), "%s", tempStr);
-#endif
+    formatSensorLine(line1, sizeof(line1), displayTemp, tempUnit);
   } else {
     snprintf(line1, sizeof(line1), "Sensor: Not detected");
   }
@@ -747,6 +420,7 @@ static void drawStatusBar() {
 
   // Only redraw if content actually changed (prevents flashing every second)
   if (!changed) return;
+  PERF_SCOPE(PERF_STATUS_BAR);  // Only actual redraws are timed
 
   // Clear force flag and update cache
   g_forceStatusBarRedraw = false;
@@ -768,7 +442,18 @@ static void drawStatusBar() {
 #endif
 }
 
-static void renderFBToTFT() {
+/**
+ * LED-to-TFT geometry for the current clock mode
+ * Shared by the delta renderer and the dirty-rectangle pusher
+ */
+struct LedGeometry {
+  int x0, y0;          // TFT position of the LED (0,0) cell (may be negative when clipped)
+  int pitchX, pitchY;  // TFT pixels per LED cell
+  int dot;             // Rendered LED dot size (square)
+  int insetX, insetY;  // Dot offset inside its cell
+};
+
+static LedGeometry computeLedGeometry() {
   // For Morph Remix mode (CLOCK_MODE_MORPH), use non-square pixels to fill full 480×320 screen
   // Other modes use square pixels with standard pitch
   int pitchX, pitchY;
@@ -790,18 +475,18 @@ static void renderFBToTFT() {
   int matrixAreaH = tft.height() - GET_STATUS_BAR_H();
   if (matrixAreaH < sprH) matrixAreaH = tft.height();
 
-  int x0, y0;
+  LedGeometry g;
   if (cfg.clockMode == CLOCK_MODE_MORPH) {
     // Morph Remix mode: center both horizontally and vertically
     // pitchX=8, pitchY=9: 64*8=512px width, 32*9=288px height
     // Center horizontally: (480-512)/2 = -16 (will clip left/right edges)
     // Center vertically: (320-288)/2 = 16 (margins top/bottom)
-    x0 = (tft.width()  - sprW) / 2;  // Center horizontally
-    y0 = (tft.height() - sprH) / 2;  // Center vertically
+    g.x0 = (tft.width()  - sprW) / 2;  // Center horizontally
+    g.y0 = (tft.height() - sprH) / 2;  // Center vertically
   } else {
     // Other modes: center in matrix area with square pixels
-    x0 = (tft.width()  - sprW) / 2;
-    y0 = (matrixAreaH - sprH) / 2;
+    g.x0 = (tft.width()  - sprW) / 2;
+    g.y0 = (matrixAreaH - sprH) / 2;
   }
 
   // Calculate LED dot size based on pitch (use pitchX for gap/dot calculation)
@@ -816,15 +501,264 @@ static void renderFBToTFT() {
   if (dot > maxDot) dot = maxDot;
   if (dot < 1) dot = 1;
 
-  int gap = pitch - dot;
-  const int insetX = (pitchX - dot) / 2;
-  const int insetY = (pitchY - dot) / 2;
+  g.pitchX = pitchX;
+  g.pitchY = pitchY;
+  g.dot = dot;
+  g.insetX = (pitchX - dot) / 2;
+  g.insetY = (pitchY - dot) / 2;
+  return g;
+}
+
+// =========================
+// Dirty-rectangle rendering (coalescing is in DirtyRects.h)
+// =========================
+
+static const int TFT_LINE_MAX = 480;  // Longest TFT row (ILI9488 in landscape)
+
+// Render statistics for the most recent frame that changed any LED
+static uint32_t spiWindowsLastFrame = 0;   // TFT address windows (SPI transactions) opened
+static uint32_t changedLedsLastFrame = 0;  // LEDs that differed from fbPrev
+
+static uint32_t frameSpiWindows = 0;   // Counters for the frame being rendered
+static uint32_t frameChangedLeds = 0;
+
+/**
+ * Push a dirty rectangle of round/glow LEDs
+ * Off LEDs are cleared as whole cells with one fillRect; lit LEDs are blitted
+ * from the tile cache one cell per pushImage (tiles include the gap pixels).
+ */
+static void pushDirtyRectTiles(const DirtyRect& r, const LedGeometry& g) {
+  const int cellX = g.x0 + r.x * g.pitchX;
+  const int cellY = g.y0 + r.y * g.pitchY;
+
+  uint16_t* tile = nullptr;
+  if (r.color != TFT_BLACK) {
+    tile = dotTiles.get(r.color, cfg.ledShape, g.dot, g.pitchX, g.pitchY);
+  }
+
+  if (!tile) {
+    // Off LEDs (or a cell too large for the tile budget): solid fill of the whole cells
+    tft.fillRect(cellX, cellY, r.w * g.pitchX, r.h * g.pitchY, r.color);
+    frameSpiWindows++;
+    return;
+  }
+
+  for (int ly = 0; ly < r.h; ly++) {
+    for (int lx = 0; lx < r.w; lx++) {
+      tft.pushImage(cellX + lx * g.pitchX, cellY + ly * g.pitchY, g.pitchX, g.pitchY, tile);
+      frameSpiWindows++;
+    }
+  }
+}
+
+/**
+ * Push one dirty rectangle to the TFT using a single address window
+ * Gapless LEDs become one fillRect; otherwise the dot/gap pattern is streamed
+ * row by row (gaps written black) after clipping to the screen.
+ */
+static void pushDirtyRect(const DirtyRect& r, const LedGeometry& g) {
+  if (cfg.ledShape != LED_SHAPE_SQUARE) {
+    pushDirtyRectTiles(r, g);
+    return;
+  }
+
+  const int px = g.x0 + r.x * g.pitchX + g.insetX;
+  const int py = g.y0 + r.y * g.pitchY + g.insetY;
+  const int pw = (r.w - 1) * g.pitchX + g.dot;
+  const int ph = (r.h - 1) * g.pitchY + g.dot;
+
+  if (g.dot == g.pitchX && g.dot == g.pitchY) {
+    // No gaps between LEDs: the whole rectangle is one solid block (fillRect clips)
+    tft.fillRect(px, py, pw, ph, r.color);
+    frameSpiWindows++;
+    return;
+  }
+
+  // Clip to the screen (Morph Remix geometry hangs off the left/right edges)
+  const int cx0 = max(px, 0);
+  const int cy0 = max(py, 0);
+  const int cx1 = min(px + pw, min((int)tft.width(), cx0 + TFT_LINE_MAX));
+  const int cy1 = min(py + ph, (int)tft.height());
+  if (cx0 >= cx1 || cy0 >= cy1) return;
+  const int cw = cx1 - cx0;
+
+  // Every dot row of the rectangle has the same pattern: color on dots, black in gaps
+  static uint16_t line[TFT_LINE_MAX];
+  for (int i = 0; i < cw; i++) {
+    line[i] = ((cx0 + i - px) % g.pitchX < g.dot) ? r.color : TFT_BLACK;
+  }
+
+  tft.setAddrWindow(cx0, cy0, cw, cy1 - cy0);
+  for (int yy = cy0; yy < cy1; yy++) {
+    if ((yy - py) % g.pitchY < g.dot) tft.pushPixels(line, cw);
+    else tft.pushBlock(TFT_BLACK, cw);
+  }
+  frameSpiWindows++;
+}
+
+/**
+ * Coalesce the changed LEDs of fb into rectangles and push them
+ * Must be called inside tft.startWrite()/endWrite()
+ * @param d diffFrames() of fb against fbPrev
+ */
+static void pushDirtyRects(const LedGeometry& g, const FrameDiff& d) {
+  frameChangedLeds += collectDirtyRects(fb, d, [&](const DirtyRect& r) { pushDirtyRect(r, g); });
+}
+
+// =========================
+// Line-band renderer
+// =========================
+// Alternative to dirty rectangles: every LED row containing a change is
+// rasterized into a band buffer (one LED row x matrix width in TFT pixels) and
+// sent in a single pushImage. Two bands ping-pong so that, with DMA, the CPU
+// rasterizes band N+1 while band N is still on the SPI bus.
+//
+// TFT_eSPI only provides DMA (ESP32_DMA) for 16-bit SPI panels. The ILI9488
+// is driven in 18-bit mode, so on this board the bands are sent with a
+// blocking pushImage - still one address window per LED row.
+
+static uint16_t* bandBuf[2] = {nullptr, nullptr};
+static size_t bandBufPixels = 0;
+
+/**
+ * Make sure both band buffers hold at least the given number of pixels
+ * Buffers come from DMA-capable internal RAM and only ever grow.
+ * @return false if allocation failed (caller falls back to dirty rectangles)
+ */
+static bool ensureBandBuffers(size_t pixels) {
+  if (pixels <= bandBufPixels) return true;
+
+  for (int i = 0; i < 2; i++) {
+    heap_caps_free(bandBuf[i]);
+    bandBuf[i] = (uint16_t*)heap_caps_malloc(pixels * sizeof(uint16_t), MALLOC_CAP_DMA);
+  }
+
+  if (!bandBuf[0] || !bandBuf[1]) {
+    DBG_WARN("Render: band buffers (2 x %u bytes) unavailable, using delta path\n",
+             (unsigned)(pixels * sizeof(uint16_t)));
+    heap_caps_free(bandBuf[0]);
+    heap_caps_free(bandBuf[1]);
+    bandBuf[0] = bandBuf[1] = nullptr;
+    bandBufPixels = 0;
+    return false;
+  }
+
+  bandBufPixels = pixels;
+  return true;
+}
+
+/**
+ * Rasterize LED row y into a band of pitchY rows x cw pixels starting at TFT x cx0
+ */
+static void rasterizeBand(uint16_t* band, int y, int cx0, int cw, const LedGeometry& g) {
+  const size_t rowBytes = cw * sizeof(uint16_t);
+
+  if (cfg.ledShape == LED_SHAPE_SQUARE) {
+    // Square dots: build one dot row, copy it to the other dot rows, gap rows are black
+    uint16_t* dotRow = band + g.insetY * cw;
+    for (int i = 0; i < cw; i++) {
+      const int vx = cx0 + i - g.x0;
+      const int ox = vx % g.pitchX;
+      dotRow[i] = (ox >= g.insetX && ox < g.insetX + g.dot) ? fb[y][vx / g.pitchX] : TFT_BLACK;
+    }
+    for (int row = 0; row < g.pitchY; row++) {
+      if (row == g.insetY) continue;
+      if (row > g.insetY && row < g.insetY + g.dot) memcpy(band + row * cw, dotRow, rowBytes);
+      else memset(band + row * cw, 0, rowBytes);
+    }
+    return;
+  }
+
+  // Round/glow dots: copy tile rows cell by cell (cells may be clipped at the band edges)
+  const int firstLed = (cx0 - g.x0) / g.pitchX;
+  const int lastLed = (cx0 + cw - 1 - g.x0) / g.pitchX;
+  for (int lx = firstLed; lx <= lastLed; lx++) {
+    const int cellX = g.x0 + lx * g.pitchX;
+    const int s = max(cellX, cx0);
+    const int e = min(cellX + g.pitchX, cx0 + cw);
+    const uint16_t color = fb[y][lx];
+    const uint16_t* tile = color ? dotTiles.get(color, cfg.ledShape, g.dot, g.pitchX, g.pitchY) : nullptr;
+
+    for (int row = 0; row < g.pitchY; row++) {
+      uint16_t* out = band + row * cw + (s - cx0);
+      if (tile) {
+        memcpy(out, tile + row * g.pitchX + (s - cellX), (e - s) * sizeof(uint16_t));
+      } else {
+        // Off LED, or no tile budget for this pitch: plain square dot
+        const bool dotRow = row >= g.insetY && row < g.insetY + g.dot;
+        for (int px = s; px < e; px++) {
+          const int ox = px - cellX;
+          out[px - s] = (dotRow && ox >= g.insetX && ox < g.insetX + g.dot) ? color : TFT_BLACK;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Push every LED row that differs from fbPrev as one band
+ * Must be called inside tft.startWrite()/endWrite()
+ * @param d diffFrames() of fb against fbPrev
+ * @return false if band buffers are unavailable (nothing was drawn)
+ */
+static bool pushDirtyBands(const LedGeometry& g, const FrameDiff& d) {
+  // Horizontal extent of the matrix on screen (Morph Remix hangs off both edges)
+  const int cx0 = max(g.x0, 0);
+  const int cx1 = min(g.x0 + LED_MATRIX_W * g.pitchX, (int)tft.width());
+  const int cw = cx1 - cx0;
+  if (cw <= 0) return true;
+  if (!ensureBandBuffers((size_t)cw * g.pitchY)) return false;
+
+  int cur = 0;
+  for (uint32_t rows = d.rows; rows; rows &= rows - 1) {
+    const int y = __builtin_ctz(rows);
+    frameChangedLeds += __builtin_popcountll(d.cols[y]);
+
+    // Vertical clip of this band
+    const int by = g.y0 + y * g.pitchY;
+    const int r0 = max(0, -by);
+    const int r1 = min(g.pitchY, (int)tft.height() - by);
+    if (r0 >= r1) continue;
+
+    // With DMA, pushImageDMA() waits for the previous band before queueing this
+    // one, so the buffer rasterized next is never the one still being sent
+    uint16_t* band = bandBuf[cur];
+    rasterizeBand(band, y, cx0, cw, g);
+#if defined(USE_DMA_TO_TFT) && defined(ESP32_DMA)
+    tft.pushImageDMA(cx0, by + r0, cw, r1 - r0, band + r0 * cw);
+#else
+    tft.pushImage(cx0, by + r0, cw, r1 - r0, band + r0 * cw);
+#endif
+    frameSpiWindows++;
+    cur ^= 1;
+  }
+
+#if defined(USE_DMA_TO_TFT) && defined(ESP32_DMA)
+  tft.dmaWait();  // Last band must finish before endWrite() releases the bus
+#endif
+  return true;
+}
+
+static void renderFBToTFT() {
+  const LedGeometry g = computeLedGeometry();
+  const int pitchX = g.pitchX;
+  const int pitchY = g.pitchY;
+  const int dot = g.dot;
+  const int insetX = g.insetX;
+  const int insetY = g.insetY;
+  const int gap = min(pitchX, pitchY) - dot;
 
   // Verbose debug output (print once per second)
   static uint32_t lastDbg = 0;
   if (millis() - lastDbg > 1000) {
-    DBG_VERBOSE("Render: pitchX=%d pitchY=%d dot=%d gap=%d ledD=%d ledG=%d\n",
-                pitchX, pitchY, dot, gap, cfg.ledDiameter, cfg.ledGap);
+    DBG_VERBOSE("Render: pitchX=%d pitchY=%d dot=%d gap=%d ledD=%d ledG=%d spiWindows=%u changedLeds=%u\n",
+                pitchX, pitchY, dot, gap, cfg.ledDiameter, cfg.ledGap,
+                (unsigned)spiWindowsLastFrame, (unsigned)changedLedsLastFrame);
+    if (cfg.ledShape != LED_SHAPE_SQUARE) {
+      DBG_VERBOSE("Render: dot tiles %u/%u used, hits=%u misses=%u evictions=%u\n",
+                  dotTiles.used(), dotTiles.capacity(), (unsigned)dotTiles.hits(),
+                  (unsigned)dotTiles.misses(), (unsigned)dotTiles.evictions());
+    }
     lastDbg = millis();
   }
 
@@ -844,33 +778,38 @@ static void renderFBToTFT() {
       }
     }
     tft.startWrite();
-    spr.pushSprite(x0, y0);
+    spr.pushSprite(g.x0, g.y0);
     tft.endWrite();
     drawStatusBar();
     return;
   }
 #endif
 
-  tft.startWrite();  // Batch all SPI writes for speed
+  frameSpiWindows = 0;
+  frameChangedLeds = 0;
 
-  for (int y = 0; y < LED_MATRIX_H; y++) {
-    for (int x = 0; x < LED_MATRIX_W; x++) {
-      uint16_t color = fb[y][x];
-      uint16_t colorPrev = fbPrev[y][x];
+  // Which LEDs changed since the last frame (word-wide compare)
+  static FrameDiff diff;
+  diffFrames(fb, fbPrev, diff);
 
-      // Only update pixels that changed
-      if (color == colorPrev) continue;
-
-      // Use color directly (already RGB565)
-      // For Morph mode: non-square pixels (pitchX=7, pitchY=10)
-      // For other modes: square pixels (pitchX=pitchY)
-      tft.fillRect(x0 + x * pitchX + insetX, y0 + y * pitchY + insetY, dot, dot, color);
+  if (diff.rows) {
+    tft.startWrite();  // Batch all SPI writes for speed
+    if (cfg.renderMode != RENDER_MODE_BAND || !pushDirtyBands(g, diff)) {
+      pushDirtyRects(g, diff);  // Only changed LEDs, coalesced into rectangles
     }
+    tft.endWrite();  // Flush all batched writes
+
+    spiWindowsLastFrame = frameSpiWindows;
+    changedLedsLastFrame = frameChangedLeds;
+
+    // Save current frame as previous for next iteration (changed rows only)
+    copyDirtyRows(fbPrev, fb, diff);
+
+    // Hand the finished frame to the mirror without blocking either side
+    memcpy(frames.back().px, fb, sizeof(fb));
+    frames.publish();
   }
-  tft.endWrite();  // Flush all batched writes
-  
-  // Save current frame as previous for next iteration
-  memcpy(fbPrev, fb, sizeof(fb));
+  PERF_FRAME(frameChangedLeds);
 
   drawStatusBar();
 }
@@ -895,10 +834,18 @@ static void loadConfig() {
   cfg.dateFormat = (uint8_t)prefs.getUChar("dfmt", 0);  // Default: YYYY-MM-DD
   cfg.ledDiameter = (uint8_t)prefs.getUChar("ledd", DEFAULT_LED_DIAMETER);
   cfg.ledGap = (uint8_t)prefs.getUChar("ledg", DEFAULT_LED_GAP);
+  cfg.ledShape = (uint8_t)prefs.getUChar("ledshape", DEFAULT_LED_SHAPE);
+  if (cfg.ledShape > LED_SHAPE_GLOW) cfg.ledShape = LED_SHAPE_SQUARE;
+  cfg.ledDimming = (uint8_t)prefs.getUChar("leddim", DEFAULT_LED_DIMMING);
+  if (cfg.ledDimming > LED_DIM_DITHER) cfg.ledDimming = DEFAULT_LED_DIMMING;
+  cfg.renderMode = (uint8_t)prefs.getUChar("rendmode", DEFAULT_RENDER_MODE);
+  if (cfg.renderMode > RENDER_MODE_BAND) cfg.renderMode = RENDER_MODE_DELTA;
   cfg.ledColor = prefs.getUInt("col", 0xFF0000);
   cfg.brightness = (uint8_t)prefs.getUChar("bl", 255);
   cfg.flipDisplay = prefs.getBool("flip", false);
   cfg.morphSpeed = (uint8_t)prefs.getUChar("morph", 1);  // Default: 1x speed (20 frames)
+  cfg.morphStyle = (uint8_t)prefs.getUChar("mstyle", DEFAULT_MORPH_STYLE);
+  if (cfg.morphStyle > MORPH_STYLE_PAIRS) cfg.morphStyle = DEFAULT_MORPH_STYLE;
   cfg.useFahrenheit = prefs.getBool("useFahr", false);
   cfg.clockMode = (uint8_t)prefs.getUChar("clockMode", DEFAULT_CLOCK_MODE);
   cfg.autoRotate = prefs.getBool("autoRotate", DEFAULT_AUTO_ROTATE);
@@ -920,6 +867,7 @@ static void loadConfig() {
   DBG("  FlipDisplay: %s\n", cfg.flipDisplay ? "true" : "false");
   DBG("  UseFahrenheit: %s\n", cfg.useFahrenheit ? "true" : "false");
   DBG("  DebugLevel: %u\n", debugLevel);
+  DBG("  RenderMode: %s\n", cfg.renderMode == RENDER_MODE_BAND ? "band" : "delta");
 
   DBG_OK("Config loaded.");
 }
@@ -933,10 +881,14 @@ static void saveConfig() {
   prefs.putUChar("dfmt", cfg.dateFormat);
   prefs.putUChar("ledd", cfg.ledDiameter);
   prefs.putUChar("ledg", cfg.ledGap);
+  prefs.putUChar("ledshape", cfg.ledShape);
+  prefs.putUChar("leddim", cfg.ledDimming);
+  prefs.putUChar("rendmode", cfg.renderMode);
   prefs.putUInt("col", cfg.ledColor);
   prefs.putUChar("bl", cfg.brightness);
   prefs.putBool("flip", cfg.flipDisplay);
   prefs.putUChar("morph", cfg.morphSpeed);
+  prefs.putUChar("mstyle", cfg.morphStyle);
   prefs.putBool("useFahr", cfg.useFahrenheit);
   prefs.putUChar("clockMode", cfg.clockMode);
   prefs.putBool("autoRotate", cfg.autoRotate);
@@ -947,6 +899,8 @@ static void saveConfig() {
   prefs.putUInt("mDateCol", cfg.morphDateColor);
   prefs.putUChar("dbglvl", debugLevel);
   prefs.end();
+  invalidateStateCache();  // Every config change ends here
+  requestRender();
   DBG_OK("Config saved.");
 }
 
@@ -970,23 +924,25 @@ static void applyDisplayRotation() {
 #if ENABLE_TOUCH
 /**
  * Initialize capacitive touch controller (FT6236/FT6206)
- * Shares I2C bus with sensors on GPIO21/GPIO22
+ * Shares I2C bus with sensors on GPIO21/GPIO22: run as an I2CBus job
  * @return true if touch controller initialized successfully, false otherwise
  */
 static bool initTouch() {
   DBG_STEP("Initializing touch controller...");
 
-  // Wire.begin() is called in testSensor() - touch shares same I2C bus
-  // If no sensor, we need to initialize Wire here
-  #if !defined(USE_SENSOR)
-    Wire.begin(TOUCH_SDA_PIN, TOUCH_SCL_PIN);
-  #endif
-
   if (!touch.begin(TOUCH_I2C_ADDR, &Wire)) {
     DBG_WARN("Touch controller (FT6236/FT6206) not found at address 0x%02X\n", TOUCH_I2C_ADDR);
     return false;
   }
 
+  // Interrupt polling mode: the controller holds INT low for as long as a
+  // finger is down, so the touch task reads the bus only while touched
+  Wire.beginTransmission(TOUCH_I2C_ADDR);
+  Wire.write(0xA4);  // G_MODE register
+  Wire.write(0x00);
+  Wire.endTransmission();
+  pinMode(TOUCH_IRQ_PIN, INPUT_PULLUP);
+
   // Read touch controller info for diagnostics
   uint8_t vendorID = 0, chipID = 0;
   Wire.beginTransmission(TOUCH_I2C_ADDR);
@@ -1165,13 +1121,26 @@ static void showUserSettingsPage() {
   snprintf(buf, sizeof(buf), "  Gap: %d px", cfg.ledGap);
   drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
 
+  {
+    const char* shapes[] = {"Square", "Round", "Glow"};
+    snprintf(buf, sizeof(buf), "  Shape: %s", shapes[cfg.ledShape]);
+    drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
+  }
+
+  {
+    const char* curves[] = {"Linear", "Gamma", "Gamma + Dither"};
+    snprintf(buf, sizeof(buf), "  Dimming: %s", curves[cfg.ledDimming]);
+    drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
+  }
+
   snprintf(buf, sizeof(buf), "  Color: RGB #%04X", cfg.ledColor);
   drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
 
   snprintf(buf, sizeof(buf), "  Brightness: %d", cfg.brightness);
   drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
 
-  snprintf(buf, sizeof(buf), "  Morph Speed: %dx", cfg.morphSpeed);
+  snprintf(buf, sizeof(buf), "  Morph Speed: %dx (%s)", cfg.morphSpeed,
+           cfg.morphStyle == MORPH_STYLE_PAIRS ? "Pixel Pairs" : "Spawn");
   drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
 
   snprintf(buf, sizeof(buf), "  Display Flip: %s", cfg.flipDisplay ? "180\xF7" : "Normal");  // 0xF7 = degree symbol
@@ -1236,8 +1205,10 @@ static void showDiagnosticsPage() {
   snprintf(buf, sizeof(buf), "  Display: 480x320 ILI9488");
   drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
 
-  if (sensorAvailable) {
-    snprintf(buf, sizeof(buf), "  Sensor: %s", sensorType);
+  for (uint8_t i = 0; sensorAvailable && i < Sensors::count(); i++) {
+    SensorDriver* sensor = Sensors::get(i);
+    snprintf(buf, sizeof(buf), "  Sensor: %s @0x%02X (%lu ms conv.)", sensor->name(), sensor->address(),
+             (unsigned long)sensorStats[i].lastConversionMs);
     drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
   }
 
@@ -1258,7 +1229,11 @@ static void showDiagnosticsPage() {
   snprintf(buf, sizeof(buf), "  Free Heap: %d KB", freeHeap / 1024);
   drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
 
-  snprintf(buf, sizeof(buf), "  CPU: %d MHz", ESP.getCpuFreqMHz());
+  if (Power::scaling()) {
+    snprintf(buf, sizeof(buf), "  CPU: %d MHz (%d-%d)", ESP.getCpuFreqMHz(), POWER_MIN_MHZ, POWER_MAX_MHZ);
+  } else {
+    snprintf(buf, sizeof(buf), "  CPU: %d MHz", ESP.getCpuFreqMHz());
+  }
   drawClippedString(buf, 10, y, contentWidth); y += lineHeight;
 
   snprintf(buf, sizeof(buf), "  Firmware: v%s", FIRMWARE_VERSION);
@@ -1267,422 +1242,497 @@ static void showDiagnosticsPage() {
   // Action Buttons (right side)
   drawButton(btnResetWiFi);
   drawButton(btnReboot);
+
+  // Performance (right column, below the action buttons) - mean section times
+  tft.setTextDatum(TL_DATUM);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setTextFont(2);
+  const int perfX = 330;
+  const int perfWidth = tft.width() - perfX - 5;
+  y = btnReboot.y + btnReboot.h + 10;
+
+  drawClippedString("PERFORMANCE", perfX, y, perfWidth); y += lineHeight;
+  snprintf(buf, sizeof(buf), "FPS: %.1f", Perf::fps());
+  drawClippedString(buf, perfX, y, perfWidth); y += lineHeight;
+  snprintf(buf, sizeof(buf), "Idle: %.0f%%", Perf::idlePercent());
+  drawClippedString(buf, perfX, y, perfWidth); y += lineHeight;
+  snprintf(buf, sizeof(buf), "LEDs/frm: %.0f", Perf::changedLedsMean());
+  drawClippedString(buf, perfX, y, perfWidth); y += lineHeight;
+
+  const struct { PerfSection section; const char* label; } perfLines[] = {
+    {PERF_RENDER_MODE, "Mode"},
+    {PERF_RENDER_TFT, "TFT"},
+    {PERF_STATUS_BAR, "Bar"},
+    {PERF_HANDLE_CLIENT, "Web"},
+  };
+  for (const auto& line : perfLines) {
+    const PerfStat& st = Perf::stat(line.section);
+    snprintf(buf, sizeof(buf), "%s: %lu us", line.label,
+             st.count ? (unsigned long)(st.totalUs / st.count) : 0UL);
+    drawClippedString(buf, perfX, y, perfWidth); y += lineHeight;
+  }
 }
 
 /**
- * Check for touch events:
- * - When info pages active: Navigation buttons (< > X) or action buttons
- * - When clock active: Long press (3s) shows info pages, short tap switches mode
- * Implements debouncing to prevent multiple triggers
+ * Map a raw FT6206 point to screen coordinates (rotation, calibration offsets)
  */
-static void handleTouch() {
-  bool isTouched = touch.touched();
-  unsigned long now = millis();
-
-  // Check for info page timeout (30s of inactivity)
-      if (infoPageActive && (now - infoPageStartTime >= INFO_PAGE_TIMEOUT_MS)) {
-        DBG_INFO("Info page timeout - returning to clock display\n");
-        infoPageActive = false;
-        tft.fillScreen(TFT_BLACK);  // Clear entire TFT to remove any clock artifacts
-        memset(fbPrev, 0, sizeof(fbPrev));  // Force full redraw
-        resetStatusBar();
-        return;
-      }
-
-  if (isTouched) {
-    if (!touchHeld) {
-      // Touch just started - capture coordinates NOW while finger is down
-      lastTouchPoint = touch.getPoint();
-      touchStartTime = now;
-      touchHeld = true;
-      DBG_INFO("Touch started at raw(x=%d,y=%d)\n", lastTouchPoint.x, lastTouchPoint.y);
-    } else {
-      // Touch is being held - check if it's a long press (only when info page not active)
-      if (!infoPageActive && (now - touchStartTime >= TOUCH_LONG_PRESS_MS)) {
-        // Long press detected - show info page
-        DBG_INFO("Long press detected - showing info pages\n");
-        infoPageActive = true;
-        infoPageNum = 0;  // Start with User Settings page
-        infoPageStartTime = now;  // Start timeout timer
-        showUserSettingsPage();
-        touchStartTime = now;  // Reset for debouncing
-      }
-    }
+static void touchToScreen(const TS_Point& point, int& touchX, int& touchY) {
+  // Map touch coordinates to screen coordinates
+  // FT6206 reports in portrait mode (0-320 x 0-480)
+  // Display is 480x320 in landscape mode
+  //
+  // Calibration data from testing:
+  // X button at screen(430-475, 5-35) -> raw touch(303, 476)
+  // This confirms: touchY -> screenX, touchX -> screenY (inverted)
+  if (cfg.flipDisplay) {
+    // Rotation 3 (display flipped 180°)
+    // Touch coordinates are inverted in both axes
+    touchX = map(point.y, 0, 480, 479, 0);  // Touch Y -> Screen X (inverted)
+    touchY = map(point.x, 0, 320, 0, 319);  // Touch X -> Screen Y (normal)
   } else {
-    // Touch released
-    if (touchHeld) {
-      unsigned long pressDuration = now - touchStartTime;
-
-      // Debounce check
-      if (now - lastTouchTime < TOUCH_DEBOUNCE_MS) {
-        touchHeld = false;
-        return;
-      }
+    // Rotation 1 (normal landscape, USB on right)
+    touchX = map(point.y, 0, 480, 0, 479);  // Touch Y -> Screen X (1:1 mapping)
+    touchY = map(point.x, 0, 320, 319, 0);  // Touch X -> Screen Y (inverted)
+  }
 
-      lastTouchTime = now;
-      touchHeld = false;
-
-      if (infoPageActive) {
-        // Info page is active - check for button presses using stored touch point
-        // Reset timeout timer on any touch interaction
-        infoPageStartTime = now;
-
-        TS_Point point = lastTouchPoint;
-
-        // Map touch coordinates to screen coordinates
-        // FT6206 reports in portrait mode (0-320 x 0-480)
-        // Display is 480x320 in landscape mode
-        //
-        // Calibration data from testing:
-        // X button at screen(430-475, 5-35) -> raw touch(303, 476)
-        // This confirms: touchY -> screenX, touchX -> screenY (inverted)
-
-        int touchX, touchY;
-
-        if (cfg.flipDisplay) {
-          // Rotation 3 (display flipped 180°)
-          // Touch coordinates are inverted in both axes
-          touchX = map(point.y, 0, 480, 479, 0);  // Touch Y -> Screen X (inverted)
-          touchY = map(point.x, 0, 320, 0, 319);  // Touch X -> Screen Y (normal)
-        } else {
-          // Rotation 1 (normal landscape, USB on right)
-          touchX = map(point.y, 0, 480, 0, 479);  // Touch Y -> Screen X (1:1 mapping)
-          touchY = map(point.x, 0, 320, 319, 0);  // Touch X -> Screen Y (inverted)
-        }
+  // Apply calibration offsets
+  touchX += cfg.touchOffsetX;
+  touchY += cfg.touchOffsetY;
 
-        // Apply calibration offsets
-        touchX += cfg.touchOffsetX;
-        touchY += cfg.touchOffsetY;
-
-        // Constrain to screen bounds
-        touchX = constrain(touchX, 0, 479);
-        touchY = constrain(touchY, 0, 319);
-
-        DBG_INFO("Touch raw(x=%d,y=%d) -> screen(x=%d,y=%d) [flip=%d, offset=%d,%d]\n",
-                 point.x, point.y, touchX, touchY, cfg.flipDisplay, cfg.touchOffsetX, cfg.touchOffsetY);
-
-        // Check navigation buttons first (always available)
-        if (isButtonPressed(btnClose, touchX, touchY)) {
-          // X button - exit info pages and return to clock
-          DBG_INFO("Close button pressed - exiting info pages\n");
-          drawButton(btnClose, true);
-          delay(150);
-          infoPageActive = false;
-          tft.fillScreen(TFT_BLACK);
-          memset(fbPrev, 0, sizeof(fbPrev));  // Force full redraw
-          resetStatusBar();
-          return;
-        }
+  // Constrain to screen bounds
+  touchX = constrain(touchX, 0, 479);
+  touchY = constrain(touchY, 0, 319);
+}
 
-        if (isButtonPressed(btnPrev, touchX, touchY)) {
-          // < button - previous page
-          DBG_INFO("Previous button pressed\n");
-          drawButton(btnPrev, true);
-          delay(150);
-          infoPageNum = (infoPageNum == 0) ? (TOUCH_INFO_PAGES - 1) : (infoPageNum - 1);
-          DBG_INFO("Switching to info page %d\n", infoPageNum);
-
-          if (infoPageNum == 0) {
-            showUserSettingsPage();
-          } else if (infoPageNum == 1) {
-            showDiagnosticsPage();
-          }
-          return;
-        }
+// One FT6206 reading (filled by readTouchSample() on the I2C bus task)
+struct TouchSample {
+  uint8_t touches;
+  TS_Point point;
+};
 
-        if (isButtonPressed(btnNext, touchX, touchY)) {
-          // > button - next page
-          DBG_INFO("Next button pressed\n");
-          drawButton(btnNext, true);
-          delay(150);
-          infoPageNum = (infoPageNum + 1) % TOUCH_INFO_PAGES;
-          DBG_INFO("Switching to info page %d\n", infoPageNum);
-
-          if (infoPageNum == 0) {
-            showUserSettingsPage();
-          } else if (infoPageNum == 1) {
-            showDiagnosticsPage();
-          }
-          return;
-        }
+/**
+ * I2C job: read the touch count and first point in one transaction
+ * (TD_STATUS and P1_XH..P1_YL, registers 0x02-0x06)
+ */
+static bool readTouchSample(void* arg) {
+  TouchSample* sample = (TouchSample*)arg;
+  uint8_t buf[5];
 
-        // Check action buttons based on current page
-        if (infoPageNum == 0) {
-          // User Settings page - check Flip Display button
-          if (isButtonPressed(btnFlipDisplay, touchX, touchY)) {
-            DBG_INFO("Flip Display button pressed\n");
-            drawButton(btnFlipDisplay, true);
-            delay(200);
-
-            // Toggle flip display
-            cfg.flipDisplay = !cfg.flipDisplay;
-            saveConfig();
-            applyDisplayRotation();
-            tft.fillScreen(TFT_BLACK);
-            memset(fbPrev, 0, sizeof(fbPrev));
-            resetStatusBar();
-            showUserSettingsPage();  // Refresh page with new value
-            return;
-          }
-        } else if (infoPageNum == 1) {
-          // System Diagnostics page - check Reset WiFi and Reboot buttons
-          if (isButtonPressed(btnResetWiFi, touchX, touchY)) {
-            DBG_INFO("Reset WiFi button pressed\n");
-            drawButton(btnResetWiFi, true);
-            delay(200);
-
-            // Reset WiFi credentials and restart
-            DBG_OK("Resetting WiFi credentials via info page...");
-            prefs.begin("nvs", false);
-            prefs.clear();
-            prefs.end();
-
-            tft.fillScreen(TFT_BLACK);
-            tft.setTextColor(TFT_RED, TFT_BLACK);
-            tft.setTextDatum(MC_DATUM);
-            tft.setTextFont(4);
-            tft.drawString("WiFi Reset", tft.width()/2, tft.height()/2 - 20);
-            tft.setTextFont(2);
-            tft.drawString("Restarting...", tft.width()/2, tft.height()/2 + 20);
-            delay(2000);
-            ESP.restart();
-            return;
-          }
+  Wire.beginTransmission(TOUCH_I2C_ADDR);
+  Wire.write(0x02);
+  if (Wire.endTransmission() != 0) return false;
+  if (Wire.requestFrom(TOUCH_I2C_ADDR, 5) != 5) return false;
+  for (uint8_t i = 0; i < 5; i++) buf[i] = Wire.read();
+
+  sample->touches = buf[0] & 0x0F;
+  if (sample->touches > 2) sample->touches = 0;  // Invalid report (same check as the library)
+  sample->point.x = ((buf[1] & 0x0F) << 8) | buf[2];
+  sample->point.y = ((buf[3] & 0x0F) << 8) | buf[4];
+  return true;
+}
 
-          if (isButtonPressed(btnReboot, touchX, touchY)) {
-            DBG_INFO("Reboot button pressed\n");
-            drawButton(btnReboot, true);
-            delay(200);
-
-            // Reboot device
-            DBG_OK("Rebooting device via info page...");
-            tft.fillScreen(TFT_BLACK);
-            tft.setTextColor(TFT_ORANGE, TFT_BLACK);
-            tft.setTextDatum(MC_DATUM);
-            tft.setTextFont(4);
-            tft.drawString("Rebooting", tft.width()/2, tft.height()/2 - 20);
-            tft.setTextFont(2);
-            tft.drawString("Please wait...", tft.width()/2, tft.height()/2 + 20);
-            delay(1000);
-            ESP.restart();
-            return;
-          }
-        }
-      } else {
-        // Clock is active - long press shows info, short tap switches mode
-        if (pressDuration < TOUCH_LONG_PRESS_MS) {
-          // Short tap - switch to next clock mode
-          uint8_t nextMode = (cfg.clockMode + 1) % TOTAL_CLOCK_MODES;
-          DBG_INFO("Touch - switching to clock mode %d\n", nextMode);
+/**
+ * Read the touch controller through the I2C bus (touch task)
+ * @return true if a finger is down; its position in point
+ */
+static bool touchRead(TS_Point& point) {
+  TouchSample sample = {};
+  if (!I2CBus::run(I2C_DEV_TOUCH, I2C_PRIO_HIGH, readTouchSample, &sample) || sample.touches == 0) return false;
+  point = sample.point;
+  return true;
+}
 
-          switchClockMode(nextMode);
+/**
+ * Touch IRQ (falling edge: finger down): wake the touch task
+ */
+static void IRAM_ATTR onTouchIrq() {
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(touchTaskHandle, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
 
-          // If auto-rotate is enabled, reset the timer
-          if (cfg.autoRotate) {
-            lastModeRotation = now;
-          }
-        }
-      }
-    }
+/**
+ * Queue a gesture for the render task and wake it
+ */
+static void postTouchEvent(TouchGesture gesture, int x, int y) {
+  TouchEvent ev = {gesture, (int16_t)x, (int16_t)y, (uint32_t)millis()};
+  if (xQueueSend(touchEvents, &ev, 0) != pdTRUE) {
+    DBG_WARN("Touch event queue full - gesture %d dropped\n", gesture);
+    return;
   }
+  wakeRenderTask();
 }
-#endif
 
-// =========================
-// Sensor Functions
-// =========================
 /**
- * Test and initialize I2C sensor
- * @return true if sensor detected and working, false otherwise
+ * Follow one touch from finger down to release and post its gesture
+ * A finger held still for TOUCH_LONG_PRESS_MS is a long press (posted while
+ * still down); a release after moving TOUCH_SWIPE_MIN_PX is a swipe in the
+ * dominant direction; anything else is a tap.
  */
-static bool testSensor() {
-  Wire.begin(SENSOR_SDA_PIN, SENSOR_SCL_PIN);
-  DBG_STEP("Testing I2C sensor...");
-
-#ifdef USE_BME280
-  // Test BME280 sensor
-  if (!bme280.begin(0x76, &Wire)) {
-    DBG_WARN("BME280 sensor not found at 0x76\n");
-    if (!bme280.begin(0x77, &Wire)) {
-      DBG_WARN("BME280 sensor not found at 0x77 either\n");
-      return false;
+static void trackTouch() {
+  TS_Point point;
+  if (!touchRead(point)) return;  // INT glitch, or the finger already lifted
+
+  int startX, startY;
+  touchToScreen(point, startX, startY);
+  const uint32_t startMs = millis();
+  int dx = 0, dy = 0;
+  bool longPress = false;
+  DBG_INFO("Touch started at screen(x=%d,y=%d)\n", startX, startY);
+
+  // Sample while the controller holds INT low
+  for (;;) {
+    vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_MS));
+    if (digitalRead(TOUCH_IRQ_PIN) == HIGH || !touchRead(point)) break;
+
+    int x, y;
+    touchToScreen(point, x, y);
+    dx = x - startX;
+    dy = y - startY;
+
+    const bool still = abs(dx) < TOUCH_SWIPE_MIN_PX && abs(dy) < TOUCH_SWIPE_MIN_PX;
+    if (!longPress && still && millis() - startMs >= TOUCH_LONG_PRESS_MS) {
+      postTouchEvent(TOUCH_LONG_PRESS, startX, startY);
+      longPress = true;
     }
   }
+  if (longPress) return;  // Release after a long press is not a tap
+
+  if (abs(dx) >= TOUCH_SWIPE_MIN_PX || abs(dy) >= TOUCH_SWIPE_MIN_PX) {
+    TouchGesture swipe = abs(dx) >= abs(dy) ? (dx < 0 ? TOUCH_SWIPE_LEFT : TOUCH_SWIPE_RIGHT)
+                                            : (dy < 0 ? TOUCH_SWIPE_UP : TOUCH_SWIPE_DOWN);
+    postTouchEvent(swipe, startX, startY);
+  } else {
+    postTouchEvent(TOUCH_TAP, startX, startY);
+  }
+}
 
-  bme280.setSampling(Adafruit_BME280::MODE_FORCED,
-                     Adafruit_BME280::SAMPLING_X1,
-                     Adafruit_BME280::SAMPLING_X1,
-                     Adafruit_BME280::SAMPLING_X1,
-                     Adafruit_BME280::FILTER_OFF);
+/**
+ * Touch task (TOUCH_TASK_CORE): sleeps until the IRQ line reports a finger,
+ * then reads the FT6206 every TOUCH_SAMPLE_MS until it lifts
+ * With no finger down there is no touch traffic on the shared I2C bus; reads
+ * go through I2CBus at high priority.
+ */
+static void touchTask(void*) {
+  for (;;) {
+    if (digitalRead(TOUCH_IRQ_PIN) == HIGH) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    trackTouch();
+    // INT still low without a readable touch: back off rather than spin on the bus
+    if (digitalRead(TOUCH_IRQ_PIN) == LOW) vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_MS));
+  }
+}
 
-  float temp = bme280.readTemperature();
-  float hum = bme280.readHumidity();
+/**
+ * Start the touch task and arm the IRQ (after initTouch() succeeded)
+ */
+static void startTouchTask() {
+  touchEvents = xQueueCreate(TOUCH_QUEUE_LEN, sizeof(TouchEvent));
+  xTaskCreatePinnedToCore(touchTask, "touch", TOUCH_TASK_STACK, nullptr,
+                          TOUCH_TASK_PRIORITY, &touchTaskHandle, TOUCH_TASK_CORE);
+  attachInterrupt(digitalPinToInterrupt(TOUCH_IRQ_PIN), onTouchIrq, FALLING);
+}
 
-  if (isnan(temp) || isnan(hum) || temp < -50 || temp > 100 || hum < 0 || hum > 100) {
-    DBG_WARN("BME280 readings invalid\n");
-    return false;
+/**
+ * Show info page infoPageNum
+ */
+static void showInfoPage() {
+  DBG_INFO("Switching to info page %d\n", infoPageNum);
+  if (infoPageNum == 0) {
+    showUserSettingsPage();
+  } else if (infoPageNum == 1) {
+    showDiagnosticsPage();
   }
+}
 
-  DBG_INFO("BME280 OK: %.1f°C, %.1f%%\n", temp, hum);
-  sensorType = "BME280";
-  return true;
+/**
+ * Leave the info pages and redraw the clock
+ */
+static void closeInfoPages() {
+  infoPageActive = false;
+  tft.fillScreen(TFT_BLACK);  // Clear entire TFT to remove any clock artifacts
+  memset(fbPrev, 0, sizeof(fbPrev));  // Force full redraw
+  resetStatusBar();
+  requestRender();
+}
 
-#elif defined(USE_BMP280)
-  // Test BMP280 sensor (temperature and pressure only, no humidity)
-  if (!bmp280.begin(0x76)) {
-    DBG_WARN("BMP280 sensor not found at 0x76\n");
-    if (!bmp280.begin(0x77)) {
-      DBG_WARN("BMP280 sensor not found at 0x77 either\n");
-      return false;
-    }
+/**
+ * Act on one gesture from the touch task:
+ * - When info pages active: navigation buttons (< > X), action buttons, swipe to change page
+ * - When clock active: long press (3s) shows info pages, tap or swipe left switches to the
+ *   next mode, swipe right to the previous one
+ * Taps and swipes closer than TOUCH_DEBOUNCE_MS to the previous one are ignored
+ */
+static void handleTouchEvent(const TouchEvent& ev) {
+  const uint32_t now = ev.ms;
+
+  if (ev.gesture == TOUCH_LONG_PRESS) {
+    if (infoPageActive) return;
+    DBG_INFO("Long press detected - showing info pages\n");
+    infoPageActive = true;
+    infoPageNum = 0;  // Start with User Settings page
+    infoPageStartTime = millis();  // Start timeout timer
+    showUserSettingsPage();
+    return;
   }
 
-  // Configure BMP280 for weather monitoring
-  bmp280.setSampling(Adafruit_BMP280::MODE_NORMAL,     // Operating mode
-                     Adafruit_BMP280::SAMPLING_X2,     // Temperature oversampling
-                     Adafruit_BMP280::SAMPLING_X16,    // Pressure oversampling
-                     Adafruit_BMP280::FILTER_X16,      // Filtering
-                     Adafruit_BMP280::STANDBY_MS_500); // Standby time
+  // Debounce check
+  if (now - lastTouchTime < TOUCH_DEBOUNCE_MS) return;
+  lastTouchTime = now;
 
-  float temp = bmp280.readTemperature();
-  float pressure = bmp280.readPressure() / 100.0F;  // Convert Pa to hPa
+  if (infoPageActive) {
+    // Reset timeout timer on any touch interaction
+    infoPageStartTime = millis();
 
-  if (isnan(temp) || isnan(pressure) || temp < -50 || temp > 100 || pressure < 300 || pressure > 1100) {
-    DBG_WARN("BMP280 readings invalid\n");
-    return false;
-  }
+    if (ev.gesture == TOUCH_SWIPE_LEFT || ev.gesture == TOUCH_SWIPE_RIGHT) {
+      infoPageNum = ev.gesture == TOUCH_SWIPE_LEFT ? (infoPageNum + 1) % TOUCH_INFO_PAGES
+                  : (infoPageNum == 0) ? (TOUCH_INFO_PAGES - 1) : (infoPageNum - 1);
+      showInfoPage();
+      return;
+    }
+    if (ev.gesture != TOUCH_TAP) return;
+
+    const int touchX = ev.x;
+    const int touchY = ev.y;
+    DBG_INFO("Touch tap at screen(x=%d,y=%d) [flip=%d, offset=%d,%d]\n",
+             touchX, touchY, cfg.flipDisplay, cfg.touchOffsetX, cfg.touchOffsetY);
+
+    // Check navigation buttons first (always available)
+    if (isButtonPressed(btnClose, touchX, touchY)) {
+      // X button - exit info pages and return to clock
+      DBG_INFO("Close button pressed - exiting info pages\n");
+      drawButton(btnClose, true);
+      delay(150);
+      closeInfoPages();
+      return;
+    }
 
-  DBG_INFO("BMP280 OK: %.1f°C, %.1f hPa\n", temp, pressure);
-  sensorType = "BMP280";
-  return true;
+    if (isButtonPressed(btnPrev, touchX, touchY)) {
+      // < button - previous page
+      DBG_INFO("Previous button pressed\n");
+      drawButton(btnPrev, true);
+      delay(150);
+      infoPageNum = (infoPageNum == 0) ? (TOUCH_INFO_PAGES - 1) : (infoPageNum - 1);
+      showInfoPage();
+      return;
+    }
 
-#elif defined(USE_BMP180)
-  // Test BMP180 sensor (temperature and pressure only, no humidity)
-  // BMP180 has fixed I2C address 0x77
-  if (!bmp180.begin(BMP085_MODE_ULTRAHIGHRES)) {
-    DBG_WARN("BMP180 sensor not found at 0x77\n");
-    return false;
-  }
+    if (isButtonPressed(btnNext, touchX, touchY)) {
+      // > button - next page
+      DBG_INFO("Next button pressed\n");
+      drawButton(btnNext, true);
+      delay(150);
+      infoPageNum = (infoPageNum + 1) % TOUCH_INFO_PAGES;
+      showInfoPage();
+      return;
+    }
 
-  // Read initial values to verify sensor is working
-  float temp = bmp180.readTemperature();
-  float pressure = bmp180.readPressure() / 100.0F;  // Convert Pa to hPa
+    // Check action buttons based on current page
+    if (infoPageNum == 0) {
+      // User Settings page - check Flip Display button
+      if (isButtonPressed(btnFlipDisplay, touchX, touchY)) {
+        DBG_INFO("Flip Display button pressed\n");
+        drawButton(btnFlipDisplay, true);
+        delay(200);
+
+        // Toggle flip display
+        cfg.flipDisplay = !cfg.flipDisplay;
+        saveConfig();
+        applyDisplayRotation();
+        tft.fillScreen(TFT_BLACK);
+        memset(fbPrev, 0, sizeof(fbPrev));
+        resetStatusBar();
+        showUserSettingsPage();  // Refresh page with new value
+        return;
+      }
+    } else if (infoPageNum == 1) {
+      // System Diagnostics page - check Reset WiFi and Reboot buttons
+      if (isButtonPressed(btnResetWiFi, touchX, touchY)) {
+        DBG_INFO("Reset WiFi button pressed\n");
+        drawButton(btnResetWiFi, true);
+        delay(200);
+
+        // Reset WiFi credentials and restart
+        DBG_OK("Resetting WiFi credentials via info page...");
+        prefs.begin("nvs", false);
+        prefs.clear();
+        prefs.end();
+
+        tft.fillScreen(TFT_BLACK);
+        tft.setTextColor(TFT_RED, TFT_BLACK);
+        tft.setTextDatum(MC_DATUM);
+        tft.setTextFont(4);
+        tft.drawString("WiFi Reset", tft.width()/2, tft.height()/2 - 20);
+        tft.setTextFont(2);
+        tft.drawString("Restarting...", tft.width()/2, tft.height()/2 + 20);
+        delay(2000);
+        ESP.restart();
+        return;
+      }
 
-  if (isnan(temp) || isnan(pressure) || temp < -50 || temp > 100 || pressure < 300 || pressure > 1100) {
-    DBG_WARN("BMP180 readings invalid\n");
-    return false;
-  }
+      if (isButtonPressed(btnReboot, touchX, touchY)) {
+        DBG_INFO("Reboot button pressed\n");
+        drawButton(btnReboot, true);
+        delay(200);
+
+        // Reboot device
+        DBG_OK("Rebooting device via info page...");
+        tft.fillScreen(TFT_BLACK);
+        tft.setTextColor(TFT_ORANGE, TFT_BLACK);
+        tft.setTextDatum(MC_DATUM);
+        tft.setTextFont(4);
+        tft.drawString("Rebooting", tft.width()/2, tft.height()/2 - 20);
+        tft.setTextFont(2);
+        tft.drawString("Please wait...", tft.width()/2, tft.height()/2 + 20);
+        delay(1000);
+        ESP.restart();
+        return;
+      }
+    }
+  } else {
+    // Clock is active - tap or swipe left: next mode, swipe right: previous mode
+    uint8_t nextMode;
+    if (ev.gesture == TOUCH_TAP || ev.gesture == TOUCH_SWIPE_LEFT) {
+      nextMode = (cfg.clockMode + 1) % TOTAL_CLOCK_MODES;
+    } else if (ev.gesture == TOUCH_SWIPE_RIGHT) {
+      nextMode = (cfg.clockMode + TOTAL_CLOCK_MODES - 1) % TOTAL_CLOCK_MODES;
+    } else {
+      return;
+    }
+    DBG_INFO("Touch - switching to clock mode %d\n", nextMode);
 
-  DBG_INFO("BMP180 OK: %.1f°C, %.1f hPa\n", temp, pressure);
-  sensorType = "BMP180";
-  return true;
+    switchClockMode(nextMode);
 
-#elif defined(USE_SHT3X)
-  // Test SHT3X sensor
-  if (!sht3x.begin(0x44)) {  // Default I2C address for SHT3X
-    DBG_WARN("SHT3X sensor not found at 0x44\n");
-    if (!sht3x.begin(0x45)) {  // Alternative I2C address
-      DBG_WARN("SHT3X sensor not found at 0x45 either\n");
-      return false;
+    // If auto-rotate is enabled, reset the timer
+    if (cfg.autoRotate) {
+      lastModeRotation = millis();
     }
   }
+}
 
-  // Read initial values to verify sensor is working
-  float temp = sht3x.readTemperature();
-  float hum = sht3x.readHumidity();
+/**
+ * Handle queued touch gestures and the info page timeout (render task)
+ */
+static void handleTouch() {
+  // Check for info page timeout (30s of inactivity)
+  if (infoPageActive && (millis() - infoPageStartTime >= INFO_PAGE_TIMEOUT_MS)) {
+    DBG_INFO("Info page timeout - returning to clock display\n");
+    closeInfoPages();
+    return;
+  }
 
-  if (isnan(temp) || isnan(hum) || temp < -50 || temp > 100 || hum < 0 || hum > 100) {
-    DBG_WARN("SHT3X readings invalid\n");
-    return false;
+  if (!touchEvents) return;
+  TouchEvent ev;
+  while (xQueueReceive(touchEvents, &ev, 0) == pdTRUE) {
+    handleTouchEvent(ev);
   }
+}
+#endif
 
-  DBG_INFO("SHT3X OK: %.1f°C, %.1f%%\n", temp, hum);
-  sensorType = "SHT3X";
-  return true;
+// =========================
+// Sensor Functions
+// =========================
+// Plausible value ranges (config.h), shared by detection, polling and display
+static bool tempValid(float temp) { return !isnan(temp) && temp >= SENSOR_TEMP_MIN_C && temp <= SENSOR_TEMP_MAX_C; }
+static bool humValid(float hum)   { return !isnan(hum) && hum >= SENSOR_HUM_MIN_PCT && hum <= SENSOR_HUM_MAX_PCT; }
+static bool presValid(float pres) { return !isnan(pres) && pres >= SENSOR_PRES_MIN_HPA && pres <= SENSOR_PRES_MAX_HPA; }
+
+/**
+ * Check a reading has every value the sensor measures, in a plausible range
+ */
+static bool sensorReadingValid(uint8_t measures, const SensorReading& r) {
+  bool valid = tempValid(r.temp);
+  if (measures & SENSOR_HUMIDITY) valid = valid && humValid(r.hum);
+  if (measures & SENSOR_PRESSURE) valid = valid && presValid(r.pres);
+  return valid;
+}
+
+/**
+ * Find the I2C sensors and test each with one measurement (I2C bus job)
+ * Waits for the conversions, so only for setup().
+ * @return true if at least one sensor detected and working, false otherwise
+ */
+static bool detectSensors() {
+  DBG_STEP("Scanning I2C bus for sensors...");
 
-#elif defined(USE_HTU21D)
-  // Test HTU21D sensor
-  if (!htu21d.begin()) {  // HTU21D uses fixed I2C address 0x40
-    DBG_WARN("HTU21D sensor not found at 0x40\n");
+  const uint8_t count = Sensors::scan();
+  if (count == 0) {
+    DBG_WARN("No supported sensor found\n");
     return false;
   }
 
-  // Read initial values to verify sensor is working
-  float temp = htu21d.readTemperature();
-  float hum = htu21d.readHumidity();
+  bool working = false;
+  sensorNames[0] = '\0';
+  for (uint8_t i = 0; i < count; i++) {
+    SensorDriver* driver = Sensors::get(i);
+    SensorReading& r = sensorReadings[i];
+    r = {NAN, NAN, NAN};
+    int32_t wait = driver->start();
+    while (wait > 0) {
+      delay(wait);
+      wait = driver->step(r);
+    }
 
-  if (isnan(temp) || isnan(hum) || temp < -50 || temp > 100 || hum < 0 || hum > 100) {
-    DBG_WARN("HTU21D readings invalid\n");
-    return false;
+    sensorValid[i] = wait == 0 && sensorReadingValid(driver->measures(), r);
+    if (!sensorValid[i]) {
+      DBG_WARN("%s readings invalid\n", driver->name());
+    } else {
+      DBG_INFO("%s OK at 0x%02X: %.1f°C, %.1f%%, %.1f hPa\n", driver->name(), driver->address(), r.temp, r.hum, r.pres);
+      working = true;
+    }
+
+    if (i > 0) strlcat(sensorNames, " + ", sizeof(sensorNames));
+    strlcat(sensorNames, driver->name(), sizeof(sensorNames));
   }
+  sensorMeasures = Sensors::measures();
+  return working;  // First readings are applied by setup()
+}
 
-  DBG_INFO("HTU21D OK: %.1f°C, %.1f%%\n", temp, hum);
-  sensorType = "HTU21D";
-  return true;
+// I2C jobs for sensorPoll(): one measurement step of sensor sensorIndex, no waiting
+static bool sensorStartJob(void*) {
+  PERF_SCOPE(PERF_SENSOR_READ);
+  sensorJobResult = Sensors::get(sensorIndex)->start();
+  return sensorJobResult >= 0;
+}
 
-#else
-  DBG_WARN("No sensor type defined in configuration\n");
-  return false;
-#endif
+static bool sensorStepJob(void*) {
+  PERF_SCOPE(PERF_SENSOR_READ);
+  sensorJobResult = Sensors::get(sensorIndex)->step(sensorReadings[sensorIndex]);
+  return sensorJobResult >= 0;
 }
 
 /**
- * Update sensor readings from I2C sensor
+ * Apply a sensor reading to the displayed values (invalid values are ignored)
  */
-static void updateSensorData() {
-  if (!sensorAvailable) return;
-
-  float temp = NAN;
-  float hum = NAN;
-  float pres = NAN;
-
-#ifdef USE_BME280
-  // Read BME280 sensor
-  bme280.takeForcedMeasurement();
-  temp = bme280.readTemperature();
-  hum = bme280.readHumidity();
-  pres = bme280.readPressure() / 100.0F;
-
-#elif defined(USE_BMP280)
-  // Read BMP280 sensor (temperature and pressure only, no humidity)
-  temp = bmp280.readTemperature();
-  pres = bmp280.readPressure() / 100.0F;  // Convert Pa to hPa
-  // BMP280 doesn't have humidity sensor, so humidity remains NAN
+static void applySensorReading(const SensorReading& reading) {
+  History::add(reading);
 
-#elif defined(USE_BMP180)
-  // Read BMP180 sensor (temperature and pressure only, no humidity)
-  temp = bmp180.readTemperature();
-  pres = bmp180.readPressure() / 100.0F;  // Convert Pa to hPa
-  // BMP180 doesn't have humidity sensor, so humidity remains NAN
+  const float temp = reading.temp;
+  const float hum = reading.hum;
+  const float pres = reading.pres;
 
-#elif defined(USE_SHT3X)
-  // Read SHT3X sensor
-  temp = sht3x.readTemperature();
-  hum = sht3x.readHumidity();
-  // SHT3X doesn't have a pressure sensor, so pressure remains NAN
-
-#elif defined(USE_HTU21D)
-  // Read HTU21D sensor
-  temp = htu21d.readTemperature();
-  hum = htu21d.readHumidity();
-  // HTU21D doesn't have a pressure sensor, so pressure remains NAN
-#endif
+  const int oldTemperature = temperature;
+  const int oldHumidity = humidity;
+  const int oldPressure = pressure;
 
   // Update temperature if valid
-  if (!isnan(temp) && temp >= -50 && temp <= 100) {
+  if (tempValid(temp)) {
     temperature = (int)round(temp);
   }
 
   // Update humidity if valid
-  if (!isnan(hum) && hum >= 0 && hum <= 100) {
+  if (humValid(hum)) {
     humidity = (int)round(hum);
   }
 
   // Update pressure if valid (BME280 and BMP280 sensors)
-  if (!isnan(pres) && pres >= 800 && pres <= 1200) {
+  if (presValid(pres)) {
     pressure = (int)round(pres);
   }
 
+  if (temperature != oldTemperature || humidity != oldHumidity || pressure != oldPressure) {
+    invalidateStateCache();
+  }
+
   // Output sensor readings to serial (always at INFO level for visibility)
   if (debugLevel >= DBG_LEVEL_INFO) {
     if (cfg.useFahrenheit) {
@@ -1692,24 +1742,87 @@ static void updateSensorData() {
       Serial.printf("[INFO] Sensor Update - %s: %d°C", sensorType, temperature);
     }
 
-    // Add humidity if sensor supports it (BME280, SHT3X, HTU21D)
-#if defined(USE_BME280) || defined(USE_SHT3X) || defined(USE_HTU21D)
-    if (humidity >= 0) {
+    // Add humidity and pressure if the sensor measures them
+    if ((sensorMeasures & SENSOR_HUMIDITY) && humidity >= 0) {
       Serial.printf(", Humidity: %d%%", humidity);
     }
-#endif
-
-    // Add pressure if sensor supports it (BME280, BMP280, BMP180)
-#if defined(USE_BME280) || defined(USE_BMP280) || defined(USE_BMP180)
-    if (pressure > 0) {
+    if ((sensorMeasures & SENSOR_PRESSURE) && pressure > 0) {
       Serial.printf(", Pressure: %d hPa", pressure);
     }
-#endif
 
     Serial.printf("\n");
   }
 }
 
+// Queue the start of sensor sensorIndex's measurement
+static void sensorStart(uint32_t now) {
+  sensorReadings[sensorIndex] = {NAN, NAN, NAN};
+  sensorStartMs = now;
+  const bool queued = I2CBus::submit(I2C_DEV_SENSOR, I2C_PRIO_LOW, sensorStartJob, nullptr, &sensorRequest);
+  sensorPhase = queued ? SENSOR_STARTING : SENSOR_IDLE;  // Bus queue full: retry next interval
+}
+
+// Move on to the next sensor, or merge and apply once all have been measured
+static void sensorNext(uint32_t now) {
+  if (++sensorIndex < Sensors::count()) {
+    sensorStart(now);
+    return;
+  }
+  sensorPhase = SENSOR_IDLE;
+  applySensorReading(Sensors::merge(sensorReadings, sensorValid));
+}
+
+/**
+ * Advance the periodic sensor measurement (network task)
+ * Queues each step on the I2C bus and returns; conversion time passes
+ * between calls, so neither this task nor the bus waits on a sensor.
+ */
+static void sensorPoll(uint32_t now) {
+  switch (sensorPhase) {
+    case SENSOR_IDLE:
+      if (!sensorAvailable || now - lastSensorUpdate < SENSOR_UPDATE_INTERVAL) return;
+      lastSensorUpdate = now;
+      sensorIndex = 0;
+      sensorStart(now);
+      return;
+
+    case SENSOR_CONVERTING:
+      if ((int32_t)(now - sensorReadyMs) < 0) return;
+      if (I2CBus::submit(I2C_DEV_SENSOR, I2C_PRIO_LOW, sensorStepJob, nullptr, &sensorRequest)) {
+        sensorPhase = SENSOR_STEPPING;
+      }
+      return;
+
+    case SENSOR_STARTING:
+    case SENSOR_STEPPING: {
+      if (!sensorRequest.done) return;
+      SensorStats& st = sensorStats[sensorIndex];
+      SensorDriver* driver = Sensors::get(sensorIndex);
+      if (!sensorRequest.ok) {
+        st.errors++;
+        sensorValid[sensorIndex] = false;
+        DBG_WARN("Sensor %s: measurement failed\n", driver->name());
+        sensorNext(now);
+        return;
+      }
+      if (sensorPhase == SENSOR_STARTING || sensorJobResult > 0) {
+        // Conversion running: come back when it should be done
+        sensorReadyMs = now + sensorJobResult;
+        sensorPhase = SENSOR_CONVERTING;
+        return;
+      }
+
+      // Measurement complete
+      st.measurements++;
+      st.lastConversionMs = now - sensorStartMs;
+      if (st.lastConversionMs > st.maxConversionMs) st.maxConversionMs = st.lastConversionMs;
+      sensorValid[sensorIndex] = sensorReadingValid(driver->measures(), sensorReadings[sensorIndex]);
+      sensorNext(now);
+      return;
+    }
+  }
+}
+
 // =========================
 // Time / NTP
 // =========================
@@ -1750,14 +1863,72 @@ static bool getLocalTimeSafe(struct tm& timeinfo, uint32_t timeoutMs = 2000) {
   return false;
 }
 
+// Last local time read by the render task. Web handlers report this instead
+// of calling getLocalTime(), which can wait while time is not yet set.
+static struct tm timeSnapshot{};
+static bool timeSnapshotValid = false;
+static portMUX_TYPE timeSnapshotMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void storeTimeSnapshot(const struct tm& ti) {
+  // The /api/state ETag only follows the cache version: a new minute (or the
+  // first valid time) makes clients fetch fresh time, date and counters
+  static int lastMinute = -1;  // Render task only
+  const int minute = ti.tm_yday * 1440 + ti.tm_hour * 60 + ti.tm_min;
+  if (minute != lastMinute) {
+    lastMinute = minute;
+    invalidateStateCache();
+  }
+
+  portENTER_CRITICAL(&timeSnapshotMux);
+  timeSnapshot = ti;
+  timeSnapshotValid = true;
+  portEXIT_CRITICAL(&timeSnapshotMux);
+}
+
+static bool getTimeSnapshot(struct tm& ti) {
+  portENTER_CRITICAL(&timeSnapshotMux);
+  ti = timeSnapshot;
+  bool valid = timeSnapshotValid;
+  portEXIT_CRITICAL(&timeSnapshotMux);
+  return valid;
+}
+
+// Restart requested by a web handler. Async handlers must return before the
+// response goes out, so the network task performs the restart a little later.
+static volatile uint32_t restartAtMs = 0;
+static volatile bool restartResetsWiFi = false;
+
+static void scheduleRestart(bool resetWiFi) {
+  restartResetsWiFi = resetWiFi;
+  restartAtMs = (millis() + 1000) | 1;  // Never 0 (0 = no restart pending)
+}
+
+static void handlePendingRestart() {
+  if (!restartAtMs || (int32_t)(millis() - restartAtMs) < 0) return;
+
+  if (restartResetsWiFi) {
+    DBG_OK("Resetting WiFi credentials via web interface...");
+    WiFiManager wm;
+    wm.resetSettings();
+    delay(1000);
+  } else {
+    DBG_OK("Rebooting device via web interface...");
+  }
+  ESP.restart();
+}
+
 // =========================
 // Web handlers
 // =========================
+// Handlers run in the AsyncTCP task. They must not block: changes to the
+// display or render state are posted to the render task, everything else
+// reads snapshots (time, mirror frame) or plain config values.
 // Forward declaration (defined later in Clock logic section)
 static void formatDate(struct tm& ti, char* out, size_t n);
 
-static void handleGetTimezones() {
-  DBG_VERBOSE("Web: GET /api/timezones from %s\n", server.client().remoteIP().toString().c_str());
+static void handleGetTimezones(AsyncWebServerRequest* request) {
+  PERF_SCOPE(PERF_HANDLE_CLIENT);
+  DBG_VERBOSE("Web: GET /api/timezones from %s\n", request->client()->remoteIP().toString().c_str());
 
   JsonDocument doc;
   JsonArray regions = doc["regions"].to<JsonArray>();
@@ -1801,7 +1972,7 @@ static void handleGetTimezones() {
 
   String out;
   serializeJson(doc, out);
-  server.send(200, "application/json", out);
+  request->send(200, "application/json", out);
 }
 
 /**
@@ -1810,20 +1981,12 @@ static void handleGetTimezones() {
  * Resets WiFi credentials and restarts the device into config portal mode.
  * This allows users to reconfigure WiFi settings via the web interface.
  */
-static void handleResetWiFi() {
-  String clientIP = server.client().remoteIP().toString();
+static void handleResetWiFi(AsyncWebServerRequest* request) {
+  String clientIP = request->client()->remoteIP().toString();
   DBG_INFO("Web: POST /api/reset-wifi from %s\n", clientIP.c_str());
 
-  server.send(200, "application/json", "{\"status\":\"WiFi reset initiated. Device will restart...\"}");
-
-  delay(1000);
-
-  DBG_OK("Resetting WiFi credentials via web interface...");
-  WiFiManager wm;
-  wm.resetSettings();
-
-  delay(1000);
-  ESP.restart();
+  request->send(200, "application/json", "{\"status\":\"WiFi reset initiated. Device will restart...\"}");
+  scheduleRestart(true);
 }
 
 /**
@@ -1831,52 +1994,48 @@ static void handleResetWiFi() {
  *
  * Reboots the device cleanly. Useful for applying settings or recovering from issues.
  */
-static void handleReboot() {
-  String clientIP = server.client().remoteIP().toString();
+static void handleReboot(AsyncWebServerRequest* request) {
+  String clientIP = request->client()->remoteIP().toString();
   DBG_INFO("Web: POST /api/reboot from %s\n", clientIP.c_str());
 
-  server.send(200, "application/json", "{\"status\":\"Device rebooting...\"}");
+  request->send(200, "application/json", "{\"status\":\"Device rebooting...\"}");
+  scheduleRestart(false);
+}
 
-  delay(1000);
+// =========================
+// /api/state cache
+// =========================
+// The web UI polls /api/state every second, but apart from the clock and a few
+// counters the answer only changes when the config, a sensor reading or the
+// WiFi link does. Those fields are serialized once into stateCacheJson and
+// rebuilt after invalidateStateCache(); each request appends only the volatile
+// fields. A new minute also invalidates the cache (storeTimeSnapshot), so the
+// volatile fields a client holds are never more than a minute old.
+static std::atomic<uint32_t> stateCacheVersion{1};  // Bumped by invalidateStateCache() (any task)
+static uint32_t stateCacheBuiltVersion = 0;          // Version in stateCacheJson (AsyncTCP task only)
+static String stateCacheJson;                        // Cached fields as "{...," (object left open)
+static String stateCacheTz;                          // cfg.tz JSON-escaped, without quotes
+static uint32_t stateCacheHash = 0;                  // FNV-1a of stateCacheJson, seeds the ETag
+
+static void invalidateStateCache() {
+  stateCacheVersion.fetch_add(1, std::memory_order_relaxed);
+}
 
-  DBG_OK("Rebooting device via web interface...");
-  ESP.restart();
+static uint32_t fnv1a(const char* data, size_t len, uint32_t hash = 2166136261u) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= (uint8_t)data[i];
+    hash *= 16777619u;
+  }
+  return hash;
 }
 
 /**
- * GET /api/state
- *
- * Returns comprehensive system state as JSON for web interface.
- *
- * Response includes:
- * - Time & Network: current time, date, WiFi SSID, IP address
- * - Configuration: timezone, NTP server, time format, date format, LED settings, brightness, debug level
- * - System Diagnostics: uptime (seconds), free heap, total heap size, CPU frequency
- * - Hardware Info: board type, display model, sensor status, firmware version, OTA status
- *
- * This endpoint is polled by the web interface every second to update:
- * - Live clock display
- * - System diagnostics panel
- * - Configuration field values
- * - Display mirror state
+ * Serialize the config, sensor, network and hardware fields of /api/state
  */
-static void handleGetState() {
-  DBG_VERBOSE("Web: GET /api/state from %s\n", server.client().remoteIP().toString().c_str());
-
-  struct tm ti{};
-  bool ok = getLocalTimeSafe(ti, 300);
-  char tbuf[16] = "--:--:--";
-  char dbuf[16] = "----/--/--";
-  if (ok) {
-    strftime(tbuf, sizeof(tbuf), "%H:%M:%S", &ti);
-    formatDate(ti, dbuf, sizeof(dbuf));  // Use configured date format
-  }
-
+static void buildStateCache() {
   JsonDocument doc;
 
-  // Time & Network
-  doc["time"] = tbuf;
-  doc["date"] = dbuf;
+  // Network
   doc["wifi"] = (WiFi.isConnected() ? WiFi.SSID() : String("DISCONNECTED"));
   doc["ip"] = WiFi.isConnected() ? WiFi.localIP().toString() : String("0.0.0.0");
 
@@ -1887,9 +2046,12 @@ static void handleGetState() {
   doc["dateFormat"] = cfg.dateFormat;
   doc["ledDiameter"] = cfg.ledDiameter;
   doc["ledGap"] = cfg.ledGap;
+  doc["ledShape"] = cfg.ledShape;
+  doc["ledDimming"] = cfg.ledDimming;
   doc["ledColor"] = cfg.ledColor;
   doc["brightness"] = cfg.brightness;
   doc["morphSpeed"] = cfg.morphSpeed;
+  doc["morphStyle"] = cfg.morphStyle;
   doc["flipDisplay"] = cfg.flipDisplay;
   doc["clockMode"] = cfg.clockMode;
   doc["autoRotate"] = cfg.autoRotate;
@@ -1901,13 +2063,10 @@ static void handleGetState() {
   doc["morphSensorColor"] = cfg.morphSensorColor;
   doc["morphDateColor"] = cfg.morphDateColor;
 
-  // System diagnostics
-  uint32_t uptime = millis() / 1000;  // seconds
-  doc["uptime"] = uptime;
-  doc["freeHeap"] = ESP.getFreeHeap();
+  // System
   doc["heapSize"] = ESP.getHeapSize();
-  doc["cpuFreq"] = ESP.getCpuFreqMHz();
   doc["debugLevel"] = debugLevel;
+  doc["renderMode"] = cfg.renderMode;
 
   // Sensor data
   doc["sensorAvailable"] = sensorAvailable;
@@ -1922,23 +2081,11 @@ static void handleGetState() {
   if (sensorAvailable) {
     int displayTemp = cfg.useFahrenheit ? (temperature * 9 / 5 + 32) : temperature;
     const char* tempUnit = cfg.useFahrenheit ? "°F" : "°C";
-    char tempStr[32];
-    snprintf(tempStr, sizeof(tempStr), "Temp: %d%s", displayTemp, tempUnit);
-
-#if defined(USE_BME280)
-    snprintf(statusLine1, sizeof(statusLine1), "%s  Humid: %d%%  Press: %dhPa", tempStr, humidity, pressure);
-#elif defined(USE_BMP280) || defined(USE_BMP180)
-    snprintf(statusLine1, sizeof(statusLine1), "%s  Pressure: %d hPa", tempStr, pressure);
-#elif defined(USE_SHT3X) || defined(USE_HTU21D)
-    snprintf(statusLine1, sizeof(statusLine1), "%s  Humidity: %d%%", tempStr, humidity);
-#else
-    snprintf(statusLine1, sizeof(statusLine1), "%s", tempStr);
-#endif
+    formatSensorLine(statusLine1, sizeof(statusLine1), displayTemp, tempUnit);
   } else {
     snprintf(statusLine1, sizeof(statusLine1), "Sensor: Not detected");
   }
   doc["statusLine1"] = statusLine1;
-  doc["statusLine2"] = String(dbuf) + "  " + String(cfg.tz);
 
   // Hardware info (static)
   doc["board"] = "ESP32 Touchdown";
@@ -1948,15 +2095,8 @@ static void handleGetState() {
   String sensorInfo;
   if (sensorAvailable) {
     sensorInfo = String(sensorType);
-#if defined(USE_BME280)
-    sensorInfo += " (Temp/Humid/Press)";
-#elif defined(USE_BMP280)
-    sensorInfo += " (Temp/Press)";
-#elif defined(USE_BMP180)
-    sensorInfo += " (Temp/Press)";
-#else
-    sensorInfo += " (Temp/Humid)";
-#endif
+    sensorInfo += (sensorMeasures & SENSOR_HUMIDITY) ? " (Temp/Humid" : " (Temp";
+    sensorInfo += (sensorMeasures & SENSOR_PRESSURE) ? "/Press)" : ")";
   } else {
     sensorInfo = "None detected";
   }
@@ -1965,11 +2105,111 @@ static void handleGetState() {
   doc["firmware"] = FIRMWARE_VERSION;
   doc["otaEnabled"] = true;
 
+  stateCacheJson = "";
+  serializeJson(doc, stateCacheJson);
+  stateCacheJson.setCharAt(stateCacheJson.length() - 1, ',');  // Volatile fields follow
+  stateCacheHash = fnv1a(stateCacheJson.c_str(), stateCacheJson.length());
+
+  // statusLine2 embeds the timezone name, which may need escaping
+  JsonDocument tzDoc;
+  tzDoc.set(cfg.tz);
+  stateCacheTz = "";
+  serializeJson(tzDoc, stateCacheTz);
+  stateCacheTz = stateCacheTz.substring(1, stateCacheTz.length() - 1);
+}
+
+/**
+ * GET /api/state
+ *
+ * Returns comprehensive system state as JSON for web interface.
+ *
+ * Response includes:
+ * - Time & Network: current time, date, WiFi SSID, IP address
+ * - Configuration: timezone, NTP server, time format, date format, LED settings, brightness, debug level
+ * - System Diagnostics: uptime (seconds), free heap, total heap size, CPU frequency
+ * - Hardware Info: board type, display model, sensor status, firmware version, OTA status
+ *
+ * Only the volatile fields (time, date, uptime, heap, CPU clock, repaint
+ * counters) are formatted per request; the rest comes from the state cache.
+ * The ETag is weak and follows the cache version only: a client sending
+ * If-None-Match gets a 304 without a body until the config, a sensor reading,
+ * the WiFi link or the minute changes. The web UI keeps its clock and uptime
+ * ticking locally between full responses.
+ *
+ * This endpoint is polled by the web interface every second to update:
+ * - Live clock display
+ * - System diagnostics panel
+ * - Configuration field values
+ * - Display mirror state
+ */
+static void handleGetState(AsyncWebServerRequest* request) {
+  PERF_SCOPE(PERF_HANDLE_CLIENT);
+  DBG_VERBOSE("Web: GET /api/state from %s\n", request->client()->remoteIP().toString().c_str());
+
+  const uint32_t version = stateCacheVersion.load(std::memory_order_relaxed);
+  if (version != stateCacheBuiltVersion) {
+    buildStateCache();
+    stateCacheBuiltVersion = version;
+  }
+
+  // The cached fields decide the tag; the volatile fields below may differ
+  // between two responses with the same tag, hence W/
+  uint32_t hash = fnv1a(stateCacheTz.c_str(), stateCacheTz.length(), stateCacheHash);
+  char etag[14];
+  snprintf(etag, sizeof(etag), "W/\"%08lx\"", (unsigned long)hash);
+
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+    return;
+  }
+
+  struct tm ti{};
+  bool ok = getTimeSnapshot(ti);  // Never waits (see storeTimeSnapshot)
+  char tbuf[16] = "--:--:--";
+  char dbuf[16] = "----/--/--";
+  if (ok) {
+    strftime(tbuf, sizeof(tbuf), "%H:%M:%S", &ti);
+    formatDate(ti, dbuf, sizeof(dbuf));  // Use configured date format
+  }
+
+  // Volatile fields close the object left open by the cache.
+  // statusLine2 matches the TFT status bar.
+  char dyn[256];
+  int n = snprintf(dyn, sizeof(dyn),
+                   "\"time\":\"%s\",\"date\":\"%s\",\"uptime\":%lu,\"freeHeap\":%lu,\"cpuFreq\":%lu,"
+                   "\"spiWindows\":%lu,\"changedLeds\":%lu,\"statusLine2\":\"%s  ",
+                   tbuf, dbuf,
+                   (unsigned long)(millis() / 1000),
+                   (unsigned long)ESP.getFreeHeap(),
+                   (unsigned long)ESP.getCpuFreqMHz(),
+                   (unsigned long)spiWindowsLastFrame,     // TFT address windows in the last repaint
+                   (unsigned long)changedLedsLastFrame,    // LEDs changed in the last repaint
+                   dbuf);
+  n = constrain(n, 0, (int)sizeof(dyn) - 1);
+
   String out;
-  serializeJson(doc, out);
-  server.send(200, "application/json", out);
+  out.reserve(stateCacheJson.length() + n + stateCacheTz.length() + 4);
+  out = stateCacheJson;
+  out += dyn;
+  out += stateCacheTz;
+  out += "\"}";
+
+  AsyncWebServerResponse* response = request->beginResponse(200, "application/json", out);
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");  // Revalidate every poll
+  request->send(response);
 }
 
+// Config update from POST /api/config, waiting for the render task. The
+// handler runs on the AsyncTCP task and must not wait on a frame or write
+// NVS, so it only validates into here.
+static AppConfig pendingConfig;
+static bool pendingConfigValid = false;
+static portMUX_TYPE pendingConfigMux = portMUX_INITIALIZER_UNLOCKED;
+
 /**
  * POST /api/config
  *
@@ -1980,8 +2220,8 @@ static void handleGetState() {
  * - Logs before/after values for each changed field to Serial monitor
  * - Includes client IP address in all log messages
  * - Validates and constrains all input values
- * - Persists changes to NVS (Non-Volatile Storage)
- * - Applies time configuration (timezone, NTP, format) immediately
+ * - Hands the result to the render task, which applies it between frames and
+ *   persists it to NVS (this runs on the AsyncTCP task: no display or NVS access)
  *
  * Accepts JSON body with optional fields:
  * - tz: Timezone name (IANA format)
@@ -1990,113 +2230,149 @@ static void handleGetState() {
  * - dateFormat: Integer 0-4 for date format selection
  * - ledDiameter: Integer 1-10 for LED dot size
  * - ledGap: Integer 0-8 for spacing between LEDs
+ * - ledShape: Integer 0-2 for LED dot shape (0=square, 1=round, 2=glow)
+ * - ledDimming: Integer 0-2 for the fade/glow brightness curve (0=linear, 1=gamma, 2=gamma + dithering)
  * - ledColor: RGB888 color value (0-16777215)
  * - brightness: Integer 0-255 for backlight brightness
+ * - morphSpeed: Integer 1-50 morph duration multiplier
+ * - morphStyle: Integer 0-1 for the 7-segment digit transition (0=spawn, 1=pixel pairs)
  * - flipDisplay: Boolean for display rotation (false=normal, true=180° flip)
  * - debugLevel: Integer 0-4 for logging verbosity
+ * - renderMode: Integer 0-1 for TFT render path (0=delta rectangles, 1=line bands)
  */
-static void handlePostConfig() {
-  String clientIP = server.client().remoteIP().toString();
+static void handlePostConfig(AsyncWebServerRequest* request, JsonVariant& json) {
+  PERF_SCOPE(PERF_HANDLE_CLIENT);
+  String clientIP = request->client()->remoteIP().toString();
   DBG_INFO("Web: POST /api/config from %s\n", clientIP.c_str());
 
-  if (!server.hasArg("plain")) {
-    DBG_WARN("Config update failed: missing body\n");
-    server.send(400, "text/plain", "missing body");
+  // Body was parsed by AsyncCallbackJsonWebHandler (malformed JSON never gets here)
+  if (!json.is<JsonObject>()) {
+    DBG_WARN("Config update failed: body is not a JSON object\n");
+    request->send(400, "text/plain", "bad json");
     return;
   }
+  JsonObject doc = json.as<JsonObject>();
 
-  JsonDocument doc;
-  auto err = deserializeJson(doc, server.arg("plain"));
-  if (err) {
-    DBG_WARN("Config update failed: bad json\n");
-    server.send(400, "text/plain", "bad json");
-    return;
-  }
+  // Build on an update that is still waiting for the render task, if any
+  AppConfig next;
+  portENTER_CRITICAL(&pendingConfigMux);
+  next = pendingConfigValid ? pendingConfig : cfg;
+  portEXIT_CRITICAL(&pendingConfigMux);
 
   // Capture old values for logging
   char oldTz[64];
   char oldNtp[64];
-  bool oldUse24h = cfg.use24h;
-  uint8_t oldDateFormat = cfg.dateFormat;
-  uint8_t oldLedDiameter = cfg.ledDiameter;
-  uint8_t oldLedGap = cfg.ledGap;
-  uint32_t oldLedColor = cfg.ledColor;
-  uint8_t oldBrightness = cfg.brightness;
-  bool oldFlipDisplay = cfg.flipDisplay;
-  strlcpy(oldTz, cfg.tz, sizeof(oldTz));
-  strlcpy(oldNtp, cfg.ntp, sizeof(oldNtp));
+  bool oldUse24h = next.use24h;
+  uint8_t oldDateFormat = next.dateFormat;
+  uint8_t oldLedDiameter = next.ledDiameter;
+  uint8_t oldLedGap = next.ledGap;
+  uint32_t oldLedColor = next.ledColor;
+  uint8_t oldBrightness = next.brightness;
+  bool oldFlipDisplay = next.flipDisplay;
+  strlcpy(oldTz, next.tz, sizeof(oldTz));
+  strlcpy(oldNtp, next.ntp, sizeof(oldNtp));
 
   // Update config and log each change
   if (!doc["tz"].isNull()) {
-    strlcpy(cfg.tz, doc["tz"].as<const char*>(), sizeof(cfg.tz));
-    if (strcmp(oldTz, cfg.tz) != 0) {
-      DBG_INFO("  [%s] Timezone changed: '%s' -> '%s'\n", clientIP.c_str(), oldTz, cfg.tz);
+    strlcpy(next.tz, doc["tz"].as<const char*>(), sizeof(next.tz));
+    if (strcmp(oldTz, next.tz) != 0) {
+      DBG_INFO("  [%s] Timezone changed: '%s' -> '%s'\n", clientIP.c_str(), oldTz, next.tz);
     }
   }
 
   if (!doc["ntp"].isNull()) {
-    strlcpy(cfg.ntp, doc["ntp"].as<const char*>(), sizeof(cfg.ntp));
-    if (strcmp(oldNtp, cfg.ntp) != 0) {
-      DBG_INFO("  [%s] NTP server changed: '%s' -> '%s'\n", clientIP.c_str(), oldNtp, cfg.ntp);
+    strlcpy(next.ntp, doc["ntp"].as<const char*>(), sizeof(next.ntp));
+    if (strcmp(oldNtp, next.ntp) != 0) {
+      DBG_INFO("  [%s] NTP server changed: '%s' -> '%s'\n", clientIP.c_str(), oldNtp, next.ntp);
     }
   }
 
   if (!doc["use24h"].isNull()) {
-    cfg.use24h = doc["use24h"].as<bool>();
-    if (oldUse24h != cfg.use24h) {
+    next.use24h = doc["use24h"].as<bool>();
+    if (oldUse24h != next.use24h) {
       DBG_INFO("  [%s] Time format changed: %s -> %s\n", clientIP.c_str(),
-               oldUse24h ? "24h" : "12h", cfg.use24h ? "24h" : "12h");
+               oldUse24h ? "24h" : "12h", next.use24h ? "24h" : "12h");
     }
   }
 
   if (!doc["dateFormat"].isNull()) {
-    cfg.dateFormat = (uint8_t)constrain(doc["dateFormat"].as<int>(), 0, 4);
-    if (oldDateFormat != cfg.dateFormat) {
+    next.dateFormat = (uint8_t)constrain(doc["dateFormat"].as<int>(), 0, 4);
+    if (oldDateFormat != next.dateFormat) {
       const char* formats[] = {"YYYY-MM-DD", "DD/MM/YYYY", "MM/DD/YYYY", "DD.MM.YYYY", "Mon DD, YYYY"};
       DBG_INFO("  [%s] Date format changed: %s -> %s\n", clientIP.c_str(),
-               formats[oldDateFormat], formats[cfg.dateFormat]);
+               formats[oldDateFormat], formats[next.dateFormat]);
     }
   }
 
   if (!doc["ledDiameter"].isNull()) {
-    cfg.ledDiameter = (uint8_t)doc["ledDiameter"].as<int>();
-    if (oldLedDiameter != cfg.ledDiameter) {
+    next.ledDiameter = (uint8_t)doc["ledDiameter"].as<int>();
+    if (oldLedDiameter != next.ledDiameter) {
       DBG_INFO("  [%s] LED diameter changed: %d -> %d px\n", clientIP.c_str(),
-               oldLedDiameter, cfg.ledDiameter);
+               oldLedDiameter, next.ledDiameter);
     }
   }
 
   if (!doc["ledGap"].isNull()) {
-    cfg.ledGap = (uint8_t)doc["ledGap"].as<int>();
-    if (oldLedGap != cfg.ledGap) {
+    next.ledGap = (uint8_t)doc["ledGap"].as<int>();
+    if (oldLedGap != next.ledGap) {
       DBG_INFO("  [%s] LED gap changed: %d -> %d px\n", clientIP.c_str(),
-               oldLedGap, cfg.ledGap);
+               oldLedGap, next.ledGap);
+    }
+  }
+
+  if (!doc["ledShape"].isNull()) {
+    uint8_t oldLedShape = next.ledShape;
+    next.ledShape = (uint8_t)constrain(doc["ledShape"].as<int>(), LED_SHAPE_SQUARE, LED_SHAPE_GLOW);
+    if (oldLedShape != next.ledShape) {
+      const char* shapes[] = {"Square", "Round", "Glow"};
+      DBG_INFO("  [%s] LED shape changed: %s -> %s\n", clientIP.c_str(),
+               shapes[oldLedShape], shapes[next.ledShape]);
+    }
+  }
+
+  if (!doc["ledDimming"].isNull()) {
+    uint8_t oldLedDimming = next.ledDimming;
+    next.ledDimming = (uint8_t)constrain(doc["ledDimming"].as<int>(), LED_DIM_LINEAR, LED_DIM_DITHER);
+    if (oldLedDimming != next.ledDimming) {
+      const char* curves[] = {"Linear", "Gamma", "Gamma + Dither"};
+      DBG_INFO("  [%s] LED dimming changed: %s -> %s\n", clientIP.c_str(),
+               curves[oldLedDimming], curves[next.ledDimming]);
     }
   }
 
   if (!doc["ledColor"].isNull()) {
-    cfg.ledColor = doc["ledColor"].as<uint32_t>();
-    if (oldLedColor != cfg.ledColor) {
+    next.ledColor = doc["ledColor"].as<uint32_t>();
+    if (oldLedColor != next.ledColor) {
       DBG_INFO("  [%s] LED color changed: #%06X -> #%06X\n", clientIP.c_str(),
-               (unsigned int)oldLedColor, (unsigned int)cfg.ledColor);
+               (unsigned int)oldLedColor, (unsigned int)next.ledColor);
     }
   }
 
   if (!doc["brightness"].isNull()) {
-    cfg.brightness = (uint8_t)doc["brightness"].as<int>();
-    if (oldBrightness != cfg.brightness) {
+    next.brightness = (uint8_t)doc["brightness"].as<int>();
+    if (oldBrightness != next.brightness) {
       DBG_INFO("  [%s] Brightness changed: %d -> %d\n", clientIP.c_str(),
-               oldBrightness, cfg.brightness);
+               oldBrightness, next.brightness);
     }
   }
 
   // Morphing speed
   if (!doc["morphSpeed"].isNull()) {
-    uint8_t oldMorphSpeed = cfg.morphSpeed;
-    cfg.morphSpeed = (uint8_t)constrain(doc["morphSpeed"].as<int>(), 1, 50);
-    if (oldMorphSpeed != cfg.morphSpeed) {
+    uint8_t oldMorphSpeed = next.morphSpeed;
+    next.morphSpeed = (uint8_t)constrain(doc["morphSpeed"].as<int>(), 1, 50);
+    if (oldMorphSpeed != next.morphSpeed) {
       DBG_INFO("  [%s] Morph speed changed: %dx -> %dx\n", clientIP.c_str(),
-               oldMorphSpeed, cfg.morphSpeed);
+               oldMorphSpeed, next.morphSpeed);
+    }
+  }
+
+  if (!doc["morphStyle"].isNull()) {
+    uint8_t oldMorphStyle = next.morphStyle;
+    next.morphStyle = (uint8_t)constrain(doc["morphStyle"].as<int>(), MORPH_STYLE_SPAWN, MORPH_STYLE_PAIRS);
+    if (oldMorphStyle != next.morphStyle) {
+      const char* styles[] = {"Spawn", "Pixel Pairs"};
+      DBG_INFO("  [%s] Morph style changed: %s -> %s\n", clientIP.c_str(),
+               styles[oldMorphStyle], styles[next.morphStyle]);
     }
   }
 
@@ -2111,163 +2387,621 @@ static void handlePostConfig() {
     }
   }
 
+  // Render path
+  if (!doc["renderMode"].isNull()) {
+    uint8_t oldRenderMode = next.renderMode;
+    next.renderMode = (uint8_t)constrain(doc["renderMode"].as<int>(), RENDER_MODE_DELTA, RENDER_MODE_BAND);
+    if (oldRenderMode != next.renderMode) {
+      const char* modes[] = {"Delta", "Band"};
+      DBG_INFO("  [%s] Render mode changed: %s -> %s\n", clientIP.c_str(),
+               modes[oldRenderMode], modes[next.renderMode]);
+    }
+  }
+
   // Flip display
   if (!doc["flipDisplay"].isNull()) {
-    cfg.flipDisplay = doc["flipDisplay"].as<bool>();
-    if (oldFlipDisplay != cfg.flipDisplay) {
+    next.flipDisplay = doc["flipDisplay"].as<bool>();
+    if (oldFlipDisplay != next.flipDisplay) {
       DBG_INFO("  [%s] Display flip changed: %s -> %s\n", clientIP.c_str(),
                oldFlipDisplay ? "flipped" : "normal",
-               cfg.flipDisplay ? "flipped" : "normal");
-      applyDisplayRotation();  // Apply rotation immediately
-      tft.fillScreen(TFT_BLACK);  // Clear screen after rotation change
-      memset(fbPrev, 0, sizeof(fbPrev));  // Reset delta buffer to force full redraw
-      resetStatusBar();  // Force status bar redraw
+               next.flipDisplay ? "flipped" : "normal");
     }
   }
 
   // Temperature unit
   if (!doc["useFahrenheit"].isNull()) {
-    bool oldUseFahrenheit = cfg.useFahrenheit;
-    cfg.useFahrenheit = doc["useFahrenheit"].as<bool>();
-    if (oldUseFahrenheit != cfg.useFahrenheit) {
+    bool oldUseFahrenheit = next.useFahrenheit;
+    next.useFahrenheit = doc["useFahrenheit"].as<bool>();
+    if (oldUseFahrenheit != next.useFahrenheit) {
       DBG_INFO("  [%s] Temperature unit changed: %s -> %s\n", clientIP.c_str(),
                oldUseFahrenheit ? "°F" : "°C",
-               cfg.useFahrenheit ? "°F" : "°C");
+               next.useFahrenheit ? "°F" : "°C");
     }
   }
 
   // Clock Mode
   if (!doc["clockMode"].isNull()) {
-    uint8_t oldClockMode = cfg.clockMode;
+    uint8_t oldClockMode = next.clockMode;
     uint8_t newClockMode = (uint8_t)constrain(doc["clockMode"].as<int>(), 0, TOTAL_CLOCK_MODES - 1);
     if (oldClockMode != newClockMode) {
       const char* modes[] = {"Morphing (Classic)", "Tetris", "Morphing (Remix)"};
       DBG_INFO("  [%s] Clock mode changed: %s -> %s\n", clientIP.c_str(),
                modes[oldClockMode], modes[newClockMode]);
-      // Update config first
-      cfg.clockMode = newClockMode;
-      // Update render pitch for new mode (affects status bar height) BEFORE clearing
-      updateRenderPitch();
-      // Full TFT clear for clean transition - must happen AFTER updateRenderPitch
-      tft.fillScreen(TFT_BLACK);
-      // Clear the framebuffer
-      fbClear();
-      // Sync fbPrev with the cleared TFT state (all zeros) for clean comparison
-      memset(fbPrev, 0, sizeof(fbPrev));
-      resetStatusBar();
-      // Reset Tetris clock to force all digits to rebuild with falling blocks
-      if (newClockMode == CLOCK_MODE_TETRIS && tetrisClock) {
-        tetrisClock->reset();
-      }
+      next.clockMode = newClockMode;
     }
   }
 
   // Auto-Rotate
   if (!doc["autoRotate"].isNull()) {
-    bool oldAutoRotate = cfg.autoRotate;
-    cfg.autoRotate = doc["autoRotate"].as<bool>();
-    if (oldAutoRotate != cfg.autoRotate) {
+    bool oldAutoRotate = next.autoRotate;
+    next.autoRotate = doc["autoRotate"].as<bool>();
+    if (oldAutoRotate != next.autoRotate) {
       DBG_INFO("  [%s] Auto-rotate changed: %s -> %s\n", clientIP.c_str(),
                oldAutoRotate ? "ON" : "OFF",
-               cfg.autoRotate ? "ON" : "OFF");
-      if (cfg.autoRotate) {
-        lastModeRotation = millis();  // Reset timer when enabling
-      }
+               next.autoRotate ? "ON" : "OFF");
     }
   }
 
   // Rotation Interval
   if (!doc["rotateInterval"].isNull()) {
-    uint8_t oldRotateInterval = cfg.rotateInterval;
-    cfg.rotateInterval = (uint8_t)constrain(doc["rotateInterval"].as<int>(), 1, 60);
-    if (oldRotateInterval != cfg.rotateInterval) {
+    uint8_t oldRotateInterval = next.rotateInterval;
+    next.rotateInterval = (uint8_t)constrain(doc["rotateInterval"].as<int>(), 1, 60);
+    if (oldRotateInterval != next.rotateInterval) {
       DBG_INFO("  [%s] Rotation interval changed: %d -> %d min\n", clientIP.c_str(),
-               oldRotateInterval, cfg.rotateInterval);
+               oldRotateInterval, next.rotateInterval);
     }
   }
 
   // Morphing (Remix) mode - Show Sensor
   if (!doc["morphShowSensor"].isNull()) {
-    bool oldShowSensor = cfg.morphShowSensor;
-    cfg.morphShowSensor = doc["morphShowSensor"].as<bool>();
-    if (oldShowSensor != cfg.morphShowSensor) {
+    bool oldShowSensor = next.morphShowSensor;
+    next.morphShowSensor = doc["morphShowSensor"].as<bool>();
+    if (oldShowSensor != next.morphShowSensor) {
       DBG_INFO("  [%s] Morph show sensor changed: %s -> %s\n", clientIP.c_str(),
                oldShowSensor ? "ON" : "OFF",
-               cfg.morphShowSensor ? "ON" : "OFF");
+               next.morphShowSensor ? "ON" : "OFF");
     }
   }
 
   // Morphing (Remix) mode - Show Date
   if (!doc["morphShowDate"].isNull()) {
-    bool oldShowDate = cfg.morphShowDate;
-    cfg.morphShowDate = doc["morphShowDate"].as<bool>();
-    if (oldShowDate != cfg.morphShowDate) {
+    bool oldShowDate = next.morphShowDate;
+    next.morphShowDate = doc["morphShowDate"].as<bool>();
+    if (oldShowDate != next.morphShowDate) {
       DBG_INFO("  [%s] Morph show date changed: %s -> %s\n", clientIP.c_str(),
                oldShowDate ? "ON" : "OFF",
-               cfg.morphShowDate ? "ON" : "OFF");
+               next.morphShowDate ? "ON" : "OFF");
     }
   }
 
   // Morphing (Remix) mode - Sensor Color
   if (!doc["morphSensorColor"].isNull()) {
-    uint32_t oldColor = cfg.morphSensorColor;
-    cfg.morphSensorColor = doc["morphSensorColor"].as<uint32_t>();
-    if (oldColor != cfg.morphSensorColor) {
+    uint32_t oldColor = next.morphSensorColor;
+    next.morphSensorColor = doc["morphSensorColor"].as<uint32_t>();
+    if (oldColor != next.morphSensorColor) {
       DBG_INFO("  [%s] Morph sensor color changed: #%06X -> #%06X\n", clientIP.c_str(),
-               (unsigned)oldColor, (unsigned)cfg.morphSensorColor);
+               (unsigned)oldColor, (unsigned)next.morphSensorColor);
     }
   }
 
   // Morphing (Remix) mode - Date Color
   if (!doc["morphDateColor"].isNull()) {
-    uint32_t oldColor = cfg.morphDateColor;
-    cfg.morphDateColor = doc["morphDateColor"].as<uint32_t>();
-    if (oldColor != cfg.morphDateColor) {
+    uint32_t oldColor = next.morphDateColor;
+    next.morphDateColor = doc["morphDateColor"].as<uint32_t>();
+    if (oldColor != next.morphDateColor) {
       DBG_INFO("  [%s] Morph date color changed: #%06X -> #%06X\n", clientIP.c_str(),
-               (unsigned)oldColor, (unsigned)cfg.morphDateColor);
+               (unsigned)oldColor, (unsigned)next.morphDateColor);
     }
   }
 
   // Constrain LED rendering parameters
   // ledDiameter: max size of each LED dot (pitch is typically 7 for 480x320)
   // ledGap: space between LEDs (gap + dot <= pitch)
-  cfg.ledDiameter = constrain(cfg.ledDiameter, 1, 10);
-  cfg.ledGap      = constrain(cfg.ledGap, 0, 8);
+  next.ledDiameter = constrain(next.ledDiameter, 1, 10);
+  next.ledGap      = constrain(next.ledGap, 0, 8);
 
-  saveConfig();
-  updateRenderPitch();  // Rebuild sprite if pitch changed
-  startNtp();
+  // Hand over to the render task, which applies and saves it (applyPendingConfig())
+  portENTER_CRITICAL(&pendingConfigMux);
+  pendingConfig = next;
+  pendingConfigValid = true;
+  portEXIT_CRITICAL(&pendingConfigMux);
+  requestRender();
+
+  request->send(200, "application/json", "{\"ok\":true}");
+}
+
+/**
+ * Apply a config update posted by handlePostConfig() (render task)
+ * Redraws what the change invalidates, restarts NTP if the time source
+ * changed, and saves to NVS.
+ */
+static void applyPendingConfig() {
+  AppConfig next;
+  portENTER_CRITICAL(&pendingConfigMux);
+  const bool pending = pendingConfigValid;
+  if (pending) next = pendingConfig;
+  pendingConfigValid = false;
+  portEXIT_CRITICAL(&pendingConfigMux);
+  if (!pending) return;
+
+  const AppConfig old = cfg;
+  cfg = next;
+
+  bool clearScreen = false;
+  if (cfg.flipDisplay != old.flipDisplay) {
+    applyDisplayRotation();
+    clearScreen = true;
+  }
+  if (cfg.ledShape != old.ledShape) {
+    clearScreen = true;  // Delta renderer only redraws changed LEDs
+  }
+
+  updateRenderPitch();  // Rebuild sprite if pitch or status bar height changed
+
+  if (cfg.clockMode != old.clockMode) {
+    fbClear();
+    clearScreen = true;
+    // Reset Tetris clock to force all digits to rebuild with falling blocks
+    if (cfg.clockMode == CLOCK_MODE_TETRIS && tetrisClock) {
+      tetrisClock->reset();
+    }
+  }
+  if (clearScreen) {
+    tft.fillScreen(TFT_BLACK);
+    memset(fbPrev, 0, sizeof(fbPrev));  // Reset delta buffer to force full redraw
+    resetStatusBar();
+  }
+
+  if (cfg.autoRotate && !old.autoRotate) {
+    lastModeRotation = millis();  // Reset timer when enabling
+  }
+  if (strcmp(cfg.tz, old.tz) != 0 || strcmp(cfg.ntp, old.ntp) != 0) {
+    startNtp();
+  }
   setBacklight(cfg.brightness);
+  saveConfig();
+}
+
+// =========================
+// On-device color scaling benchmark (/api/perf?bench=1)
+// =========================
+// Host timings cannot show what scale565() saves on the ESP32: the host
+// compiler turns the old /255 into a multiply and shift. These kernels run
+// the old per-channel divide and scale565() on the target, out of line so
+// both pay the same call, and report CPU cycles per call (independent of
+// frequency scaling).
+#define COLOR_BENCH_CALLS 4096
+#define COLOR_BENCH_REPEATS 3
+
+static uint16_t __attribute__((noinline)) colorBenchNone(uint16_t c, uint8_t) {
+  return c;
+}
+
+static uint16_t __attribute__((noinline)) colorBenchScale565(uint16_t c, uint8_t level) {
+  return scale565(c, level);
+}
+
+// What every brightness and fade path did before scale565()
+static uint16_t __attribute__((noinline)) colorBenchDivide(uint16_t c, uint8_t level) {
+  uint8_t r = ((c >> 11) & 0x1F) * level / 255;
+  uint8_t g = ((c >> 5) & 0x3F) * level / 255;
+  uint8_t b = (c & 0x1F) * level / 255;
+  return (r << 11) | (g << 5) | b;
+}
+
+// Fewest cycles for COLOR_BENCH_CALLS calls over a few repeats (least preemption)
+static uint32_t __attribute__((noinline)) colorBenchCycles(uint16_t (*kernel)(uint16_t, uint8_t)) {
+  static volatile uint16_t sink;
+  uint32_t best = UINT32_MAX;
+  for (uint8_t rep = 0; rep < COLOR_BENCH_REPEATS; rep++) {
+    const uint32_t start = ESP.getCycleCount();
+    for (uint32_t i = 0; i < COLOR_BENCH_CALLS; i++) {
+      sink = kernel((uint16_t)(i * 1031u + 0x5A5A), (uint8_t)(i * 37));
+    }
+    best = min(best, ESP.getCycleCount() - start);
+  }
+  return best;
+}
+
+static void benchColorScale(JsonObject out) {
+  const uint32_t none = colorBenchCycles(colorBenchNone);  // Loop and call overhead
+  const uint32_t fast = colorBenchCycles(colorBenchScale565);
+  const uint32_t divide = colorBenchCycles(colorBenchDivide);
+  out["calls"] = COLOR_BENCH_CALLS;
+  out["scale565Cycles"] = (float)(fast - min(fast, none)) / COLOR_BENCH_CALLS;
+  out["divideCycles"] = (float)(divide - min(divide, none)) / COLOR_BENCH_CALLS;
+}
+
+/**
+ * GET /api/perf - frame timing and section statistics
+ * Optional ?reset=1 clears the statistics after they are returned;
+ * ?bench=1 adds an on-device color scaling benchmark (about a millisecond)
+ */
+static void handleGetPerf(AsyncWebServerRequest* request) {
+  DBG_VERBOSE("Web: GET /api/perf from %s\n", request->client()->remoteIP().toString().c_str());
+
+  JsonDocument doc;
+  doc["enabled"] = (bool)ENABLE_PERF_STATS;
+  doc["uptimeMs"] = millis();
+  doc["cpuMHz"] = ESP.getCpuFreqMHz();
+  doc["fps"] = Perf::fps();
+  doc["renderIdlePct"] = Perf::idlePercent();
+  doc["frames"] = Perf::frames();
+
+  JsonObject leds = doc["changedLeds"].to<JsonObject>();
+  leds["last"] = Perf::changedLedsLast();
+  leds["max"] = Perf::changedLedsMax();
+  leds["mean"] = Perf::changedLedsMean();
+
+  // Histogram bucket lower bounds, shared by all sections
+  JsonArray buckets = doc["histBucketsUs"].to<JsonArray>();
+  for (uint8_t b = 0; b < PERF_HIST_BUCKETS; b++) buckets.add(Perf::bucketFloorUs(b));
+
+  JsonObject sections = doc["sections"].to<JsonObject>();
+  for (uint8_t i = 0; i < PERF_SECTION_COUNT; i++) {
+    const PerfStat& st = Perf::stat((PerfSection)i);
+    JsonObject o = sections[Perf::name((PerfSection)i)].to<JsonObject>();
+    o["count"] = st.count;
+    o["minUs"] = st.minUs;
+    o["maxUs"] = st.maxUs;
+    o["meanUs"] = st.count ? (uint32_t)(st.totalUs / st.count) : 0;
+    o["skipped"] = st.skipped;
+    JsonArray hist = o["hist"].to<JsonArray>();
+    for (uint8_t b = 0; b < PERF_HIST_BUCKETS; b++) hist.add(st.hist[b]);
+  }
+
+  JsonObject mirror = doc["mirror"].to<JsonObject>();
+  mirror["clients"] = mirrorStream.clients();
+  mirror["keyframes"] = mirrorStream.keyframes();
+  mirror["deltas"] = mirrorStream.deltas();
+  mirror["bytesSent"] = mirrorStream.bytesSent();
+  mirror["bytesRaw"] = mirrorStream.bytesRaw();
+
+  doc["morphTableBytes"] = morphTableBytes();
+
+  // CPU frequency scaling: time at each frequency and boosts per client
+  JsonObject power = doc["power"].to<JsonObject>();
+  power["scaling"] = Power::scaling();
+  power["minMHz"] = POWER_MIN_MHZ;
+  power["maxMHz"] = POWER_MAX_MHZ;
+  JsonObject residency = power["msAtMHz"].to<JsonObject>();
+  for (uint8_t slot = 0; slot < Power::freqSlots(); slot++) {
+    char key[8];
+    snprintf(key, sizeof(key), "%lu", (unsigned long)Power::freqMHz(slot));
+    residency[key] = Power::freqMs(slot);
+  }
+  JsonObject boosts = power["boosts"].to<JsonObject>();
+  for (uint8_t c = 0; c < POWER_CLIENT_COUNT; c++) {
+    boosts[Power::name((PowerClient)c)] = Power::boosts((PowerClient)c);
+  }
+
+  // I2C bus: queue wait and bus time per device
+  JsonObject i2c = doc["i2c"].to<JsonObject>();
+  for (uint8_t d = 0; d < I2C_DEV_COUNT; d++) {
+    const I2CDeviceStats& st = I2CBus::stats((I2CDevice)d);
+    JsonObject dev = i2c[I2CBus::name((I2CDevice)d)].to<JsonObject>();
+    dev["jobs"] = st.jobs;
+    dev["errors"] = st.errors;
+    dev["meanWaitUs"] = st.jobs ? (uint32_t)(st.totalWaitUs / st.jobs) : 0;
+    dev["maxWaitUs"] = st.maxWaitUs;
+    dev["meanRunUs"] = st.jobs ? (uint32_t)(st.totalRunUs / st.jobs) : 0;
+    dev["maxRunUs"] = st.maxRunUs;
+  }
+
+  // Sensor measurements per detected sensor: trigger to result
+  JsonArray sensors = doc["sensors"].to<JsonArray>();
+  for (uint8_t i = 0; i < Sensors::count(); i++) {
+    SensorDriver* driver = Sensors::get(i);
+    JsonObject sensor = sensors.add<JsonObject>();
+    sensor["type"] = driver->name();
+    sensor["address"] = driver->address();
+    sensor["measurements"] = sensorStats[i].measurements;
+    sensor["errors"] = sensorStats[i].errors;
+    sensor["lastConversionMs"] = sensorStats[i].lastConversionMs;
+    sensor["maxConversionMs"] = sensorStats[i].maxConversionMs;
+  }
+
+  // Sensor history rings: memory used and samples kept per resolution
+  JsonObject history = doc["history"].to<JsonObject>();
+  history["bytes"] = History::ramBytes();
+  history["psram"] = History::inPsram();
+  JsonObject samples = history["samples"].to<JsonObject>();
+  for (uint8_t k = 0; k < HISTORY_TIER_COUNT; k++) {
+    samples[History::name((HistoryTier)k)] = History::capacity((HistoryTier)k);
+  }
+
+  if (request->hasParam("bench") && request->getParam("bench")->value() == "1") {
+    benchColorScale(doc["colorScale"].to<JsonObject>());
+  }
+
+  String out;
+  serializeJson(doc, out);
+
+  if (request->hasParam("reset") && request->getParam("reset")->value() == "1") {
+    Perf::reset();
+    Power::resetStats();
+    I2CBus::resetStats();
+    for (SensorStats& st : sensorStats) st.measurements = st.errors = st.maxConversionMs = 0;
+    DBG_INFO("Perf statistics reset\n");
+  }
 
-  server.send(200, "application/json", "{\"ok\":true}");
+  AsyncWebServerResponse* res = request->beginResponse(200, "application/json", out);
+  res->addHeader("Cache-Control", "no-store");
+  request->send(res);
 }
 
-static void handleGetMirror() {
+#define HISTORY_ROW_MAX 40   // Longest row: [4294967295,-3276.8,-3276.8,-3276.8],
+
+// One /api/history response being streamed
+struct HistoryStream {
+  HistoryCursor cursor;
+  uint8_t stage;      // 0 header, 1 rows, 2 footer, 3 done
+  bool firstRow;
+  char header[96];
+};
+
+// Append one history value in display units, or null
+static int formatHistoryValue(char* out, size_t len, const HistorySample& s, uint8_t channel) {
+  if (!(s.valid & (1 << channel))) return snprintf(out, len, ",null");
+  return snprintf(out, len, ",%.1f", s.value[channel] / 10.0f);
+}
+
+/**
+ * GET /api/history?from=&to=&res= - sensor history
+ * from/to: Unix time in seconds (default: the 24 hours up to now)
+ * res: 1m, 15m or 1h, or the period in seconds (default: the finest
+ * resolution that reaches back to from)
+ *
+ * Rows are [time, temp, hum, pres] (°C, %RH, hPa, null if missing); periods
+ * without any value are left out. The body is written a few rows at a time
+ * from the history ring buffers, so a year of samples needs no buffer.
+ */
+static void handleGetHistory(AsyncWebServerRequest* request) {
+  DBG_VERBOSE("Web: GET /api/history from %s\n", request->client()->remoteIP().toString().c_str());
+
+  const uint32_t now = time(nullptr);
+  const uint32_t to = request->hasParam("to") ? strtoul(request->getParam("to")->value().c_str(), nullptr, 10) : now;
+  const uint32_t from = request->hasParam("from") ? strtoul(request->getParam("from")->value().c_str(), nullptr, 10)
+                                                  : (to > 86400 ? to - 86400 : 0);
+
+  int tier = -1;
+  if (request->hasParam("res")) {
+    const String& res = request->getParam("res")->value();
+    for (uint8_t k = 0; k < HISTORY_TIER_COUNT; k++) {
+      if (res == History::name((HistoryTier)k) || res.toInt() == (long)History::period((HistoryTier)k)) tier = k;
+    }
+    if (tier < 0) {
+      request->send(400, "text/plain", "res must be 1m, 15m or 1h");
+      return;
+    }
+  } else {
+    // Finest resolution that reaches back to from, else the one reaching furthest
+    tier = HISTORY_1M;
+    uint32_t furthest = UINT32_MAX;
+    for (uint8_t k = 0; k < HISTORY_TIER_COUNT; k++) {
+      const uint32_t oldest = History::oldest((HistoryTier)k);
+      if (!oldest) continue;
+      if (oldest <= from + History::period((HistoryTier)k)) {
+        tier = k;
+        break;
+      }
+      if (oldest < furthest) {
+        furthest = oldest;
+        tier = k;
+      }
+    }
+  }
+
+  auto stream = std::make_shared<HistoryStream>();
+  History::open(stream->cursor, (HistoryTier)tier, from, to);
+  stream->stage = 0;
+  stream->firstRow = true;
+  snprintf(stream->header, sizeof(stream->header),
+           "{\"res\":%lu,\"from\":%lu,\"to\":%lu,\"fields\":[\"time\",\"temp\",\"hum\",\"pres\"],\"data\":[",
+           (unsigned long)History::period((HistoryTier)tier), (unsigned long)from, (unsigned long)to);
+
+  AsyncWebServerResponse* res = request->beginChunkedResponse("application/json",
+      [stream](uint8_t* buf, size_t maxLen, size_t) -> size_t {
+    char* out = (char*)buf;
+    size_t n = 0;
+
+    if (stream->stage == 0) {
+      const size_t len = strlen(stream->header);
+      if (maxLen < len) return RESPONSE_TRY_AGAIN;
+      memcpy(out, stream->header, len);
+      n = len;
+      stream->stage = 1;
+    }
+
+    if (stream->stage == 1) {
+      HistorySample samples[32];
+      uint16_t want = (maxLen - n) / HISTORY_ROW_MAX;
+      if (want > 32) want = 32;
+      if (want == 0) return n ? n : RESPONSE_TRY_AGAIN;
+
+      const uint16_t got = History::read(stream->cursor, samples, want);
+      for (uint16_t i = 0; i < got; i++) {
+        const HistorySample& s = samples[i];
+        n += snprintf(out + n, maxLen - n, "%s[%lu", stream->firstRow ? "" : ",", (unsigned long)s.time);
+        n += formatHistoryValue(out + n, maxLen - n, s, HISTORY_TEMP);
+        n += formatHistoryValue(out + n, maxLen - n, s, HISTORY_HUM);
+        n += formatHistoryValue(out + n, maxLen - n, s, HISTORY_PRES);
+        out[n++] = ']';
+        stream->firstRow = false;
+      }
+      if (got < want) stream->stage = 2;
+    }
+
+    if (stream->stage == 2 && maxLen - n >= 2) {
+      out[n++] = ']';
+      out[n++] = '}';
+      stream->stage = 3;
+    }
+    return n;  // 0 once done: ends the response
+  });
+  res->addHeader("Cache-Control", "no-store");
+  request->send(res);
+}
+
+static void handleGetMirror(AsyncWebServerRequest* request) {
+  PERF_SCOPE(PERF_HANDLE_CLIENT);
   // Framebuffer is now RGB565 (uint16_t), so 2 bytes per pixel
   const size_t fbSize = LED_MATRIX_W * LED_MATRIX_H * sizeof(uint16_t);  // 64 * 32 * 2 = 4096
   DBG_VERBOSE("Mirror: Sending %u bytes (RGB565)\n", (unsigned)fbSize);
-  server.sendHeader("Cache-Control", "no-store");
-  server.send_P(200, "application/octet-stream", (const char*)fb, fbSize);
+
+  // Copied into the response: the snapshot keeps changing after we return
+  AsyncResponseStream* res = request->beginResponseStream("application/octet-stream", fbSize);
+  res->addHeader("Cache-Control", "no-store");
+  if (mirrorFrameMutex) xSemaphoreTake(mirrorFrameMutex, portMAX_DELAY);
+  res->write((const uint8_t*)mirrorFrame.px, fbSize);
+  if (mirrorFrameMutex) xSemaphoreGive(mirrorFrameMutex);
+  request->send(res);
+}
+
+// =========================
+// Live mirror stream (WebSocket)
+// =========================
+// Same frames as /api/mirror, pushed as they are rendered and delta-encoded
+// per client by MirrorStream. Socket events arrive on the AsyncTCP task; the
+// network task encodes and sends. mirrorClientsMutex guards MirrorStream and
+// the slot table and is never held while calling into the WebSocket, so it
+// cannot deadlock against the library's own lock.
+
+static uint8_t mirrorTx[MirrorStream::MAX_MESSAGE];  // Network task only
+static uint32_t mirrorClientIds[MIRROR_WS_MAX_CLIENTS];  // AsyncWebSocket id per MirrorStream slot, 0 = free
+static SemaphoreHandle_t mirrorClientsMutex = nullptr;
+
+// MirrorStream slot of a socket client, or -1 (mirrorClientsMutex held)
+static int mirrorSlotOf(uint32_t id) {
+  for (uint8_t i = 0; i < MIRROR_WS_MAX_CLIENTS; i++) {
+    if (mirrorClientIds[i] == id) return i;
+  }
+  return -1;
+}
+
+static void onMirrorSocketEvent(AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type,
+                                void* arg, uint8_t* payload, size_t length) {
+  const uint32_t id = client->id();
+  switch (type) {
+    case WS_EVT_CONNECT: {
+      xSemaphoreTake(mirrorClientsMutex, portMAX_DELAY);
+      const int slot = mirrorSlotOf(0);
+      const bool ok = slot >= 0 && mirrorStream.open(slot);
+      if (ok) mirrorClientIds[slot] = id;
+      const uint8_t streaming = mirrorStream.clients();
+      xSemaphoreGive(mirrorClientsMutex);
+
+      if (!ok) {
+        DBG_WARN("Mirror WS: client %lu rejected (limit %d or out of memory)\n", (unsigned long)id, MIRROR_WS_MAX_CLIENTS);
+        client->close();
+        return;
+      }
+      DBG_INFO("Mirror WS: client %lu connected (%u streaming)\n", (unsigned long)id, streaming);
+      break;
+    }
+
+    case WS_EVT_DISCONNECT: {
+      xSemaphoreTake(mirrorClientsMutex, portMAX_DELAY);
+      const int slot = mirrorSlotOf(id);
+      if (slot >= 0) {
+        mirrorStream.close(slot);
+        mirrorClientIds[slot] = 0;
+      }
+      const uint8_t streaming = mirrorStream.clients();
+      xSemaphoreGive(mirrorClientsMutex);
+      if (slot >= 0) DBG_INFO("Mirror WS: client %lu disconnected (%u streaming)\n", (unsigned long)id, streaming);
+      break;
+    }
+
+    case WS_EVT_DATA: {
+      // Acks are 5 bytes: always a single, unfragmented binary frame
+      const AwsFrameInfo* info = (const AwsFrameInfo*)arg;
+      bool ok = false;
+      if (info->opcode == WS_BINARY && info->final && info->index == 0 && info->len == length) {
+        xSemaphoreTake(mirrorClientsMutex, portMAX_DELAY);
+        const int slot = mirrorSlotOf(id);
+        ok = slot >= 0 && mirrorStream.receive(slot, payload, length);
+        xSemaphoreGive(mirrorClientsMutex);
+      }
+      if (!ok) {
+        DBG_VERBOSE("Mirror WS: client %lu sent unexpected %u-byte message\n", (unsigned long)id, (unsigned)length);
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
 }
 
+/**
+ * Take the newest published frame into mirrorFrame (network task only)
+ */
+static void refreshMirrorFrame() {
+  const uint32_t id = frames.published();
+  if (id == mirrorFrameId) return;
+
+  const FrameBuffer& frame = frames.acquire();
+  if (mirrorFrameMutex) xSemaphoreTake(mirrorFrameMutex, portMAX_DELAY);
+  memcpy(mirrorFrame.px, frame.px, sizeof(mirrorFrame.px));
+  if (mirrorFrameMutex) xSemaphoreGive(mirrorFrameMutex);
+  mirrorFrameId = id;
+}
+
+/**
+ * Push the latest frame to mirror clients that are ready, and drop closed ones
+ */
+static void mirrorStreamLoop() {
+  refreshMirrorFrame();
+
+  static uint32_t lastCleanupMs = 0;
+  const uint32_t now = millis();
+  if (now - lastCleanupMs >= 1000) {
+    lastCleanupMs = now;
+    mirrorSocket.cleanupClients(MIRROR_WS_MAX_CLIENTS);
+  }
+
+  // mirrorFrame is only written by this task, so no lock is needed to read it
+  for (uint8_t i = 0; i < MIRROR_WS_MAX_CLIENTS; i++) {
+    xSemaphoreTake(mirrorClientsMutex, portMAX_DELAY);
+    const uint32_t id = mirrorClientIds[i];
+    const size_t n = id ? mirrorStream.encode(i, &mirrorFrame.px[0][0], mirrorFrameId, now, mirrorTx) : 0;
+    xSemaphoreGive(mirrorClientsMutex);
+    if (n) mirrorSocket.binary(id, mirrorTx, n);
+  }
+}
+
+/**
+ * Static web UI files, streamed from LittleFS in chunks as the TCP window allows
+ *
+ * The filesystem image is built by tools/build_web.py: every file is stored
+ * minified and gzipped (ESPAsyncWebServer serves "<path>.gz" with
+ * Content-Encoding: gzip when "<path>" does not exist), and everything except
+ * index.html lives under /assets/ with a content hash in its name. Those URLs
+ * change whenever the content does, so browsers may cache them forever;
+ * index.html is revalidated on every load to pick up new asset names.
+ */
 static void serveStaticFiles() {
-  server.on("/", HTTP_GET, []() {
-    DBG_VERBOSE("Web: GET / (index.html) from %s\n", server.client().remoteIP().toString().c_str());
-    File f = LittleFS.open("/index.html", "r");
-    if (!f) {
+  server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
+    DBG_VERBOSE("Web: GET / (index.html) from %s\n", request->client()->remoteIP().toString().c_str());
+    if (!LittleFS.exists("/index.html.gz") && !LittleFS.exists("/index.html")) {
       DBG_WARN("Web: index.html not found\n");
-      server.send(404, "text/plain", "Not found");
+      request->send(404, "text/plain", "Not found");
       return;
     }
-    server.streamFile(f, "text/html");
-    f.close();
+    AsyncWebServerResponse* response = request->beginResponse(LittleFS, "/index.html", "text/html");
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
   });
-  server.serveStatic("/app.js", LittleFS, "/app.js");
-  server.serveStatic("/style.css", LittleFS, "/style.css");
+  server.serveStatic("/assets/", LittleFS, "/assets/").setCacheControl(WEB_ASSET_CACHE_CONTROL);
 
-  server.onNotFound([]() {
-    DBG_VERBOSE("Web: 404 %s from %s\n", server.uri().c_str(), server.client().remoteIP().toString().c_str());
-    server.send(404, "text/plain", "Not found");
+  // Unstamped names, for a filesystem image uploaded straight from data/
+  server.serveStatic("/app.js", LittleFS, "/app.js").setCacheControl("no-cache");
+  server.serveStatic("/style.css", LittleFS, "/style.css").setCacheControl("no-cache");
+
+  server.onNotFound([](AsyncWebServerRequest* request) {
+    DBG_VERBOSE("Web: 404 %s from %s\n", request->url().c_str(), request->client()->remoteIP().toString().c_str());
+    request->send(404, "text/plain", "Not found");
   });
 }
 
@@ -2289,6 +3023,10 @@ static void startWifi() {
   DBG_STEP("Starting WiFi (STA) + WiFiManager...");
   WiFi.mode(WIFI_STA);
 
+  // SSID/IP in /api/state are cached: refresh them on (re)connect and drop-out
+  WiFi.onEvent([](WiFiEvent_t, WiFiEventInfo_t) { invalidateStateCache(); }, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  WiFi.onEvent([](WiFiEvent_t, WiFiEventInfo_t) { invalidateStateCache(); }, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+
   WiFiManager wm;
   wm.setConfigPortalTimeout(180);
   wm.setConnectTimeout(20);
@@ -2376,6 +3114,17 @@ static void drawOTAProgress(unsigned int progress) {
   tft.drawString("Please wait...", tft.width() / 2, barY + barHeight + 20);
 }
 
+/**
+ * Take the display from the render task (OTA, network task)
+ * Waits for the frame in progress, if any; the render task then idles until
+ * otaActive is cleared.
+ */
+static void takeDisplay() {
+  otaActive = true;
+  wakeRenderTask();
+  xSemaphoreTake(displayHandoff, portMAX_DELAY);
+}
+
 static void startOta() {
   DBG_STEP("Starting OTA...");
   ArduinoOTA.setHostname(OTA_HOSTNAME);
@@ -2383,6 +3132,8 @@ static void startOta() {
 
   ArduinoOTA.onStart([]() {
     DBG_INFO("OTA update started\n");
+    // Take the display from the render task for the duration of the update
+    takeDisplay();
     // Clear screen for progress bar
     tft.fillScreen(TFT_BLACK);
   });
@@ -2408,606 +3159,96 @@ static void startOta() {
 
   ArduinoOTA.onError([](ota_error_t error) {
     DBG_ERROR("OTA update failed: error code %u\n", (unsigned)error);
+    if (!otaActive) takeDisplay();  // Auth and begin errors come before onStart
     // Display error message
     tft.fillScreen(TFT_BLACK);
-    tft.setTextDatum(MC_DATUM);
-    tft.setTextColor(TFT_RED, TFT_BLACK);
-    tft.setTextFont(4);
-    tft.drawString("Update Failed!", tft.width() / 2, tft.height() / 2 - 20);
-
-    // Show error details
-    tft.setTextFont(2);
-    tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
-    const char* errorMsg = "Unknown error";
-    switch (error) {
-      case OTA_AUTH_ERROR: errorMsg = "Auth Failed"; break;
-      case OTA_BEGIN_ERROR: errorMsg = "Begin Failed"; break;
-      case OTA_CONNECT_ERROR: errorMsg = "Connect Failed"; break;
-      case OTA_RECEIVE_ERROR: errorMsg = "Receive Failed"; break;
-      case OTA_END_ERROR: errorMsg = "End Failed"; break;
-    }
-    tft.drawString(errorMsg, tft.width() / 2, tft.height() / 2 + 20);
-
-    // Note: OTA error - check serial console or web interface for details
-    delay(3000);
-
-    // Return to normal display after 3 seconds
-    tft.fillScreen(TFT_BLACK);
-  });
-
-  ArduinoOTA.begin();
-  DBG_OK("OTA ready.");
-}
-
-// =========================
-// Clock logic & drawing
-// =========================
-static void formatTimeHHMMSS(struct tm& ti, char* out, size_t n) {
-  if (cfg.use24h) strftime(out, n, "%H%M%S", &ti);
-  else strftime(out, n, "%I%M%S", &ti);
-}
-
-
-static uint32_t lastSecond = 0;
-static char prevT[7] = "------";
-static char currT[7] = "------";
-static int morphStep = MORPH_STEPS;
-
-/**
- * Format date according to user's selected format
- * @param ti Time structure
- * @param out Output buffer
- * @param n Buffer size
- */
-static void formatDate(struct tm& ti, char* out, size_t n) {
-  switch (cfg.dateFormat) {
-    case 1:  // DD/MM/YYYY
-      strftime(out, n, "%d/%m/%Y", &ti);
-      break;
-    case 2:  // MM/DD/YYYY
-      strftime(out, n, "%m/%d/%Y", &ti);
-      break;
-    case 3:  // DD.MM.YYYY
-      strftime(out, n, "%d.%m.%Y", &ti);
-      break;
-    case 4:  // Mon DD, YYYY
-      strftime(out, n, "%b %d, %Y", &ti);
-      break;
-    default:  // 0 = YYYY-MM-DD (ISO 8601)
-      strftime(out, n, "%Y-%m-%d", &ti);
-      break;
-  }
-}
-
-static bool updateClockLogic() {
-  struct tm ti{};
-  if (!getLocalTimeSafe(ti, 50)) return false;
-
-  if ((uint32_t)ti.tm_sec == lastSecond) return false;
-  lastSecond = (uint32_t)ti.tm_sec;
-
-  char t6[7] = {0};
-  formatTimeHHMMSS(ti, t6, sizeof(t6));
-  formatDate(ti, currDate, sizeof(currDate));
-
-  if (strncmp(t6, currT, 6) != 0) {
-    memcpy(prevT, currT, 7);
-    memcpy(currT, t6, 7);
-    morphStep = 0;
-    DBG("[TIME] %.2s:%.2s:%.2s\n", currT, currT+2, currT+4);
-    return true;  // Time changed, need redraw
-  }
-  return true;  // Second changed (for morphing animation), need redraw
-}
-
-/**
- * Draw a bitmap to the framebuffer with specified intensity
- * @param bm Bitmap to render
- * @param x0 X position in framebuffer
- * @param y0 Y position in framebuffer
- * @param w Width of bitmap
- * @param intensity Brightness level (0-255), default 255
- */
-static void drawBitmapSolid(const Bitmap& bm, int x0, int y0, int w, uint8_t intensity = 255) {
-  // Convert user's LED color to RGB565
-  uint16_t baseColor = rgb888_to_565(cfg.ledColor);
-
-  // Apply intensity scaling to color
-  uint8_t r = ((baseColor >> 11) & 0x1F) * intensity / 255;
-  uint8_t g = ((baseColor >> 5) & 0x3F) * intensity / 255;
-  uint8_t b = (baseColor & 0x1F) * intensity / 255;
-  uint16_t color = (r << 11) | (g << 5) | b;
-
-  for (int y=0; y<DIGIT_H; y++) {
-    for (int x=0; x<w; x++) {
-      bool on = (bm.rows[y] >> (15-x)) & 0x1;
-      if (!on) continue;
-      int yScaled = (y * LED_MATRIX_H) / DIGIT_H;
-      fbSet(x0 + x, y0 + yScaled, color);
-    }
-  }
-}
-
-/**
- * Animated "spawn" morph effect for digit transitions
- * Pixels appear from random positions and move into their final positions
- * @param toBm Target bitmap to morph into
- * @param step Current animation step (0 to MORPH_STEPS)
- * @param x0 X position in framebuffer
- * @param y0 Y position in framebuffer
- * @param w Width of bitmap
- */
-static void drawSpawnMorphToTarget(const Bitmap& toBm, int step, int x0, int y0, int w) {
-  // Gather all ON pixels in target glyph
-  static Pt toPts[420];
-  int toN = buildPixelsFromBitmap(toBm, w, toPts, 420);
-  if (toN > 420) toN = 420;
-
-  // 0..1
-  float t = (float)step / (float)MORPH_STEPS;
-  if (t < 0) t = 0;
-  if (t > 1) t = 1;
-
-  // Ease-out (nice “snap into place”)
-  float te = 1.0f - (1.0f - t) * (1.0f - t);
-
-  // Spawn origin inside the glyph (center-ish)
-  const float sx = (float)(w - 1) * 0.5f;
-  const float sy = (float)(DIGIT_H - 1) * 0.5f;
-
-  // Fade-in as it moves
-  uint8_t alpha = (uint8_t)(255 * t);
-
-  // Convert user's LED color to RGB565 with alpha
-  uint16_t baseColor = rgb888_to_565(cfg.ledColor);
-  uint8_t r = ((baseColor >> 11) & 0x1F) * alpha / 255;
-  uint8_t g = ((baseColor >> 5) & 0x3F) * alpha / 255;
-  uint8_t b = (baseColor & 0x1F) * alpha / 255;
-  uint16_t color = (r << 11) | (g << 5) | b;
-
-  for (int i=0; i<toN; i++) {
-    float tx = (float)toPts[i].x;
-    float ty = (float)toPts[i].y;
-
-    float xf = sx + (tx - sx) * te;
-    float yf = sy + (ty - sy) * te;
-
-    int x = (int)lroundf(xf);
-    int y = (int)lroundf(yf);
-
-    int yScaled = (y * LED_MATRIX_H) / DIGIT_H;
-    fbSet(x0 + x, y0 + yScaled, color);
-  }
-}
-
-/**
- * Main frame rendering function - draws the complete clock display
- * Renders HH:MM:SS format with morphing animations on digit changes
- * Layout: 6 digits + 2 colons + 5 gaps, centered horizontally at top
- */
-static void drawFrame() {
-  fbClear(0);
-
-  const int digitW = DIGIT_W;
-  const int colonW = COLON_W;
-  const int gap = DIGIT_GAP;
-
-  // HH:MM:SS with gaps between digit pairs for readability
-  // Total width = (6 * digitW) + (2 * colonW) + (5 * gap)
-  // Gaps: after each digit except the last one in each pair
-  const int totalW = (6 * digitW) + (2 * colonW) + (5 * gap);
-  int x0 = (LED_MATRIX_W - totalW) / 2;
-  if (x0 < 0) x0 = 0;
-  const int y0 = 0;  // Clock at top of display
-
-  auto digitIdx = [&](char c)->int { return (c>='0' && c<='9') ? (c-'0') : 0; };
-
-  // Indices for each digit
-  int c[6] = {
-    digitIdx(currT[0]), digitIdx(currT[1]),
-    digitIdx(currT[2]), digitIdx(currT[3]),
-    digitIdx(currT[4]), digitIdx(currT[5])
-  };
-  int p[6] = {
-    digitIdx(prevT[0]), digitIdx(prevT[1]),
-    digitIdx(prevT[2]), digitIdx(prevT[3]),
-    digitIdx(prevT[4]), digitIdx(prevT[5])
-  };
-
-  int step = morphStep;
-  if (step > MORPH_STEPS) step = MORPH_STEPS;
-
-  auto drawDigit = [&](int pos, int xx) {
-    if (currT[pos] != prevT[pos] && step < MORPH_STEPS) {
-      // Digit changed → redraw whole digit with spawn morph
-      drawSpawnMorphToTarget(DIGITS[c[pos]], step, xx, y0, digitW);
-    } else {
-      // Digit unchanged or morph finished → solid draw
-      drawBitmapSolid(DIGITS[c[pos]], xx, y0, digitW, 255);
-    }
-  };
-
-  // HH with gap between digits
-  drawDigit(0, x0);
-  drawDigit(1, x0 + digitW + gap);
-
-  // : (flashing colon)
-  if (clockColon) {
-    drawBitmapSolid(COLON, x0 + 2*digitW + gap, y0, colonW, 255);
-  }
-
-  // MM with gap between digits
-  drawDigit(2, x0 + 2*digitW + gap + colonW + gap);
-  drawDigit(3, x0 + 3*digitW + 2*gap + colonW + gap);
-
-  // : (flashing colon)
-  if (clockColon) {
-    drawBitmapSolid(COLON, x0 + 4*digitW + 2*gap + colonW + gap, y0, colonW, 255);
-  }
-
-  // SS with gap between digits
-  drawDigit(4, x0 + 4*digitW + 2*gap + 2*colonW + 2*gap);
-  drawDigit(5, x0 + 5*digitW + 3*gap + 2*colonW + 2*gap);
-
-  // Calculate effective morph steps based on morphSpeed multiplier (1-10)
-  // morphSpeed=1: 20 frames, morphSpeed=10: 200 frames
-  int effectiveMorphSteps = MORPH_STEPS * cfg.morphSpeed;
-  if (morphStep < effectiveMorphSteps) morphStep++;
-}
-
-/**
- * Tetris Clock Mode - Renders time using falling Tetris block animations
- * Uses TetrisMatrixDraw library to create animated digit transitions
- * Respects 12/24 hour format and shows AM/PM indicator for 12-hour mode
- */
-static void drawFrameTetris() {
-  if (!tetrisClock) return;  // Safety check
-
-  fbClear(0);  // Clear framebuffer
-
-  // Get the 24-hour format hour for AM/PM determination
-  int hour24 = (currT[0] - '0') * 10 + (currT[1] - '0');
-  bool isPM = (hour24 >= 12);
-
-  // Format time string based on 12/24 hour preference
-  String timeStr;
-  if (cfg.use24h) {
-    // 24-hour format: "HH:MM" (00:00 to 23:59)
-    timeStr = String(currT[0]) + String(currT[1]) + ":" +
-              String(currT[2]) + String(currT[3]);
-  } else {
-    // 12-hour format: " H:MM" or "HH:MM" (space-padded for single digit hours)
-    int hour = hour24;
-    if (hour == 0) hour = 12;  // Midnight is 12 AM
-    else if (hour > 12) hour -= 12;  // Convert to 12-hour
-
-    if (hour < 10) {
-      timeStr = " " + String(hour) + ":" + String(currT[2]) + String(currT[3]);
-    } else {
-      timeStr = String(hour) + ":" + String(currT[2]) + String(currT[3]);
-    }
-  }
-
-  // Update Tetris clock (handles animation internally)
-  // Returns true when animation is complete, false while animating
-  tetrisClock->update(timeStr, cfg.use24h, clockColon, isPM);
-}
-
-/**
- * Draw a segment pixel with bounds checking for the LED matrix
- */
-static void drawLEDSegmentPixel(int x, int y, uint16_t color) {
-  if (x >= 0 && x < LED_MATRIX_W && y >= 0 && y < LED_MATRIX_H) {
-    fb[y][x] = color;
-  }
-}
-
-/**
- * Helper function to draw LED segments with proper bounds checking
- * Segments are drawn as 1-pixel thick lines (thickness handled by caller)
- */
-static void drawLEDSegment(int x1, int y1, int x2, int y2, int thickness, uint8_t brightness, uint16_t baseColor) {
-  if (brightness == 0) return;  // Don't draw invisible segments
-
-  // Apply brightness to color
-  uint8_t r = ((baseColor >> 11) & 0x1F) * brightness / 255;
-  uint8_t g = ((baseColor >> 5) & 0x3F) * brightness / 255;
-  uint8_t b = (baseColor & 0x1F) * brightness / 255;
-  uint16_t color = (r << 11) | (g << 5) | b;
-
-  // Draw line from (x1,y1) to (x2,y2) with bounds checking
-  int dx = abs(x2 - x1);
-  int dy = abs(y2 - y1);
-  int steps = max(dx, dy);
-  
-  for (int i = 0; i <= steps; i++) {
-    float t = steps > 0 ? (float)i / steps : 0.0f;
-    int x = x1 + (int)((x2 - x1) * t);
-    int y = y1 + (int)((y2 - y1) * t);
-    drawLEDSegmentPixel(x, y, color);
-  }
-
-  // Draw thickness (1 pixel on each side of the center line)
-  if (dx > dy) {
-    // Horizontal segment - add thickness above/below
-    for (int i = 0; i <= steps; i++) {
-      float t = steps > 0 ? (float)i / steps : 0.0f;
-      int x = x1 + (int)((x2 - x1) * t);
-      int y = y1 + (int)((y2 - y1) * t);
-      drawLEDSegmentPixel(x, y + 1, color);  // One pixel below
-    }
-  } else if (dy > dx) {
-    // Vertical segment - add thickness to the right
-    for (int i = 0; i <= steps; i++) {
-      float t = steps > 0 ? (float)i / steps : 0.0f;
-      int x = x1 + (int)((x2 - x1) * t);
-      int y = y1 + (int)((y2 - y1) * t);
-      drawLEDSegmentPixel(x + 1, y, color);  // One pixel to the right
-    }
-  }
-}
-
-/**
- * Draw a single LED dot at the specified position
- * LED has a glowing effect with center brighter than edges
- * @param x X position in framebuffer
- * @param y Y position in framebuffer
- * @param color Base LED color (RGB565)
- * @param brightness Brightness level (0-255)
- */
-static void drawLEDDot(int x, int y, uint16_t color, uint8_t brightness) {
-  if (x < 0 || y < 0 || x >= LED_MATRIX_W || y >= LED_MATRIX_H) return;
+    tft.setTextDatum(MC_DATUM);
+    tft.setTextColor(TFT_RED, TFT_BLACK);
+    tft.setTextFont(4);
+    tft.drawString("Update Failed!", tft.width() / 2, tft.height() / 2 - 20);
 
-  // Apply brightness to color
-  uint8_t r = ((color >> 11) & 0x1F) * brightness / 255;
-  uint8_t g = ((color >> 5) & 0x3F) * brightness / 255;
-  uint8_t b = (color & 0x1F) * brightness / 255;
-  uint16_t scaledColor = (r << 11) | (g << 5) | b;
+    // Show error details
+    tft.setTextFont(2);
+    tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
+    const char* errorMsg = "Unknown error";
+    switch (error) {
+      case OTA_AUTH_ERROR: errorMsg = "Auth Failed"; break;
+      case OTA_BEGIN_ERROR: errorMsg = "Begin Failed"; break;
+      case OTA_CONNECT_ERROR: errorMsg = "Connect Failed"; break;
+      case OTA_RECEIVE_ERROR: errorMsg = "Receive Failed"; break;
+      case OTA_END_ERROR: errorMsg = "End Failed"; break;
+    }
+    tft.drawString(errorMsg, tft.width() / 2, tft.height() / 2 + 20);
 
-  // Draw LED dot as a small filled circle pattern
-  // Center pixel (brightest)
-  fb[y][x] = scaledColor;
+    // Note: OTA error - check serial console or web interface for details
+    delay(3000);
 
-  // Small glow effect (neighboring pixels at reduced brightness)
-  uint8_t glow = brightness / 3;
-  uint8_t gr = ((color >> 11) & 0x1F) * glow / 255;
-  uint8_t gg = ((color >> 5) & 0x3F) * glow / 255;
-  uint8_t gb = (color & 0x1F) * glow / 255;
-  uint16_t glowColor = (gr << 11) | (gg << 5) | gb;
+    // Return to normal display after 3 seconds
+    tft.fillScreen(TFT_BLACK);
+    memset(fbPrev, 0, sizeof(fbPrev));  // Force full clock redraw
+    resetStatusBar();
+    otaActive = false;  // Hand the display back
+    requestRender();
+  });
 
-  // Draw surrounding glow pixels if within bounds
-  if (x > 0) fb[y][x - 1] = glowColor;
-  if (x < LED_MATRIX_W - 1) fb[y][x + 1] = glowColor;
-  if (y > 0) fb[y - 1][x] = glowColor;
-  if (y < LED_MATRIX_H - 1) fb[y + 1][x] = glowColor;
+  ArduinoOTA.begin();
+  DBG_OK("OTA ready.");
 }
 
-/**
- * Draw a segment as a row of LED dots (classic LED display look)
- * @param x1 Start X position
- * @param y1 Start Y position
- * @param x2 End X position
- * @param y2 End Y position
- * @param numLEDs Number of LEDs in this segment
- * @param brightness Brightness level (0-255)
- * @param color Base LED color (RGB565)
- */
-static void drawLEDSegmentDots(int x1, int y1, int x2, int y2, int numLEDs, uint8_t brightness, uint16_t color) {
-  if (brightness == 0) return;
-
-  // Calculate LED positions along the segment
-  for (int i = 0; i < numLEDs; i++) {
-    float t = (float)i / (float)(numLEDs - 1);
-    int x = x1 + (int)((x2 - x1) * t);
-    int y = y1 + (int)((y2 - y1) * t);
-    drawLEDDot(x, y, color, brightness);
-  }
+// =========================
+// Clock logic (time source; drawing is in ClockFace.cpp)
+// =========================
+static void formatTimeHHMMSS(struct tm& ti, char* out, size_t n) {
+  if (cfg.use24h) strftime(out, n, "%H%M%S", &ti);
+  else strftime(out, n, "%I%M%S", &ti);
 }
 
-/**
- * Render a single morphing digit at the specified position
- * Draws each segment as a row of LED dots with the digit's color
- * @param digit The MorphingDigit instance to render
- * @param offsetX X offset in matrix coordinates
- * @param offsetY Y offset in matrix coordinates
- */
-static void renderMorphingDigit(MorphingDigit* digit, int offsetX, int offsetY, uint16_t color) {
-  // Use the provided color (user's configured LED color) instead of per-digit colors
-
-  // Render all 7 segments
-  for (int seg = 0; seg < 7; seg++) {
-    uint8_t brightness = digit->getSegmentBrightness(seg);
-    if (brightness == 0) continue;  // Skip off segments
-
-    const SegmentCoords& coords = SEGMENT_COORDS[seg];
-
-    // Apply offset and render segment as LED dots
-    int x1 = offsetX + coords.x1;
-    int y1 = offsetY + coords.y1;
-    int x2 = offsetX + coords.x2;
-    int y2 = offsetY + coords.y2;
-
-    // thickness field is now used to store number of LEDs per segment
-    int numLEDs = coords.thickness;
-    if (numLEDs < 2) numLEDs = 2;  // Minimum 2 LEDs per segment
 
-    drawLEDSegmentDots(x1, y1, x2, y2, numLEDs, brightness, color);
-  }
-}
+static uint32_t lastSecond = 0;
 
 /**
- * Draw morphing clock display (CLOCK_MODE_MORPH)
- * Layout: HH:MM:SS centered on 64x32 matrix with 8x32 digit slots
- * Seconds update instantly without morphing for clear readability
+ * Format date according to user's selected format
+ * @param ti Time structure
+ * @param out Output buffer
+ * @param n Buffer size
  */
-static void drawFrameMorph() {
-  fbClear(0);  // Clear framebuffer
-
-  // Parse current time
-  uint8_t hourTens = currT[0] - '0';
-  uint8_t hourUnits = currT[1] - '0';
-  uint8_t minuteTens = currT[2] - '0';
-  uint8_t minuteUnits = currT[3] - '0';
-  uint8_t secondTens = currT[4] - '0';
-  uint8_t secondUnits = currT[5] - '0';
-
-  // Only update morphing targets when the digit actually changes (for HH and MM)
-  // Seconds update instantly without morphing for clear readability
-  if (currT[0] != prevT[0]) morphHourTens.setTarget(hourTens);
-  if (currT[1] != prevT[1]) morphHourUnits.setTarget(hourUnits);
-  if (currT[2] != prevT[2]) morphMinuteTens.setTarget(minuteTens);
-  if (currT[3] != prevT[3]) morphMinuteUnits.setTarget(minuteUnits);
-  
-  // Seconds: update instantly without morphing
-  morphSecondTens.setCurrent(secondTens);
-  morphSecondUnits.setCurrent(secondUnits);
-
-  // Update morphing animations every frame for smooth transitions (HH and MM only)
-  unsigned long now = millis();
-  unsigned long delta = now - lastMorphUpdate;
-  if (delta > 100) delta = 100;  // Cap delta to prevent jumps
-
-  morphHourTens.update(delta);
-  morphHourUnits.update(delta);
-  morphMinuteTens.update(delta);
-  morphMinuteUnits.update(delta);
-
-  lastMorphUpdate = now;
-
-  // Digit positioning for 64x32 matrix
-  // Layout: HH : MM : SS with proper spacing and visible colons
-  // Compact digits (18 rows) fit between sensor (y=0-4) and date (y=27-31)
-  // 6 digits at 7px wide = 42px, 2 colons at 2px = 4px, 2 digitGaps at 1px = 2px, 4 colonGaps at 1px = 4px
-  // Total width = 42 + 4 + 2 + 4 = 52px (shifted left slightly with 5px left margin)
-
-  const int digitWidth = 7;    // Digit width (matches segment coords)
-  const int digitGap = 1;      // Gap between digits within same group (HH, MM, SS)
-  const int colonGap = 1;      // Gap before/after colons (1 LED pixel)
-  const int colonWidth = 2;    // Colon width (2px for 2x2 LED dots)
-  const int startX = 5;        // Start with 5px margin on left (shifted left by 1 LED)
-  const int startY = 6;        // Start at y=6 (digits span y=7-24, leaving y=25-26 as 2-row gap before date at y=27)
-
-  uint16_t ledColor = rgb888_to_565(cfg.ledColor);
-
-  // Create dimmed color for colons (75% brightness)
-  // Extract RGB565 components and dim them
-  uint16_t r = (ledColor >> 11) & 0x1F;
-  uint16_t g = (ledColor >> 5) & 0x3F;
-  uint16_t b = ledColor & 0x1F;
-  r = (r * 3) / 4;
-  g = (g * 3) / 4;
-  b = (b * 3) / 4;
-  uint16_t colonColor = (r << 11) | (g << 5) | b;
-
-  // Calculate positions for each digit with proper spacing
-  int x = startX;
-
-  // HH (hours)
-  renderMorphingDigit(&morphHourTens, x, startY, ledColor);
-  x += digitWidth + digitGap;
-  renderMorphingDigit(&morphHourUnits, x, startY, ledColor);
-  x += digitWidth + colonGap;
-
-  // First colon (between hours and minutes) - 2x2 LED dots with dimmed color
-  if (clockColon) {
-    int colonY1 = startY + 5;   // Upper dot position (aligned with upper segment)
-    int colonY2 = startY + 13;  // Lower dot position (aligned with lower segment)
-    // Draw 2x2 colon dots
-    for (int dy = 0; dy < 2; dy++) {
-      for (int dx = 0; dx < 2; dx++) {
-        int px = x + dx;
-        int py1 = colonY1 + dy;
-        int py2 = colonY2 + dy;
-        if (px >= 0 && px < LED_MATRIX_W) {
-          if (py1 >= 0 && py1 < LED_MATRIX_H) fb[py1][px] = colonColor;
-          if (py2 >= 0 && py2 < LED_MATRIX_H) fb[py2][px] = colonColor;
-        }
-      }
-    }
-  }
-  x += colonWidth + colonGap;
-
-  // MM (minutes)
-  renderMorphingDigit(&morphMinuteTens, x, startY, ledColor);
-  x += digitWidth + digitGap;
-  renderMorphingDigit(&morphMinuteUnits, x, startY, ledColor);
-  x += digitWidth + colonGap;
-
-  // Second colon (between minutes and seconds) - 2x2 LED dots with dimmed color
-  if (clockColon) {
-    int colonY1 = startY + 5;   // Upper dot position (aligned with upper segment)
-    int colonY2 = startY + 13;  // Lower dot position (aligned with lower segment)
-    // Draw 2x2 colon dots
-    for (int dy = 0; dy < 2; dy++) {
-      for (int dx = 0; dx < 2; dx++) {
-        int px = x + dx;
-        int py1 = colonY1 + dy;
-        int py2 = colonY2 + dy;
-        if (px >= 0 && px < LED_MATRIX_W) {
-          if (py1 >= 0 && py1 < LED_MATRIX_H) fb[py1][px] = colonColor;
-          if (py2 >= 0 && py2 < LED_MATRIX_H) fb[py2][px] = colonColor;
-        }
-      }
-    }
+static void formatDate(struct tm& ti, char* out, size_t n) {
+  switch (cfg.dateFormat) {
+    case 1:  // DD/MM/YYYY
+      strftime(out, n, "%d/%m/%Y", &ti);
+      break;
+    case 2:  // MM/DD/YYYY
+      strftime(out, n, "%m/%d/%Y", &ti);
+      break;
+    case 3:  // DD.MM.YYYY
+      strftime(out, n, "%d.%m.%Y", &ti);
+      break;
+    case 4:  // Mon DD, YYYY
+      strftime(out, n, "%b %d, %Y", &ti);
+      break;
+    default:  // 0 = YYYY-MM-DD (ISO 8601)
+      strftime(out, n, "%Y-%m-%d", &ti);
+      break;
   }
-  x += colonWidth + colonGap;
+}
 
-  // SS (seconds)
-  renderMorphingDigit(&morphSecondTens, x, startY, ledColor);
-  x += digitWidth + digitGap;
-  renderMorphingDigit(&morphSecondUnits, x, startY, ledColor);
+static bool updateClockLogic() {
+  struct tm ti{};
+  if (!getLocalTimeSafe(ti, 50)) return false;
+  storeTimeSnapshot(ti);
 
-  // Add date display at BOTTOM of matrix (if enabled)
-  // Using y=27 ensures date (5 rows tall) spans y=27-31 within 32-row framebuffer (y=0-31)
-  // This leaves y=26 as gap between clock digits and date (1 row gap)
-  // Format currDate string (e.g., "12/01/2026" or "2026-01-12")
-  if (cfg.morphShowDate && currDate[0] != '-') {  // Check if enabled and date is valid
-    // Center date horizontally
-    int dateWidth = getTextWidth3x5(currDate);
-    int dateX = (LED_MATRIX_W - dateWidth) / 2;
-    // Use custom date color (RGB888 -> RGB565)
-    uint16_t dateColor = rgb888_to_565(cfg.morphDateColor);
-    drawText3x5(currDate, dateX, 27, dateColor);
-  }
+  if ((uint32_t)ti.tm_sec == lastSecond) return false;
+  lastSecond = (uint32_t)ti.tm_sec;
 
-  // Add sensor data at TOP of matrix (if enabled)
-  // Display format based on available sensor data
-  if (cfg.morphShowSensor && sensorAvailable) {
-    char sensorLine[64];  // Buffer for sensor text
+  char t6[7] = {0};
+  formatTimeHHMMSS(ti, t6, sizeof(t6));
+  formatDate(ti, currDate, sizeof(currDate));
 
-    // Convert temperature to display unit
-    int displayTemp = temperature;
-    const char* tempUnit = cfg.useFahrenheit ? "F" : "C";
-    if (cfg.useFahrenheit) {
-      displayTemp = (temperature * 9 / 5) + 32;
-    }
-
-    // Format sensor string based on available sensor capabilities
-    // Compact format to fit in 64 LED matrix width
-    #if defined(USE_BME280)
-      // BME280: Temperature, Humidity, Pressure
-      snprintf(sensorLine, sizeof(sensorLine), "%d%s %d%% %dHPA",
-               displayTemp, tempUnit, humidity, pressure);
-    #elif defined(USE_BMP280) || defined(USE_BMP180)
-      // BMP280/BMP180: Temperature and Pressure only
-      snprintf(sensorLine, sizeof(sensorLine), "%d%s %dHPA",
-               displayTemp, tempUnit, pressure);
-    #elif defined(USE_SHT3X) || defined(USE_HTU21D)
-      // SHT3X/HTU21D: Temperature and Humidity only
-      snprintf(sensorLine, sizeof(sensorLine), "%d%s %d%%",
-               displayTemp, tempUnit, humidity);
-    #else
-      // Unknown sensor, just show temp
-      snprintf(sensorLine, sizeof(sensorLine), "%d%s", displayTemp, tempUnit);
-    #endif
-
-    // Draw at top of matrix (y=0), centered horizontally like the date
-    int sensorWidth = getTextWidth3x5(sensorLine);
-    int sensorX = (LED_MATRIX_W - sensorWidth) / 2;
-    // Use custom sensor color (RGB888 -> RGB565)
-    uint16_t sensorColor = rgb888_to_565(cfg.morphSensorColor);
-    drawText3x5(sensorLine, sensorX, 0, sensorColor);
+  if (clockSetTime(t6)) {
+    DBG("[TIME] %.2s:%.2s:%.2s\n", currT, currT+2, currT+4);
+    return true;  // Time changed, need redraw
   }
+  return true;  // Second changed (for morphing animation), need redraw
 }
 
 
@@ -3069,40 +3310,6 @@ static void checkAutoRotation() {
   }
 }
 
-/**
- * Render the current clock mode
- */
-static void renderCurrentMode() {
-  switch (cfg.clockMode) {
-    case CLOCK_MODE_7SEG:
-      drawFrame();
-      break;
-
-    case CLOCK_MODE_TETRIS:
-      drawFrameTetris();
-      break;
-
-    case CLOCK_MODE_MORPH:
-      drawFrameMorph();
-      break;
-
-    default:
-      drawFrame();  // Fallback to 7-seg
-      break;
-  }
-}
-
-/**
- * Check if current mode needs continuous updates (for animations)
- * @return true if mode is animating and needs frequent updates
- */
-static bool modeNeedsAnimation() {
-  if (cfg.clockMode == CLOCK_MODE_TETRIS && tetrisClock) {
-    return tetrisClock->isAnimating();
-  }
-  return false;
-}
-
 // =========================
 // LED Matrix Splash Screen
 // =========================
@@ -3119,7 +3326,7 @@ static bool modeNeedsAnimation() {
 // Check if touch occurred (for skipping splash)
 static bool splashTouchDetected() {
 #if ENABLE_TOUCH
-  return touch.touched();
+  return digitalRead(TOUCH_IRQ_PIN) == LOW;  // INT is held low while touched
 #else
   return false;
 #endif
@@ -3522,6 +3729,10 @@ static const int startupLineHeight = 18;  // Line height for startup messages (F
 static void initStartupDisplay() {
   tft.init();
   tft.setRotation(1);  // Landscape orientation for ESP32 Touchdown
+  tft.setSwapBytes(true);  // pushPixels()/pushImage() buffers hold native-endian RGB565
+#if defined(USE_DMA_TO_TFT) && defined(ESP32_DMA)
+  tft.initDMA();  // Used by the band renderer (RENDER_MODE_BAND)
+#endif
   tft.fillScreen(TFT_BLACK);
   tft.setTextColor(TFT_WHITE, TFT_BLACK);
   tft.setTextFont(2);  // Font 2 (16px height) - good middle ground between size 1 and 2
@@ -3615,6 +3826,189 @@ static void showStartupStepWithStatus(const char* msg, const char* status) {
   yield();  // Feed watchdog after drawing
 }
 
+// =========================
+// Tasks
+// =========================
+
+/**
+ * Check if any Morphing (Remix) digit is mid-morph
+ */
+static bool remixMorphing() {
+  return morphHourTens.isMorphing() || morphHourUnits.isMorphing() ||
+         morphMinuteTens.isMorphing() || morphMinuteUnits.isMorphing() ||
+         morphSecondTens.isMorphing() || morphSecondUnits.isMorphing();
+}
+
+/**
+ * One pass of the render loop: web config, touch, mode rotation, clock logic and (when
+ * needed) a frame. Runs on the render task, which owns the display.
+ */
+static void renderStep() {
+  uint32_t now = millis();
+
+  // Web config changes first, so this frame already shows them
+  applyPendingConfig();
+
+  // Check auto-rotation timer
+  checkAutoRotation();
+
+  // Handle touch input
+#if ENABLE_TOUCH
+  handleTouch();
+#endif
+
+  // Toggle colon blink every second (drawn by all clock modes)
+  bool colonChanged = false;
+  if (now - lastColonToggle >= 1000) {
+    clockColon = !clockColon;
+    lastColonToggle = now;
+    colonChanged = true;
+  }
+
+  // Skip clock rendering if info page is active
+#if ENABLE_TOUCH
+  if (infoPageActive) {
+    return;  // Info page is displayed, don't render clock
+  }
+#endif
+
+  // Update clock logic only on second change (once per second)
+  // This is where we detect time changes
+  bool timeChanged = updateClockLogic();
+
+  // Determine if display needs update: time or colon change, a forced
+  // redraw, or an animation in progress. Nothing else changes the clock, so
+  // idle frames are skipped and the render task sleeps (renderSleepMs()).
+  bool needsUpdate = timeChanged || colonChanged || renderRequested;
+  renderRequested = false;
+
+  // Force first render after boot
+  if (firstRender) {
+    needsUpdate = true;
+    firstRender = false;
+  }
+
+  if (cfg.clockMode == CLOCK_MODE_7SEG) {
+    // Morphing mode: update during morph animation
+    if (morphStep < MORPH_STEPS) needsUpdate = true;
+  } else if (cfg.clockMode == CLOCK_MODE_TETRIS) {
+    // Tetris mode: update at controlled interval for visible block animation
+    if (modeNeedsAnimation()) {
+      needsUpdate = true;
+    }
+    // Also update at regular interval for animation frames (controlled by TETRIS_ANIMATION_SPEED)
+    if (now - lastTetrisUpdate >= TETRIS_ANIMATION_SPEED) {
+      needsUpdate = true;
+      lastTetrisUpdate = now;
+    }
+  } else if (cfg.clockMode == CLOCK_MODE_MORPH) {
+    // Morphing Remix mode: update while any digit is morphing
+    if (remixMorphing()) needsUpdate = true;
+  }
+
+  // Render and display if needed (at full CPU speed until the task next sleeps)
+  if (needsUpdate) {
+    Power::boost(POWER_RENDER);
+    {
+      PERF_SCOPE(PERF_RENDER_MODE);
+      renderCurrentMode();
+    }
+    {
+      PERF_SCOPE(PERF_RENDER_TFT);
+      renderFBToTFT();
+    }
+  }
+}
+
+/**
+ * How long the render task can sleep before renderStep() has work to do
+ * The earliest of: the next wall-clock second, the next colon blink, the
+ * next Tetris animation step and the info page timeout; 0 while a morph or
+ * Tetris animation is running (frames then go out as fast as the TFT takes them).
+ */
+static uint32_t renderSleepMs(uint32_t now) {
+  if (firstRender || renderRequested) return 0;
+
+  // Next second boundary (rounded down to the ms, so the wake is never early)
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  uint32_t wait = 1000 - (uint32_t)(tv.tv_usec / 1000);
+
+  uint32_t colonMs = now - lastColonToggle >= 1000 ? 0 : 1000 - (now - lastColonToggle);
+  if (colonMs < wait) wait = colonMs;
+
+#if ENABLE_TOUCH
+  // Info page timeout (touch gestures wake the task themselves)
+  if (infoPageActive) {
+    uint32_t shownMs = now - infoPageStartTime;
+    uint32_t leftMs = shownMs >= INFO_PAGE_TIMEOUT_MS ? 0 : INFO_PAGE_TIMEOUT_MS - shownMs;
+    return leftMs < wait ? leftMs : wait;
+  }
+#endif
+
+  if (cfg.clockMode == CLOCK_MODE_7SEG) {
+    if (morphStep < MORPH_STEPS) return 0;
+  } else if (cfg.clockMode == CLOCK_MODE_TETRIS) {
+    if (modeNeedsAnimation()) return 0;
+    uint32_t stepMs = now - lastTetrisUpdate >= TETRIS_ANIMATION_SPEED ? 0 : TETRIS_ANIMATION_SPEED - (now - lastTetrisUpdate);
+    if (stepMs < wait) wait = stepMs;
+  } else if (cfg.clockMode == CLOCK_MODE_MORPH) {
+    if (remixMorphing()) return 0;
+  }
+  return wait;
+}
+
+/**
+ * Render task (RENDER_TASK_CORE): sole owner of the TFT during normal operation
+ * A slow HTTP client or sensor read on the other core no longer delays frames.
+ * Between frames it blocks until the next deadline or requestRender(), which
+ * leaves the core to the idle task; the time spent waiting is PERF_IDLE.
+ * Frames are drawn under a POWER_RENDER boost, dropped when the task sleeps.
+ */
+static void renderTask(void*) {
+  for (;;) {
+    uint32_t wait;
+    if (otaActive) {
+      // OTA owns the display: confirm once, then sleep until it hands it back
+      if (!renderParked) {
+        renderParked = true;
+        xSemaphoreGive(displayHandoff);
+      }
+      wait = 1000;
+    } else {
+      renderParked = false;
+      renderStep();
+      wait = renderSleepMs(millis());
+    }
+    // Frames go out back-to-back while animating; otherwise let the clock drop
+    if (wait > 0) Power::release(POWER_RENDER);
+
+    // At least one tick, so the other tasks on this core get a turn
+    const uint32_t t0 = micros();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait) + 1);
+    PERF_IDLE(micros() - t0);
+  }
+}
+
+/**
+ * Network task (NET_TASK_CORE): OTA, mirror stream, deferred restarts, power housekeeping and periodic sensor reads (queued on I2CBus)
+ * HTTP requests are served by AsyncWebServer from the AsyncTCP task.
+ */
+static void netTask(void*) {
+  for (;;) {
+    ArduinoOTA.handle();
+    mirrorStreamLoop();
+    handlePendingRestart();
+    Power::tick();
+
+    // Update sensor data periodically (one non-blocking step per pass)
+    sensorPoll(millis());
+    History::tick(time(nullptr));
+
+    vTaskDelay(2);
+  }
+}
+
 // =========================
 // Setup / Loop
 // =========================
@@ -3718,10 +4112,12 @@ void setup() {
   startWifi();
   showStartupStepWithStatus("Starting WiFi... ", "OK");
 
-  // Sensor
-  sensorAvailable = testSensor();
+  // Sensor (from here on only the I2C bus task uses Wire)
+  I2CBus::begin(SENSOR_SDA_PIN, SENSOR_SCL_PIN);
+  sensorAvailable = I2CBus::run(I2C_DEV_SENSOR, I2C_PRIO_LOW, [](void*) { return detectSensors(); });
   if (sensorAvailable) {
-    updateSensorData();
+    History::begin();
+    applySensorReading(Sensors::merge(sensorReadings, sensorValid));
     lastSensorUpdate = millis();
     DBG_OK("Sensor initialized and reading.");
     showStartupStepWithStatus("Checking sensor... ", "OK");
@@ -3733,7 +4129,7 @@ void setup() {
 
   // Touch Controller
 #if ENABLE_TOUCH
-  bool touchAvailable = initTouch();
+  bool touchAvailable = I2CBus::run(I2C_DEV_TOUCH, I2C_PRIO_HIGH, [](void*) { return initTouch(); });
   if (touchAvailable) {
     showStartupStepWithStatus("Initializing touch... ", "OK");
   } else {
@@ -3747,15 +4143,25 @@ void setup() {
   startOta();
 
   DBG_STEP("Starting WebServer + routes...");
+  // Every request (API and static files) keeps the CPU at full speed for a moment
+  server.addMiddleware([](AsyncWebServerRequest* request, ArMiddlewareNext next) {
+    Power::webActivity();
+    next();
+  });
+  mirrorSocket.onEvent(onMirrorSocketEvent);
+  server.addHandler(&mirrorSocket);  // Before the static files, which match every path
   serveStaticFiles();
   server.on("/api/state", HTTP_GET, handleGetState);
-  server.on("/api/config", HTTP_POST, handlePostConfig);
+  AsyncCallbackJsonWebHandler* configHandler = new AsyncCallbackJsonWebHandler("/api/config", handlePostConfig);
+  configHandler->setMethod(HTTP_POST);
+  server.addHandler(configHandler);
   server.on("/api/mirror", HTTP_GET, handleGetMirror);
+  server.on("/api/perf", HTTP_GET, handleGetPerf);
+  server.on("/api/history", HTTP_GET, handleGetHistory);
   server.on("/api/timezones", HTTP_GET, handleGetTimezones);
   server.on("/api/reset-wifi", HTTP_POST, handleResetWiFi);
   server.on("/api/reboot", HTTP_POST, handleReboot);
-  server.begin();
-  DBG_OK("WebServer ready.");
+  DBG_OK("WebServer routes registered.");
   showStartupStepWithStatus("Starting services... ", "OK");
 
   // Show IP address
@@ -3798,85 +4204,27 @@ void setup() {
   tft.fillScreen(TFT_BLACK);
   memset(fbPrev, 0, sizeof(fbPrev));  // Initialize delta buffer for clean first frame
   resetStatusBar();  // Force status bar to draw on first frame
-}
-
-void loop() {
-  ArduinoOTA.handle();
-  server.handleClient();
-
-  uint32_t now = millis();
-
-  // Update sensor data periodically
-  if (sensorAvailable && (now - lastSensorUpdate >= SENSOR_UPDATE_INTERVAL)) {
-    updateSensorData();
-    lastSensorUpdate = now;
-  }
-
-  // Check auto-rotation timer
-  checkAutoRotation();
-
-  // Handle touch input
-#if ENABLE_TOUCH
-  handleTouch();
-#endif
-
-  // Toggle colon blink every second (for Tetris mode)
-  if (now - lastColonToggle >= 1000) {
-    clockColon = !clockColon;
-    lastColonToggle = now;
-  }
 
-  // Skip clock rendering if info page is active
+  // Hand off to the render and network tasks (loop() exits). The server only
+  // starts accepting now: its handlers run on the AsyncTCP task straight
+  // away and rely on the mutexes and power management being set up.
+  Power::begin();
+  displayHandoff = xSemaphoreCreateBinary();
+  mirrorFrameMutex = xSemaphoreCreateMutex();
+  mirrorClientsMutex = xSemaphoreCreateMutex();
+  server.begin();
+  DBG_OK("WebServer ready.");
+  xTaskCreatePinnedToCore(renderTask, "render", RENDER_TASK_STACK, nullptr,
+                          RENDER_TASK_PRIORITY, &renderTaskHandle, RENDER_TASK_CORE);
+  xTaskCreatePinnedToCore(netTask, "net", NET_TASK_STACK, nullptr,
+                          NET_TASK_PRIORITY, nullptr, NET_TASK_CORE);
 #if ENABLE_TOUCH
-  if (infoPageActive) {
-    return;  // Info page is displayed, don't render clock
-  }
+  if (touchAvailable) startTouchTask();
 #endif
+  DBG_INFO("Tasks started: render on core %d, network on core %d\n", RENDER_TASK_CORE, NET_TASK_CORE);
+}
 
-  // Update clock logic only on second change (once per second)
-  // This is where we detect time changes
-  bool timeChanged = updateClockLogic();
-
-  // Determine if display needs update
-  bool needsUpdate = false;
-
-  // Force first render after boot
-  if (firstRender) {
-    needsUpdate = true;
-    firstRender = false;
-  }
-
-  if (cfg.clockMode == CLOCK_MODE_7SEG) {
-    // Morphing mode: update on time change or during morph animation
-    needsUpdate = timeChanged || morphStep < MORPH_STEPS;
-  } else if (cfg.clockMode == CLOCK_MODE_TETRIS) {
-    // Tetris mode: update at controlled interval for visible block animation
-    if (timeChanged || modeNeedsAnimation()) {
-      needsUpdate = true;
-    }
-    // Also update at regular interval for animation frames (controlled by TETRIS_ANIMATION_SPEED)
-    if (now - lastTetrisUpdate >= TETRIS_ANIMATION_SPEED) {
-      needsUpdate = true;
-      lastTetrisUpdate = now;
-    }
-  } else if (cfg.clockMode == CLOCK_MODE_MORPH) {
-    // Morphing Remix mode: update on time change or while any digit is morphing
-    bool anyMorphing = morphHourTens.isMorphing() || morphHourUnits.isMorphing() ||
-                       morphMinuteTens.isMorphing() || morphMinuteUnits.isMorphing() ||
-                       morphSecondTens.isMorphing() || morphSecondUnits.isMorphing();
-    needsUpdate = timeChanged || anyMorphing;
-
-    // Also update at regular interval for smooth animation (60 FPS = ~16ms)
-    static unsigned long lastMorphRender = 0;
-    if (now - lastMorphRender >= 16) {
-      needsUpdate = true;
-      lastMorphRender = now;
-    }
-  }
-
-  // Render and display if needed
-  if (needsUpdate) {
-    renderCurrentMode();
-    renderFBToTFT();
-  }
+void loop() {
+  // All work happens in renderTask (core 1) and netTask (core 0)
+  vTaskDelete(NULL);
 }
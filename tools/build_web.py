@@ -0,0 +1,109 @@
+"""
+Web UI asset pipeline (PlatformIO pre-script, see platformio.ini)
+
+Minifies and gzips data/ into $BUILD_DIR/data and points the filesystem image
+(buildfs/uploadfs) at that directory instead of data/:
+
+  index.html                ->  /index.html.gz
+  app.js, style.css, ...    ->  /assets/<name>.<hash>.<ext>.gz
+
+<hash> is the first 8 hex digits of the SHA-256 of the minified file, and the
+references in index.html are rewritten to the stamped names. A changed asset
+therefore gets a new URL, so the firmware can serve /assets/ with an immutable
+Cache-Control while index.html is revalidated on every load.
+
+Minification is deliberately conservative (comments, indentation and blank
+lines only); gzip does the heavy lifting.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import shutil
+
+Import("env")  # noqa: F821 (provided by SCons)
+
+SRC_DIR = os.path.join(env.subst("$PROJECT_DIR"), "data")  # noqa: F821
+OUT_DIR = os.path.join(env.subst("$BUILD_DIR"), "data")  # noqa: F821
+ASSET_DIR = "assets"
+HASH_LEN = 8
+
+
+def strip_lines(text):
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line) + "\n"
+
+
+def minify_js(text):
+    # Whole-line // comments only: a trailing // may sit inside a string or URL
+    return strip_lines("\n".join(line for line in text.splitlines()
+                                 if not line.lstrip().startswith("//")))
+
+
+def minify_css(text):
+    return strip_lines(re.sub(r"/\*.*?\*/", "", text, flags=re.S))
+
+
+def minify_html(text):
+    return strip_lines(re.sub(r"<!--.*?-->", "", text, flags=re.S))
+
+
+MINIFIERS = {
+    ".js": minify_js,
+    ".css": minify_css,
+    ".html": minify_html,
+}
+
+
+def write_gz(path, data):
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "wb") as f:
+        # mtime=0 keeps the image byte-identical between builds
+        f.write(gzip.compress(data, compresslevel=9, mtime=0))
+
+
+def build():
+    if os.path.isdir(OUT_DIR):
+        shutil.rmtree(OUT_DIR)
+    os.makedirs(OUT_DIR)
+
+    renamed = {}  # "/app.js" -> "/assets/app.1a2b3c4d.js"
+    pages = {}
+    raw_bytes = 0
+
+    for name in sorted(os.listdir(SRC_DIR)):
+        src = os.path.join(SRC_DIR, name)
+        if not os.path.isfile(src):
+            continue
+        base, ext = os.path.splitext(name)
+        with open(src, "rb") as f:
+            data = f.read()
+        raw_bytes += len(data)
+
+        minify = MINIFIERS.get(ext)
+        if minify:
+            data = minify(data.decode("utf-8")).encode("utf-8")
+
+        if ext == ".html":
+            pages[name] = data  # Written once the asset names are known
+            continue
+
+        digest = hashlib.sha256(data).hexdigest()[:HASH_LEN]
+        stamped = "%s/%s.%s%s" % (ASSET_DIR, base, digest, ext)
+        renamed["/" + name] = "/" + stamped
+        write_gz(os.path.join(OUT_DIR, stamped + ".gz"), data)
+
+    for name, data in pages.items():
+        html = data.decode("utf-8")
+        for old, new in renamed.items():
+            html = re.sub(r"""(["'])%s\1""" % re.escape(old), r"\g<1>%s\g<1>" % new, html)
+        write_gz(os.path.join(OUT_DIR, name + ".gz"), html.encode("utf-8"))
+
+    out_bytes = sum(os.path.getsize(os.path.join(d, f))
+                    for d, _, files in os.walk(OUT_DIR) for f in files)
+    print("Web UI: %d bytes in data/ -> %d bytes gzipped in %s" % (raw_bytes, out_bytes, OUT_DIR))
+
+
+build()
+env.Replace(PROJECT_DATA_DIR=OUT_DIR)  # noqa: F821
@@ -0,0 +1,139 @@
+"""
+Generate src/MorphPairs.cpp - pixel-pair tables for the 7-segment morph
+
+For every pair of digits a < b, the ON pixels of digit a are matched to the
+ON pixels of digit b so that the total squared travel distance is minimal
+(Hungarian algorithm). When one glyph has fewer pixels, its pixels are
+repeated as evenly as possible until both sides have the same count, so
+pixels split or merge but every LED of both glyphs takes part. The b -> a
+morph uses the same pairs reversed.
+
+The glyphs are rebuilt here the same way as makeDigit7Seg() in
+ClockFace.cpp; initBitmaps() checks the tables against the real bitmaps and
+falls back to the spawn morph if they ever disagree.
+
+Usage: python3 tools/gen_morph_pairs.py   (rewrites src/MorphPairs.cpp)
+"""
+
+import os
+
+DIGIT_W = 9
+DIGIT_H = 32
+
+SEGMENTS = ["abcdef", "bc", "abged", "abgcd", "fgbc", "afgcd", "afgedc", "abc", "abcdefg", "abcdfg"]
+
+OUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "MorphPairs.cpp")
+
+
+def digit_pixels(d):
+    """ON pixels of makeDigit7Seg(d) as (x, y), in scan order"""
+    segs = SEGMENTS[d]
+    pad_x, pad_y, th = 0, 1, 4
+    w, h = DIGIT_W, DIGIT_H
+    mid = h // 2
+    on = set()
+
+    def fill(xs, ys):
+        on.update((x, y) for x in xs for y in ys if 0 <= x < w and 0 <= y < h)
+
+    full_w = range(pad_x, w - pad_x)
+    if "a" in segs: fill(full_w, range(pad_y, pad_y + th))
+    if "d" in segs: fill(full_w, range(h - pad_y - th, h - pad_y))
+    if "g" in segs: fill(full_w, range(mid - th // 2, mid - th // 2 + th))
+    if "f" in segs: fill(range(pad_x, pad_x + th), range(pad_y, mid))
+    if "b" in segs: fill(range(w - pad_x - th, w - pad_x), range(pad_y, mid))
+    if "e" in segs: fill(range(pad_x, pad_x + th), range(mid, h - pad_y))
+    if "c" in segs: fill(range(w - pad_x - th, w - pad_x), range(mid, h - pad_y))
+    return sorted(on, key=lambda p: (p[1], p[0]))
+
+
+def hungarian(cost):
+    """Minimum-cost perfect matching on a square matrix; returns row -> column"""
+    n = len(cost)
+    inf = float("inf")
+    u = [0] * (n + 1)
+    v = [0] * (n + 1)
+    p = [0] * (n + 1)
+    way = [0] * (n + 1)
+    for i in range(1, n + 1):
+        p[0] = i
+        j0 = 0
+        minv = [inf] * (n + 1)
+        used = [False] * (n + 1)
+        while True:
+            used[j0] = True
+            i0 = p[j0]
+            row = cost[i0 - 1]
+            delta = inf
+            j1 = 0
+            for j in range(1, n + 1):
+                if used[j]:
+                    continue
+                cur = row[j - 1] - u[i0] - v[j]
+                if cur < minv[j]:
+                    minv[j] = cur
+                    way[j] = j0
+                if minv[j] < delta:
+                    delta = minv[j]
+                    j1 = j
+            for j in range(n + 1):
+                if used[j]:
+                    u[p[j]] += delta
+                    v[j] -= delta
+                else:
+                    minv[j] -= delta
+            j0 = j1
+            if p[j0] == 0:
+                break
+        while j0:
+            j1 = way[j0]
+            p[j0] = p[j1]
+            j0 = j1
+
+    match = [0] * n
+    for j in range(1, n + 1):
+        match[p[j] - 1] = j - 1
+    return match
+
+
+def pair_digits(a, b):
+    src, dst = digit_pixels(a), digit_pixels(b)
+    n = max(len(src), len(dst))
+
+    def spread(pts):
+        return [pts[k * len(pts) // n] for k in range(n)]
+
+    src, dst = spread(src), spread(dst)
+    cost = [[(s[0] - d[0]) ** 2 + (s[1] - d[1]) ** 2 for d in dst] for s in src]
+    match = hungarian(cost)
+    pairs = sorted((src[i] + dst[match[i]] for i in range(n)), key=lambda q: (q[1], q[0], q[3], q[2]))
+    travel = sum(cost[i][match[i]] for i in range(n))
+    return pairs, travel
+
+
+def main():
+    lines = []
+    offsets = [0]
+    for a in range(10):
+        for b in range(a + 1, 10):
+            pairs, travel = pair_digits(a, b)
+            lines.append("  // %d <-> %d: %d pairs, total squared travel %d" % (a, b, len(pairs), travel))
+            for k in range(0, len(pairs), 8):
+                lines.append("  " + " ".join("{%d,%d,%d,%d}," % q for q in pairs[k:k + 8]))
+            offsets.append(offsets[-1] + len(pairs))
+
+    with open(OUT, "w") as f:
+        f.write("// Generated by tools/gen_morph_pairs.py - do not edit\n")
+        f.write('#include "MorphPairs.h"\n\n')
+        f.write("const MorphPair MORPH_PAIRS[%d] = {\n" % offsets[-1])
+        f.write("\n".join(lines))
+        f.write("\n};\n\n")
+        f.write("const uint16_t MORPH_PAIR_OFFSETS[MORPH_PAIR_TABLES + 1] = {\n")
+        for k in range(0, len(offsets), 12):
+            f.write("  " + " ".join("%d," % o for o in offsets[k:k + 12]) + "\n")
+        f.write("};\n")
+    print("%d pairs (%d bytes) -> %s" % (offsets[-1], offsets[-1] * 4, os.path.normpath(OUT)))
+
+
+if __name__ == "__main__":
+    main()